@@ -122,28 +122,42 @@ void Pass1(uint2 blockStart, uint3 threadId) {
 //!BLOCK_SIZE 8
 //!NUM_THREADS 64
 
+#define SH_SIZE (MP_BLOCK_WIDTH + 2)
+
+groupshared float4 shFeatures[2][SH_SIZE][SH_SIZE];
+
 void Pass2(uint2 blockStart, uint3 threadId) {
-	uint2 gxy = Rmp8x8(threadId.x) + blockStart;
+	float2 inputPt = GetInputPt();
 	uint2 inputSize = GetInputSize();
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE * SH_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE, k / SH_SIZE);
+		const float2 tpos = (blockStart + shPos - 0.5f) * inputPt;
+		shFeatures[0][shPos.y][shPos.x] = tex1.SampleLevel(sam, tpos, 0);
+		shFeatures[1][shPos.y][shPos.x] = tex2.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 localPos = Rmp8x8(threadId.x);
+	const uint2 gxy = localPos + blockStart;
 	if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
 		return;
 	}
 
-	float2 inputPt = GetInputPt();
-	float2 pos = (gxy + 0.5f) * inputPt;
-
 	// [ a, d, g ]
 	// [ b, e, h ]
 	// [ c, f, i ]
-	float4 a1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d1 = tex1.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e1 = tex1.SampleLevel(sam, pos, 0);
-	float4 f1 = tex1.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a1 = shFeatures[0][localPos.y][localPos.x];
+	float4 b1 = shFeatures[0][localPos.y + 1][localPos.x];
+	float4 c1 = shFeatures[0][localPos.y + 2][localPos.x];
+	float4 d1 = shFeatures[0][localPos.y][localPos.x + 1];
+	float4 e1 = shFeatures[0][localPos.y + 1][localPos.x + 1];
+	float4 f1 = shFeatures[0][localPos.y + 2][localPos.x + 1];
+	float4 g1 = shFeatures[0][localPos.y][localPos.x + 2];
+	float4 h1 = shFeatures[0][localPos.y + 1][localPos.x + 2];
+	float4 i1 = shFeatures[0][localPos.y + 2][localPos.x + 2];
 
 	float4 na1 = max(-a1, 0);
 	float4 nb1 = max(-b1, 0);
@@ -165,15 +179,15 @@ void Pass2(uint2 blockStart, uint3 threadId) {
 	h1 = max(h1, 0);
 	i1 = max(i1, 0);
 
-	float4 a2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d2 = tex2.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e2 = tex2.SampleLevel(sam, pos, 0);
-	float4 f2 = tex2.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a2 = shFeatures[1][localPos.y][localPos.x];
+	float4 b2 = shFeatures[1][localPos.y + 1][localPos.x];
+	float4 c2 = shFeatures[1][localPos.y + 2][localPos.x];
+	float4 d2 = shFeatures[1][localPos.y][localPos.x + 1];
+	float4 e2 = shFeatures[1][localPos.y + 1][localPos.x + 1];
+	float4 f2 = shFeatures[1][localPos.y + 2][localPos.x + 1];
+	float4 g2 = shFeatures[1][localPos.y][localPos.x + 2];
+	float4 h2 = shFeatures[1][localPos.y + 1][localPos.x + 2];
+	float4 i2 = shFeatures[1][localPos.y + 2][localPos.x + 2];
 
 	float4 na2 = max(-a2, 0);
 	float4 nb2 = max(-b2, 0);
@@ -283,28 +297,42 @@ void Pass2(uint2 blockStart, uint3 threadId) {
 //!BLOCK_SIZE 8
 //!NUM_THREADS 64
 
+#define SH_SIZE (MP_BLOCK_WIDTH + 2)
+
+groupshared float4 shFeatures[2][SH_SIZE][SH_SIZE];
+
 void Pass3(uint2 blockStart, uint3 threadId) {
-	uint2 gxy = Rmp8x8(threadId.x) + blockStart;
+	float2 inputPt = GetInputPt();
 	uint2 inputSize = GetInputSize();
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE * SH_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE, k / SH_SIZE);
+		const float2 tpos = (blockStart + shPos - 0.5f) * inputPt;
+		shFeatures[0][shPos.y][shPos.x] = tex3.SampleLevel(sam, tpos, 0);
+		shFeatures[1][shPos.y][shPos.x] = tex4.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 localPos = Rmp8x8(threadId.x);
+	const uint2 gxy = localPos + blockStart;
 	if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
 		return;
 	}
 
-	float2 inputPt = GetInputPt();
-	float2 pos = (gxy + 0.5f) * inputPt;
-
 	// [ a, d, g ]
 	// [ b, e, h ]
 	// [ c, f, i ]
-	float4 a1 = tex3.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b1 = tex3.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c1 = tex3.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d1 = tex3.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e1 = tex3.SampleLevel(sam, pos, 0);
-	float4 f1 = tex3.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g1 = tex3.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h1 = tex3.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i1 = tex3.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a1 = shFeatures[0][localPos.y][localPos.x];
+	float4 b1 = shFeatures[0][localPos.y + 1][localPos.x];
+	float4 c1 = shFeatures[0][localPos.y + 2][localPos.x];
+	float4 d1 = shFeatures[0][localPos.y][localPos.x + 1];
+	float4 e1 = shFeatures[0][localPos.y + 1][localPos.x + 1];
+	float4 f1 = shFeatures[0][localPos.y + 2][localPos.x + 1];
+	float4 g1 = shFeatures[0][localPos.y][localPos.x + 2];
+	float4 h1 = shFeatures[0][localPos.y + 1][localPos.x + 2];
+	float4 i1 = shFeatures[0][localPos.y + 2][localPos.x + 2];
 
 	float4 na1 = max(-a1, 0);
 	float4 nb1 = max(-b1, 0);
@@ -326,15 +354,15 @@ void Pass3(uint2 blockStart, uint3 threadId) {
 	h1 = max(h1, 0);
 	i1 = max(i1, 0);
 
-	float4 a2 = tex4.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b2 = tex4.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c2 = tex4.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d2 = tex4.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e2 = tex4.SampleLevel(sam, pos, 0);
-	float4 f2 = tex4.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g2 = tex4.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h2 = tex4.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i2 = tex4.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a2 = shFeatures[1][localPos.y][localPos.x];
+	float4 b2 = shFeatures[1][localPos.y + 1][localPos.x];
+	float4 c2 = shFeatures[1][localPos.y + 2][localPos.x];
+	float4 d2 = shFeatures[1][localPos.y][localPos.x + 1];
+	float4 e2 = shFeatures[1][localPos.y + 1][localPos.x + 1];
+	float4 f2 = shFeatures[1][localPos.y + 2][localPos.x + 1];
+	float4 g2 = shFeatures[1][localPos.y][localPos.x + 2];
+	float4 h2 = shFeatures[1][localPos.y + 1][localPos.x + 2];
+	float4 i2 = shFeatures[1][localPos.y + 2][localPos.x + 2];
 
 	float4 na2 = max(-a2, 0);
 	float4 nb2 = max(-b2, 0);
@@ -444,28 +472,42 @@ void Pass3(uint2 blockStart, uint3 threadId) {
 //!BLOCK_SIZE 8
 //!NUM_THREADS 64
 
+#define SH_SIZE (MP_BLOCK_WIDTH + 2)
+
+groupshared float4 shFeatures[2][SH_SIZE][SH_SIZE];
+
 void Pass4(uint2 blockStart, uint3 threadId) {
-	uint2 gxy = Rmp8x8(threadId.x) + blockStart;
+	float2 inputPt = GetInputPt();
 	uint2 inputSize = GetInputSize();
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE * SH_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE, k / SH_SIZE);
+		const float2 tpos = (blockStart + shPos - 0.5f) * inputPt;
+		shFeatures[0][shPos.y][shPos.x] = tex1.SampleLevel(sam, tpos, 0);
+		shFeatures[1][shPos.y][shPos.x] = tex2.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 localPos = Rmp8x8(threadId.x);
+	const uint2 gxy = localPos + blockStart;
 	if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
 		return;
 	}
 
-	float2 inputPt = GetInputPt();
-	float2 pos = (gxy + 0.5f) * inputPt;
-
 	// [ a, d, g ]
 	// [ b, e, h ]
 	// [ c, f, i ]
-	float4 a1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d1 = tex1.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e1 = tex1.SampleLevel(sam, pos, 0);
-	float4 f1 = tex1.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a1 = shFeatures[0][localPos.y][localPos.x];
+	float4 b1 = shFeatures[0][localPos.y + 1][localPos.x];
+	float4 c1 = shFeatures[0][localPos.y + 2][localPos.x];
+	float4 d1 = shFeatures[0][localPos.y][localPos.x + 1];
+	float4 e1 = shFeatures[0][localPos.y + 1][localPos.x + 1];
+	float4 f1 = shFeatures[0][localPos.y + 2][localPos.x + 1];
+	float4 g1 = shFeatures[0][localPos.y][localPos.x + 2];
+	float4 h1 = shFeatures[0][localPos.y + 1][localPos.x + 2];
+	float4 i1 = shFeatures[0][localPos.y + 2][localPos.x + 2];
 
 	float4 na1 = max(-a1, 0);
 	float4 nb1 = max(-b1, 0);
@@ -487,15 +529,15 @@ void Pass4(uint2 blockStart, uint3 threadId) {
 	h1 = max(h1, 0);
 	i1 = max(i1, 0);
 
-	float4 a2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d2 = tex2.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e2 = tex2.SampleLevel(sam, pos, 0);
-	float4 f2 = tex2.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a2 = shFeatures[1][localPos.y][localPos.x];
+	float4 b2 = shFeatures[1][localPos.y + 1][localPos.x];
+	float4 c2 = shFeatures[1][localPos.y + 2][localPos.x];
+	float4 d2 = shFeatures[1][localPos.y][localPos.x + 1];
+	float4 e2 = shFeatures[1][localPos.y + 1][localPos.x + 1];
+	float4 f2 = shFeatures[1][localPos.y + 2][localPos.x + 1];
+	float4 g2 = shFeatures[1][localPos.y][localPos.x + 2];
+	float4 h2 = shFeatures[1][localPos.y + 1][localPos.x + 2];
+	float4 i2 = shFeatures[1][localPos.y + 2][localPos.x + 2];
 
 	float4 na2 = max(-a2, 0);
 	float4 nb2 = max(-b2, 0);
@@ -604,38 +646,54 @@ void Pass4(uint2 blockStart, uint3 threadId) {
 //!BLOCK_SIZE 8
 //!NUM_THREADS 64
 
+#define SH_SIZE (MP_BLOCK_WIDTH + 2)
+
+groupshared float4 shFeatures[2][SH_SIZE][SH_SIZE];
+
 void Pass5(uint2 blockStart, uint3 threadId) {
-	uint2 gxy = Rmp8x8(threadId.x) + blockStart;
+	float2 inputPt = GetInputPt();
 	uint2 inputSize = GetInputSize();
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE * SH_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE, k / SH_SIZE);
+		const float2 tpos = (blockStart + shPos - 0.5f) * inputPt;
+		shFeatures[0][shPos.y][shPos.x] = tex3.SampleLevel(sam, tpos, 0);
+		shFeatures[1][shPos.y][shPos.x] = tex4.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 localPos = Rmp8x8(threadId.x);
+	const uint2 gxy = localPos + blockStart;
 	if (!CheckViewport(gxy)) {
 		return;
 	}
 
-	float2 inputPt = GetInputPt();
-	float2 pos = (gxy + 0.5f) * inputPt;
+	const float2 pos = (gxy + 0.5f) * inputPt;
 
 	// [ a, d, g ]
 	// [ b, e, h ]
 	// [ c, f, i ]
-	float4 a1 = tex3.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b1 = tex3.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c1 = tex3.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d1 = tex3.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e1 = tex3.SampleLevel(sam, pos, 0);
-	float4 f1 = tex3.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g1 = tex3.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h1 = tex3.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i1 = tex3.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
-
-	float4 a2 = tex4.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b2 = tex4.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c2 = tex4.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d2 = tex4.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e2 = tex4.SampleLevel(sam, pos, 0);
-	float4 f2 = tex4.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g2 = tex4.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h2 = tex4.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i2 = tex4.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a1 = shFeatures[0][localPos.y][localPos.x];
+	float4 b1 = shFeatures[0][localPos.y + 1][localPos.x];
+	float4 c1 = shFeatures[0][localPos.y + 2][localPos.x];
+	float4 d1 = shFeatures[0][localPos.y][localPos.x + 1];
+	float4 e1 = shFeatures[0][localPos.y + 1][localPos.x + 1];
+	float4 f1 = shFeatures[0][localPos.y + 2][localPos.x + 1];
+	float4 g1 = shFeatures[0][localPos.y][localPos.x + 2];
+	float4 h1 = shFeatures[0][localPos.y + 1][localPos.x + 2];
+	float4 i1 = shFeatures[0][localPos.y + 2][localPos.x + 2];
+
+	float4 a2 = shFeatures[1][localPos.y][localPos.x];
+	float4 b2 = shFeatures[1][localPos.y + 1][localPos.x];
+	float4 c2 = shFeatures[1][localPos.y + 2][localPos.x];
+	float4 d2 = shFeatures[1][localPos.y][localPos.x + 1];
+	float4 e2 = shFeatures[1][localPos.y + 1][localPos.x + 1];
+	float4 f2 = shFeatures[1][localPos.y + 2][localPos.x + 1];
+	float4 g2 = shFeatures[1][localPos.y][localPos.x + 2];
+	float4 h2 = shFeatures[1][localPos.y + 1][localPos.x + 2];
+	float4 i2 = shFeatures[1][localPos.y + 2][localPos.x + 2];
 
 	float4 result = mul(max(a1, 0), float4x4(-0.01858372, 0.017144108, 0.02794388, 0.0, 0.0129101565, -0.0073674284, -0.011766938, 0.0, 0.01970984, 0.01209068, 0.009530311, 0.0, -0.009190449, -0.006996753, -0.0038750458, 0.0));
 	result += mul(max(b1, 0), float4x4(0.15856947, 0.10162126, 0.08489005, 0.0, 0.038381726, -0.017771017, -0.03226132, 0.0, -0.011787879, -0.0152445, -0.007564454, 0.0, 0.055921376, 0.08389841, 0.08452836, 0.0));
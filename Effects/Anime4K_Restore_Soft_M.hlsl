@@ -497,34 +497,55 @@ void Pass6(uint2 blockStart, uint3 threadId) {
 //!BLOCK_SIZE 8
 //!NUM_THREADS 64
 
+#define SH_SIZE (MP_BLOCK_WIDTH + 2)
+
+groupshared float4 shFeatures[6][SH_SIZE][SH_SIZE];
+
 void Pass7(uint2 blockStart, uint3 threadId) {
-	uint2 gxy = Rmp8x8(threadId.x) + blockStart;
+	float2 inputPt = GetInputPt();
 	uint2 inputSize = GetInputSize();
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE * SH_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE, k / SH_SIZE);
+		const float2 tpos = (blockStart + shPos - 0.5f) * inputPt;
+		shFeatures[0][shPos.y][shPos.x] = tex6.SampleLevel(sam, tpos, 0);
+		shFeatures[1][shPos.y][shPos.x] = tex1.SampleLevel(sam, tpos, 0);
+		shFeatures[2][shPos.y][shPos.x] = tex2.SampleLevel(sam, tpos, 0);
+		shFeatures[3][shPos.y][shPos.x] = tex3.SampleLevel(sam, tpos, 0);
+		shFeatures[4][shPos.y][shPos.x] = tex4.SampleLevel(sam, tpos, 0);
+		shFeatures[5][shPos.y][shPos.x] = tex5.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 localPos = Rmp8x8(threadId.x);
+	const uint2 gxy = localPos + blockStart;
 	if (!CheckViewport(gxy)) {
 		return;
 	}
-	float2 inputPt = GetInputPt();
-	float2 pos = (gxy + 0.5f) * inputPt;
+
+	const float2 pos = (gxy + 0.5f) * inputPt;
 
 	// [ a, d, g ]
 	// [ b, e, h ]
 	// [ c, f, i ]
-	float4 a = tex6.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b = tex6.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c = tex6.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d = tex6.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e = tex6.SampleLevel(sam, pos, 0);
-	float4 f = tex6.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g = tex6.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h = tex6.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i = tex6.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
-
-	float4 src1 = tex1.SampleLevel(sam, pos, 0);
-	float4 src2 = tex2.SampleLevel(sam, pos, 0);
-	float4 src3 = tex3.SampleLevel(sam, pos, 0);
-	float4 src4 = tex4.SampleLevel(sam, pos, 0);
-	float4 src5 = tex5.SampleLevel(sam, pos, 0);
-	float4 src6 = tex6.SampleLevel(sam, pos, 0);
+	float4 a = shFeatures[0][localPos.y][localPos.x];
+	float4 b = shFeatures[0][localPos.y + 1][localPos.x];
+	float4 c = shFeatures[0][localPos.y + 2][localPos.x];
+	float4 d = shFeatures[0][localPos.y][localPos.x + 1];
+	float4 e = shFeatures[0][localPos.y + 1][localPos.x + 1];
+	float4 f = shFeatures[0][localPos.y + 2][localPos.x + 1];
+	float4 g = shFeatures[0][localPos.y][localPos.x + 2];
+	float4 h = shFeatures[0][localPos.y + 1][localPos.x + 2];
+	float4 i = shFeatures[0][localPos.y + 2][localPos.x + 2];
+
+	float4 src1 = shFeatures[1][localPos.y + 1][localPos.x + 1];
+	float4 src2 = shFeatures[2][localPos.y + 1][localPos.x + 1];
+	float4 src3 = shFeatures[3][localPos.y + 1][localPos.x + 1];
+	float4 src4 = shFeatures[4][localPos.y + 1][localPos.x + 1];
+	float4 src5 = shFeatures[5][localPos.y + 1][localPos.x + 1];
+	float4 src6 = shFeatures[0][localPos.y + 1][localPos.x + 1];
 	float3 origin = INPUT.SampleLevel(sam, pos, 0).rgb;
 
 	float4 src7 = mul(max(a, 0), float4x4(-0.35835463, 0.038305778, -0.10198824, -0.021951782, 0.02142098, -0.072417736, -0.2577152, 0.054713376, 0.075116105, -0.21191697, -0.1213158, -0.105036296, 0.12030758, -0.17591658, 0.1726511, 0.17754573));
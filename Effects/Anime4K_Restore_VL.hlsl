@@ -135,28 +135,42 @@ void Pass1(uint2 blockStart, uint3 threadId) {
 //!BLOCK_SIZE 8
 //!NUM_THREADS 64
 
+#define SH_SIZE (MP_BLOCK_WIDTH + 2)
+
+groupshared float4 shFeatures[2][SH_SIZE][SH_SIZE];
+
 void Pass2(uint2 blockStart, uint3 threadId) {
-	uint2 gxy = Rmp8x8(threadId.x) + blockStart;
+	float2 inputPt = GetInputPt();
 	uint2 inputSize = GetInputSize();
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE * SH_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE, k / SH_SIZE);
+		const float2 tpos = (blockStart + shPos - 0.5f) * inputPt;
+		shFeatures[0][shPos.y][shPos.x] = tex1.SampleLevel(sam, tpos, 0);
+		shFeatures[1][shPos.y][shPos.x] = tex2.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 localPos = Rmp8x8(threadId.x);
+	const uint2 gxy = localPos + blockStart;
 	if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
 		return;
 	}
 
-	float2 inputPt = GetInputPt();
-	float2 pos = (gxy + 0.5f) * inputPt;
-
 	// [ a, d, g ]
 	// [ b, e, h ]
 	// [ c, f, i ]
-	float4 a1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y),0);
-	float4 b1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, 0),0);
-	float4 c1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y),0);
-	float4 d1 = tex1.SampleLevel(sam, pos + float2(0, -inputPt.y),0);
-	float4 e1 = tex1.SampleLevel(sam, pos,0);
-	float4 f1 = tex1.SampleLevel(sam, pos + float2(0, inputPt.y),0);
-	float4 g1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y),0);
-	float4 h1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, 0),0);
-	float4 i1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y),0);
+	float4 a1 = shFeatures[0][localPos.y][localPos.x];
+	float4 b1 = shFeatures[0][localPos.y + 1][localPos.x];
+	float4 c1 = shFeatures[0][localPos.y + 2][localPos.x];
+	float4 d1 = shFeatures[0][localPos.y][localPos.x + 1];
+	float4 e1 = shFeatures[0][localPos.y + 1][localPos.x + 1];
+	float4 f1 = shFeatures[0][localPos.y + 2][localPos.x + 1];
+	float4 g1 = shFeatures[0][localPos.y][localPos.x + 2];
+	float4 h1 = shFeatures[0][localPos.y + 1][localPos.x + 2];
+	float4 i1 = shFeatures[0][localPos.y + 2][localPos.x + 2];
 
 	float4 na1 = max(-a1, 0);
 	float4 nb1 = max(-b1, 0);
@@ -178,15 +192,15 @@ void Pass2(uint2 blockStart, uint3 threadId) {
 	h1 = max(h1, 0);
 	i1 = max(i1, 0);
 
-	float4 a2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d2 = tex2.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e2 = tex2.SampleLevel(sam, pos, 0);
-	float4 f2 = tex2.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a2 = shFeatures[1][localPos.y][localPos.x];
+	float4 b2 = shFeatures[1][localPos.y + 1][localPos.x];
+	float4 c2 = shFeatures[1][localPos.y + 2][localPos.x];
+	float4 d2 = shFeatures[1][localPos.y][localPos.x + 1];
+	float4 e2 = shFeatures[1][localPos.y + 1][localPos.x + 1];
+	float4 f2 = shFeatures[1][localPos.y + 2][localPos.x + 1];
+	float4 g2 = shFeatures[1][localPos.y][localPos.x + 2];
+	float4 h2 = shFeatures[1][localPos.y + 1][localPos.x + 2];
+	float4 i2 = shFeatures[1][localPos.y + 2][localPos.x + 2];
 
 	float4 na2 = max(-a2, 0);
 	float4 nb2 = max(-b2, 0);
@@ -296,28 +310,42 @@ void Pass2(uint2 blockStart, uint3 threadId) {
 //!BLOCK_SIZE 8
 //!NUM_THREADS 64
 
+#define SH_SIZE (MP_BLOCK_WIDTH + 2)
+
+groupshared float4 shFeatures[2][SH_SIZE][SH_SIZE];
+
 void Pass3(uint2 blockStart, uint3 threadId) {
-	uint2 gxy = Rmp8x8(threadId.x) + blockStart;
+	float2 inputPt = GetInputPt();
 	uint2 inputSize = GetInputSize();
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE * SH_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE, k / SH_SIZE);
+		const float2 tpos = (blockStart + shPos - 0.5f) * inputPt;
+		shFeatures[0][shPos.y][shPos.x] = tex3.SampleLevel(sam, tpos, 0);
+		shFeatures[1][shPos.y][shPos.x] = tex4.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 localPos = Rmp8x8(threadId.x);
+	const uint2 gxy = localPos + blockStart;
 	if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
 		return;
 	}
 
-	float2 inputPt = GetInputPt();
-	float2 pos = (gxy + 0.5f) * inputPt;
-
 	// [ a, d, g ]
 	// [ b, e, h ]
 	// [ c, f, i ]
-	float4 a1 = tex3.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b1 = tex3.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c1 = tex3.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d1 = tex3.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e1 = tex3.SampleLevel(sam, pos, 0);
-	float4 f1 = tex3.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g1 = tex3.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h1 = tex3.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i1 = tex3.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a1 = shFeatures[0][localPos.y][localPos.x];
+	float4 b1 = shFeatures[0][localPos.y + 1][localPos.x];
+	float4 c1 = shFeatures[0][localPos.y + 2][localPos.x];
+	float4 d1 = shFeatures[0][localPos.y][localPos.x + 1];
+	float4 e1 = shFeatures[0][localPos.y + 1][localPos.x + 1];
+	float4 f1 = shFeatures[0][localPos.y + 2][localPos.x + 1];
+	float4 g1 = shFeatures[0][localPos.y][localPos.x + 2];
+	float4 h1 = shFeatures[0][localPos.y + 1][localPos.x + 2];
+	float4 i1 = shFeatures[0][localPos.y + 2][localPos.x + 2];
 
 	float4 na1 = max(-a1, 0);
 	float4 nb1 = max(-b1, 0);
@@ -339,15 +367,15 @@ void Pass3(uint2 blockStart, uint3 threadId) {
 	h1 = max(h1, 0);
 	i1 = max(i1, 0);
 
-	float4 a2 = tex4.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b2 = tex4.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c2 = tex4.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d2 = tex4.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e2 = tex4.SampleLevel(sam, pos, 0);
-	float4 f2 = tex4.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g2 = tex4.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h2 = tex4.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i2 = tex4.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a2 = shFeatures[1][localPos.y][localPos.x];
+	float4 b2 = shFeatures[1][localPos.y + 1][localPos.x];
+	float4 c2 = shFeatures[1][localPos.y + 2][localPos.x];
+	float4 d2 = shFeatures[1][localPos.y][localPos.x + 1];
+	float4 e2 = shFeatures[1][localPos.y + 1][localPos.x + 1];
+	float4 f2 = shFeatures[1][localPos.y + 2][localPos.x + 1];
+	float4 g2 = shFeatures[1][localPos.y][localPos.x + 2];
+	float4 h2 = shFeatures[1][localPos.y + 1][localPos.x + 2];
+	float4 i2 = shFeatures[1][localPos.y + 2][localPos.x + 2];
 
 	float4 na2 = max(-a2, 0);
 	float4 nb2 = max(-b2, 0);
@@ -463,28 +491,43 @@ void Pass3(uint2 blockStart, uint3 threadId) {
 //!BLOCK_SIZE 8
 //!NUM_THREADS 64
 
+#define SH_SIZE (MP_BLOCK_WIDTH + 2)
+
+groupshared float4 shFeatures[3][SH_SIZE][SH_SIZE];
+
 void Pass4(uint2 blockStart, uint3 threadId) {
-	uint2 gxy = Rmp8x8(threadId.x) + blockStart;
+	float2 inputPt = GetInputPt();
 	uint2 inputSize = GetInputSize();
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE * SH_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE, k / SH_SIZE);
+		const float2 tpos = (blockStart + shPos - 0.5f) * inputPt;
+		shFeatures[0][shPos.y][shPos.x] = tex1.SampleLevel(sam, tpos, 0);
+		shFeatures[1][shPos.y][shPos.x] = tex2.SampleLevel(sam, tpos, 0);
+		shFeatures[2][shPos.y][shPos.x] = tex5.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 localPos = Rmp8x8(threadId.x);
+	const uint2 gxy = localPos + blockStart;
 	if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
 		return;
 	}
 
-	float2 inputPt = GetInputPt();
-	float2 pos = (gxy + 0.5f) * inputPt;
-
 	// [ a, d, g ]
 	// [ b, e, h ]
 	// [ c, f, i ]
-	float4 a1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d1 = tex1.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e1 = tex1.SampleLevel(sam, pos, 0);
-	float4 f1 = tex1.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a1 = shFeatures[0][localPos.y][localPos.x];
+	float4 b1 = shFeatures[0][localPos.y + 1][localPos.x];
+	float4 c1 = shFeatures[0][localPos.y + 2][localPos.x];
+	float4 d1 = shFeatures[0][localPos.y][localPos.x + 1];
+	float4 e1 = shFeatures[0][localPos.y + 1][localPos.x + 1];
+	float4 f1 = shFeatures[0][localPos.y + 2][localPos.x + 1];
+	float4 g1 = shFeatures[0][localPos.y][localPos.x + 2];
+	float4 h1 = shFeatures[0][localPos.y + 1][localPos.x + 2];
+	float4 i1 = shFeatures[0][localPos.y + 2][localPos.x + 2];
 
 	float4 na1 = max(-a1, 0);
 	float4 nb1 = max(-b1, 0);
@@ -506,15 +549,15 @@ void Pass4(uint2 blockStart, uint3 threadId) {
 	h1 = max(h1, 0);
 	i1 = max(i1, 0);
 
-	float4 a2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d2 = tex2.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e2 = tex2.SampleLevel(sam, pos, 0);
-	float4 f2 = tex2.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a2 = shFeatures[1][localPos.y][localPos.x];
+	float4 b2 = shFeatures[1][localPos.y + 1][localPos.x];
+	float4 c2 = shFeatures[1][localPos.y + 2][localPos.x];
+	float4 d2 = shFeatures[1][localPos.y][localPos.x + 1];
+	float4 e2 = shFeatures[1][localPos.y + 1][localPos.x + 1];
+	float4 f2 = shFeatures[1][localPos.y + 2][localPos.x + 1];
+	float4 g2 = shFeatures[1][localPos.y][localPos.x + 2];
+	float4 h2 = shFeatures[1][localPos.y + 1][localPos.x + 2];
+	float4 i2 = shFeatures[1][localPos.y + 2][localPos.x + 2];
 
 	float4 na2 = max(-a2, 0);
 	float4 nb2 = max(-b2, 0);
@@ -612,7 +655,7 @@ void Pass4(uint2 blockStart, uint3 threadId) {
 	target2 += mul(ni2, float4x4(0.030153519, -0.092469186, -0.022912916, 0.10200855, -0.04237032, -0.05917764, 0.10479645, -0.05619482, -0.18949397, -0.019547248, 0.013868889, -0.1524476, 0.14048979, -0.032521486, 0.1322921, 0.070972025));
 	target2 += float4(0.012053958, -4.6962363e-05, 0.0020099226, -0.033494607);
 
-	float4 target3 = tex5.SampleLevel(sam, pos, 0);
+	float4 target3 = shFeatures[2][localPos.y + 1][localPos.x + 1];
 	target3 += mul(e1, float4x4(0.07868885, -0.030913834, -0.009213676, 0.0, 0.04870991, 0.021467991, 0.038739506, 0.0, -0.042969644, -0.07122453, -0.08798675, 0.0, -0.09784122, 0.021434791, 0.02510374, 0.0));
 	target3 += mul(e2, float4x4(0.050420716, 0.0729716, 0.076532185, 0.0, -0.019112485, -0.01037939, -0.026948035, 0.0, -0.02591423, 0.008927897, -0.00042541025, 0.0, 0.1043701, -0.0071186824, -0.041817162, 0.0));
 	target3 += mul(ne1, float4x4(-0.16143242, -0.0009298223, -0.01228508, 0.0, 0.07744052, -0.018313263, -0.0488145, 0.0, 0.09241393, 0.07128674, 0.055164956, 0.0, 0.054884013, -0.04834418, -0.06281626, 0.0));
@@ -631,28 +674,43 @@ void Pass4(uint2 blockStart, uint3 threadId) {
 //!BLOCK_SIZE 8
 //!NUM_THREADS 64
 
+#define SH_SIZE (MP_BLOCK_WIDTH + 2)
+
+groupshared float4 shFeatures[3][SH_SIZE][SH_SIZE];
+
 void Pass5(uint2 blockStart, uint3 threadId) {
-	uint2 gxy = Rmp8x8(threadId.x) + blockStart;
+	float2 inputPt = GetInputPt();
 	uint2 inputSize = GetInputSize();
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE * SH_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE, k / SH_SIZE);
+		const float2 tpos = (blockStart + shPos - 0.5f) * inputPt;
+		shFeatures[0][shPos.y][shPos.x] = tex3.SampleLevel(sam, tpos, 0);
+		shFeatures[1][shPos.y][shPos.x] = tex4.SampleLevel(sam, tpos, 0);
+		shFeatures[2][shPos.y][shPos.x] = tex6.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 localPos = Rmp8x8(threadId.x);
+	const uint2 gxy = localPos + blockStart;
 	if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
 		return;
 	}
 
-	float2 inputPt = GetInputPt();
-	float2 pos = (gxy + 0.5f) * inputPt;
-
 	// [ a, d, g ]
 	// [ b, e, h ]
 	// [ c, f, i ]
-	float4 a1 = tex3.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b1 = tex3.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c1 = tex3.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d1 = tex3.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e1 = tex3.SampleLevel(sam, pos, 0);
-	float4 f1 = tex3.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g1 = tex3.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h1 = tex3.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i1 = tex3.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a1 = shFeatures[0][localPos.y][localPos.x];
+	float4 b1 = shFeatures[0][localPos.y + 1][localPos.x];
+	float4 c1 = shFeatures[0][localPos.y + 2][localPos.x];
+	float4 d1 = shFeatures[0][localPos.y][localPos.x + 1];
+	float4 e1 = shFeatures[0][localPos.y + 1][localPos.x + 1];
+	float4 f1 = shFeatures[0][localPos.y + 2][localPos.x + 1];
+	float4 g1 = shFeatures[0][localPos.y][localPos.x + 2];
+	float4 h1 = shFeatures[0][localPos.y + 1][localPos.x + 2];
+	float4 i1 = shFeatures[0][localPos.y + 2][localPos.x + 2];
 
 	float4 na1 = max(-a1, 0);
 	float4 nb1 = max(-b1, 0);
@@ -674,15 +732,15 @@ void Pass5(uint2 blockStart, uint3 threadId) {
 	h1 = max(h1, 0);
 	i1 = max(i1, 0);
 
-	float4 a2 = tex4.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b2 = tex4.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c2 = tex4.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d2 = tex4.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e2 = tex4.SampleLevel(sam, pos, 0);
-	float4 f2 = tex4.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g2 = tex4.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h2 = tex4.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i2 = tex4.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a2 = shFeatures[1][localPos.y][localPos.x];
+	float4 b2 = shFeatures[1][localPos.y + 1][localPos.x];
+	float4 c2 = shFeatures[1][localPos.y + 2][localPos.x];
+	float4 d2 = shFeatures[1][localPos.y][localPos.x + 1];
+	float4 e2 = shFeatures[1][localPos.y + 1][localPos.x + 1];
+	float4 f2 = shFeatures[1][localPos.y + 2][localPos.x + 1];
+	float4 g2 = shFeatures[1][localPos.y][localPos.x + 2];
+	float4 h2 = shFeatures[1][localPos.y + 1][localPos.x + 2];
+	float4 i2 = shFeatures[1][localPos.y + 2][localPos.x + 2];
 
 	float4 na2 = max(-a2, 0);
 	float4 nb2 = max(-b2, 0);
@@ -780,7 +838,7 @@ void Pass5(uint2 blockStart, uint3 threadId) {
 	target2 += mul(ni2, float4x4(-0.035496738, 0.010802548, -0.028718363, 0.19263634, 0.16900502, -0.16661702, -0.027631328, 0.18309957, -0.015860107, -0.03309961, -0.091390446, 0.14000848, -0.0036591904, 0.47659522, -0.09373507, -0.29020965));
 	target2 += float4(0.08895955, -0.027667087, 0.20500831, 0.00037762933);
 
-	float4 target3 = tex6.SampleLevel(sam, pos, 0);
+	float4 target3 = shFeatures[2][localPos.y + 1][localPos.x + 1];
 	target3 += mul(e1, float4x4(0.03094887, -0.008734403, 0.00042712069, 0.0, 0.053891554, 0.05837673, 0.06200635, 0.0, 0.09071558, -0.04202184, -0.046172567, 0.0, -0.0425916, 0.04905093, 0.020835675, 0.0));
 	target3 += mul(e2, float4x4(0.096628904, -0.037792254, -0.043241944, 0.0, -0.011923947, -0.025950424, -0.031381752, 0.0, -0.060941868, -0.07859433, -0.07535451, 0.0, -0.026777223, 0.08604982, 0.07829908, 0.0));
 	target3 += mul(ne1, float4x4(-0.06435972, 0.0036599538, 0.00786578, 0.0, -0.061972067, -0.05681472, -0.06667608, 0.0, -0.106890626, 0.007406496, 0.029977169, 0.0, -0.20519382, -0.044860814, 0.0021225857, 0.0));
@@ -799,28 +857,43 @@ void Pass5(uint2 blockStart, uint3 threadId) {
 //!BLOCK_SIZE 8
 //!NUM_THREADS 64
 
+#define SH_SIZE (MP_BLOCK_WIDTH + 2)
+
+groupshared float4 shFeatures[3][SH_SIZE][SH_SIZE];
+
 void Pass6(uint2 blockStart, uint3 threadId) {
-	uint2 gxy = Rmp8x8(threadId.x) + blockStart;
+	float2 inputPt = GetInputPt();
 	uint2 inputSize = GetInputSize();
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE * SH_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE, k / SH_SIZE);
+		const float2 tpos = (blockStart + shPos - 0.5f) * inputPt;
+		shFeatures[0][shPos.y][shPos.x] = tex1.SampleLevel(sam, tpos, 0);
+		shFeatures[1][shPos.y][shPos.x] = tex2.SampleLevel(sam, tpos, 0);
+		shFeatures[2][shPos.y][shPos.x] = tex5.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 localPos = Rmp8x8(threadId.x);
+	const uint2 gxy = localPos + blockStart;
 	if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
 		return;
 	}
 
-	float2 inputPt = GetInputPt();
-	float2 pos = (gxy + 0.5f) * inputPt;
-
 	// [ a, d, g ]
 	// [ b, e, h ]
 	// [ c, f, i ]
-	float4 a1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d1 = tex1.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e1 = tex1.SampleLevel(sam, pos, 0);
-	float4 f1 = tex1.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a1 = shFeatures[0][localPos.y][localPos.x];
+	float4 b1 = shFeatures[0][localPos.y + 1][localPos.x];
+	float4 c1 = shFeatures[0][localPos.y + 2][localPos.x];
+	float4 d1 = shFeatures[0][localPos.y][localPos.x + 1];
+	float4 e1 = shFeatures[0][localPos.y + 1][localPos.x + 1];
+	float4 f1 = shFeatures[0][localPos.y + 2][localPos.x + 1];
+	float4 g1 = shFeatures[0][localPos.y][localPos.x + 2];
+	float4 h1 = shFeatures[0][localPos.y + 1][localPos.x + 2];
+	float4 i1 = shFeatures[0][localPos.y + 2][localPos.x + 2];
 
 	float4 na1 = max(-a1, 0);
 	float4 nb1 = max(-b1, 0);
@@ -842,15 +915,15 @@ void Pass6(uint2 blockStart, uint3 threadId) {
 	h1 = max(h1, 0);
 	i1 = max(i1, 0);
 
-	float4 a2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d2 = tex2.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e2 = tex2.SampleLevel(sam, pos, 0);
-	float4 f2 = tex2.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a2 = shFeatures[1][localPos.y][localPos.x];
+	float4 b2 = shFeatures[1][localPos.y + 1][localPos.x];
+	float4 c2 = shFeatures[1][localPos.y + 2][localPos.x];
+	float4 d2 = shFeatures[1][localPos.y][localPos.x + 1];
+	float4 e2 = shFeatures[1][localPos.y + 1][localPos.x + 1];
+	float4 f2 = shFeatures[1][localPos.y + 2][localPos.x + 1];
+	float4 g2 = shFeatures[1][localPos.y][localPos.x + 2];
+	float4 h2 = shFeatures[1][localPos.y + 1][localPos.x + 2];
+	float4 i2 = shFeatures[1][localPos.y + 2][localPos.x + 2];
 
 	float4 na2 = max(-a2, 0);
 	float4 nb2 = max(-b2, 0);
@@ -948,7 +1021,7 @@ void Pass6(uint2 blockStart, uint3 threadId) {
 	target2 += mul(ni2, float4x4(0.18187882, 0.017893985, 0.17856054, 0.005413129, 0.014147176, 0.15102178, 0.12436294, -0.02176765, -0.16727823, -0.0364111, 0.17074408, 0.12899421, 0.31984514, -0.0072070034, 0.031895883, -0.1991405));
 	target2 += float4(-0.011865144, 0.11717201, -0.13823777, -0.059450272);
 
-	float4 target3 = tex5.SampleLevel(sam, pos, 0);
+	float4 target3 = shFeatures[2][localPos.y + 1][localPos.x + 1];
 	target3 += mul(e1, float4x4(0.003730466, -0.024648283, -0.022169832, 0.0, -0.0062762927, 0.022062732, 0.032966793, 0.0, 0.016349113, 0.017197203, 0.020952817, 0.0, -0.1763789, 0.035497356, 0.053835396, 0.0));
 	target3 += mul(e2, float4x4(0.020886675, -0.07054202, -0.079142675, 0.0, 0.06664387, 0.044960167, 0.042230908, 0.0, -0.095019594, 0.012421141, 0.0142890485, 0.0, 0.056814816, -0.012751135, -0.014684506, 0.0));
 	target3 += mul(ne1, float4x4(0.011765893, 0.0008920681, -0.0018258415, 0.0, -0.010473814, -0.023085753, -0.028783914, 0.0, -0.023034256, -0.0024786016, -0.0052162083, 0.0, 0.1643386, -0.06132718, -0.09289065, 0.0));
@@ -967,28 +1040,43 @@ void Pass6(uint2 blockStart, uint3 threadId) {
 //!BLOCK_SIZE 8
 //!NUM_THREADS 64
 
+#define SH_SIZE (MP_BLOCK_WIDTH + 2)
+
+groupshared float4 shFeatures[3][SH_SIZE][SH_SIZE];
+
 void Pass7(uint2 blockStart, uint3 threadId) {
-	uint2 gxy = Rmp8x8(threadId.x) + blockStart;
+	float2 inputPt = GetInputPt();
 	uint2 inputSize = GetInputSize();
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE * SH_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE, k / SH_SIZE);
+		const float2 tpos = (blockStart + shPos - 0.5f) * inputPt;
+		shFeatures[0][shPos.y][shPos.x] = tex3.SampleLevel(sam, tpos, 0);
+		shFeatures[1][shPos.y][shPos.x] = tex4.SampleLevel(sam, tpos, 0);
+		shFeatures[2][shPos.y][shPos.x] = tex6.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 localPos = Rmp8x8(threadId.x);
+	const uint2 gxy = localPos + blockStart;
 	if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
 		return;
 	}
 
-	float2 inputPt = GetInputPt();
-	float2 pos = (gxy + 0.5f) * inputPt;
-
 	// [ a, d, g ]
 	// [ b, e, h ]
 	// [ c, f, i ]
-	float4 a1 = tex3.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b1 = tex3.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c1 = tex3.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d1 = tex3.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e1 = tex3.SampleLevel(sam, pos, 0);
-	float4 f1 = tex3.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g1 = tex3.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h1 = tex3.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i1 = tex3.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a1 = shFeatures[0][localPos.y][localPos.x];
+	float4 b1 = shFeatures[0][localPos.y + 1][localPos.x];
+	float4 c1 = shFeatures[0][localPos.y + 2][localPos.x];
+	float4 d1 = shFeatures[0][localPos.y][localPos.x + 1];
+	float4 e1 = shFeatures[0][localPos.y + 1][localPos.x + 1];
+	float4 f1 = shFeatures[0][localPos.y + 2][localPos.x + 1];
+	float4 g1 = shFeatures[0][localPos.y][localPos.x + 2];
+	float4 h1 = shFeatures[0][localPos.y + 1][localPos.x + 2];
+	float4 i1 = shFeatures[0][localPos.y + 2][localPos.x + 2];
 
 	float4 na1 = max(-a1, 0);
 	float4 nb1 = max(-b1, 0);
@@ -1010,15 +1098,15 @@ void Pass7(uint2 blockStart, uint3 threadId) {
 	h1 = max(h1, 0);
 	i1 = max(i1, 0);
 
-	float4 a2 = tex4.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b2 = tex4.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c2 = tex4.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d2 = tex4.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e2 = tex4.SampleLevel(sam, pos, 0);
-	float4 f2 = tex4.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g2 = tex4.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h2 = tex4.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i2 = tex4.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a2 = shFeatures[1][localPos.y][localPos.x];
+	float4 b2 = shFeatures[1][localPos.y + 1][localPos.x];
+	float4 c2 = shFeatures[1][localPos.y + 2][localPos.x];
+	float4 d2 = shFeatures[1][localPos.y][localPos.x + 1];
+	float4 e2 = shFeatures[1][localPos.y + 1][localPos.x + 1];
+	float4 f2 = shFeatures[1][localPos.y + 2][localPos.x + 1];
+	float4 g2 = shFeatures[1][localPos.y][localPos.x + 2];
+	float4 h2 = shFeatures[1][localPos.y + 1][localPos.x + 2];
+	float4 i2 = shFeatures[1][localPos.y + 2][localPos.x + 2];
 
 	float4 na2 = max(-a2, 0);
 	float4 nb2 = max(-b2, 0);
@@ -1116,7 +1204,7 @@ void Pass7(uint2 blockStart, uint3 threadId) {
 	target2 += mul(ni2, float4x4(-0.034574904, 0.06755256, 0.09508443, -0.17162292, 0.046379335, 0.2178781, 0.08699012, -0.055380464, -0.2237568, -0.07427848, -0.028395249, -0.3225617, -0.084454566, -0.24776657, 0.254169, 0.13229847));
 	target2 += float4(0.18765923, -0.07697714, 0.028134674, -0.060966115);
 
-	float4 target3 = tex6.SampleLevel(sam, pos, 0);
+	float4 target3 = shFeatures[2][localPos.y + 1][localPos.x + 1];
 	target3 += mul(e1, float4x4(0.030815786, 0.021069322, 0.01812191, 0.0, 0.084839165, -0.0080813095, -0.029270556, 0.0, -0.10456346, 0.062386703, 0.0665605, 0.0, 0.11926609, -0.1104228, -0.13291118, 0.0));
 	target3 += mul(e2, float4x4(-0.07159541, -0.007267032, -0.010134558, 0.0, 0.008234213, 0.045609634, 0.040295456, 0.0, 0.018416971, 0.01308482, 0.014649557, 0.0, 0.035107512, -0.02140815, -0.030279048, 0.0));
 	target3 += mul(ne1, float4x4(0.01918586, 0.03875863, 0.03229402, 0.0, -0.07917104, 0.041135103, 0.057182517, 0.0, 0.08609541, 0.0079662455, 0.004327576, 0.0, -0.14332893, 0.03120354, 0.056732506, 0.0));
@@ -1134,28 +1222,45 @@ void Pass7(uint2 blockStart, uint3 threadId) {
 //!BLOCK_SIZE 8
 //!NUM_THREADS 64
 
+#define SH_SIZE (MP_BLOCK_WIDTH + 2)
+
+groupshared float4 shFeatures[3][SH_SIZE][SH_SIZE];
+
 void Pass8(uint2 blockStart, uint3 threadId) {
-	uint2 gxy = Rmp8x8(threadId.x) + blockStart;
+	float2 inputPt = GetInputPt();
 	uint2 inputSize = GetInputSize();
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE * SH_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE, k / SH_SIZE);
+		const float2 tpos = (blockStart + shPos - 0.5f) * inputPt;
+		shFeatures[0][shPos.y][shPos.x] = tex1.SampleLevel(sam, tpos, 0);
+		shFeatures[1][shPos.y][shPos.x] = tex2.SampleLevel(sam, tpos, 0);
+		shFeatures[2][shPos.y][shPos.x] = tex5.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 localPos = Rmp8x8(threadId.x);
+	const uint2 gxy = localPos + blockStart;
 	if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
 		return;
 	}
 
-	float2 inputPt = GetInputPt();
-	float2 pos = (gxy + 0.5f) * inputPt;
+	const float2 pos = (gxy + 0.5f) * inputPt;
 
 	// [ a, d, g ]
 	// [ b, e, h ]
 	// [ c, f, i ]
-	float4 a1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c1 = tex1.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d1 = tex1.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e1 = tex1.SampleLevel(sam, pos, 0);
-	float4 f1 = tex1.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i1 = tex1.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a1 = shFeatures[0][localPos.y][localPos.x];
+	float4 b1 = shFeatures[0][localPos.y + 1][localPos.x];
+	float4 c1 = shFeatures[0][localPos.y + 2][localPos.x];
+	float4 d1 = shFeatures[0][localPos.y][localPos.x + 1];
+	float4 e1 = shFeatures[0][localPos.y + 1][localPos.x + 1];
+	float4 f1 = shFeatures[0][localPos.y + 2][localPos.x + 1];
+	float4 g1 = shFeatures[0][localPos.y][localPos.x + 2];
+	float4 h1 = shFeatures[0][localPos.y + 1][localPos.x + 2];
+	float4 i1 = shFeatures[0][localPos.y + 2][localPos.x + 2];
 
 	float4 na1 = max(-a1, 0);
 	float4 nb1 = max(-b1, 0);
@@ -1177,15 +1282,15 @@ void Pass8(uint2 blockStart, uint3 threadId) {
 	h1 = max(h1, 0);
 	i1 = max(i1, 0);
 
-	float4 a2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, -inputPt.y), 0);
-	float4 b2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c2 = tex2.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d2 = tex2.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e2 = tex2.SampleLevel(sam, pos, 0);
-	float4 f2 = tex2.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i2 = tex2.SampleLevel(sam, pos + float2(inputPt.x, inputPt.y), 0);
+	float4 a2 = shFeatures[1][localPos.y][localPos.x];
+	float4 b2 = shFeatures[1][localPos.y + 1][localPos.x];
+	float4 c2 = shFeatures[1][localPos.y + 2][localPos.x];
+	float4 d2 = shFeatures[1][localPos.y][localPos.x + 1];
+	float4 e2 = shFeatures[1][localPos.y + 1][localPos.x + 1];
+	float4 f2 = shFeatures[1][localPos.y + 2][localPos.x + 1];
+	float4 g2 = shFeatures[1][localPos.y][localPos.x + 2];
+	float4 h2 = shFeatures[1][localPos.y + 1][localPos.x + 2];
+	float4 i2 = shFeatures[1][localPos.y + 2][localPos.x + 2];
 
 	float4 na2 = max(-a2, 0);
 	float4 nb2 = max(-b2, 0);
@@ -1283,7 +1388,7 @@ void Pass8(uint2 blockStart, uint3 threadId) {
 	target2 += mul(ni2, float4x4(0.20014295, -0.027282396, -0.06317007, 0.04452042, 0.064600386, 0.072222926, -0.33409226, 0.08063831, -0.022607977, 0.1308856, -0.39691743, -0.094889864, -0.1810531, 0.011367248, -0.2531222, -0.22468317));
 	target2 += float4(0.26886886, 0.05874665, 0.10268232, 0.05833081);
 
-	float4 result = tex5.SampleLevel(sam, pos, 0);
+	float4 result = shFeatures[2][localPos.y + 1][localPos.x + 1];
 	result += mul(e1, float4x4(0.037410006, 0.048742272, 0.04348088, 0.0, 0.037719514, 0.030768529, 0.03127472, 0.0, 0.056426726, 0.03066893, 0.016440205, 0.0, -0.010599352, 0.022832409, 0.023211194, 0.0));
 	result += mul(e2, float4x4(-0.005733291, 0.06365659, 0.06663611, 0.0, -0.041917093, -0.016493445, -0.020438088, 0.0, -0.0014357592, -0.0022506563, -0.0045095007, 0.0, 0.029893145, -0.009129354, -0.015173116, 0.0));
 	result += mul(ne1, float4x4(0.013052085, 0.005108175, 0.0025906067, 0.0, -0.021950055, -0.036447693, -0.036141638, 0.0, -0.036296472, 0.0068928464, 0.013102313, 0.0, 0.0060471976, -0.024798103, -0.023548538, 0.0));
@@ -139,28 +139,41 @@ void Pass1(uint2 blockStart, uint3 threadId) {
 //!BLOCK_SIZE 8
 //!NUM_THREADS 64
 
+#define SH_SIZE (MP_BLOCK_WIDTH + 2)
+
+groupshared float4 shFeatures[1][SH_SIZE][SH_SIZE];
+
 void Pass2(uint2 blockStart, uint3 threadId) {
-	uint2 gxy = Rmp8x8(threadId.x) + blockStart;
+	float2 inputPt = GetInputPt();
 	uint2 inputSize = GetInputSize();
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE * SH_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE, k / SH_SIZE);
+		const float2 tpos = (blockStart + shPos - 0.5f) * inputPt;
+		shFeatures[0][shPos.y][shPos.x] = tex1.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 localPos = Rmp8x8(threadId.x);
+	const uint2 gxy = localPos + blockStart;
 	if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
 		return;
 	}
 
-	float2 inputPt = GetInputPt();
-	float2 pos = (gxy + 0.5f) * inputPt;
-
 	// [ a, d, g ]
 	// [ b, e, h ]
 	// [ c, f, i ]
-	float4 a = tex1.SampleLevel(sam, pos - inputPt, 0);
-	float4 b = tex1.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c = tex1.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d = tex1.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e = tex1.SampleLevel(sam, pos, 0);
-	float4 f = tex1.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g = tex1.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h = tex1.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i = tex1.SampleLevel(sam, pos + inputPt, 0);
+	float4 a = shFeatures[0][localPos.y][localPos.x];
+	float4 b = shFeatures[0][localPos.y + 1][localPos.x];
+	float4 c = shFeatures[0][localPos.y + 2][localPos.x];
+	float4 d = shFeatures[0][localPos.y][localPos.x + 1];
+	float4 e = shFeatures[0][localPos.y + 1][localPos.x + 1];
+	float4 f = shFeatures[0][localPos.y + 2][localPos.x + 1];
+	float4 g = shFeatures[0][localPos.y][localPos.x + 2];
+	float4 h = shFeatures[0][localPos.y + 1][localPos.x + 2];
+	float4 i = shFeatures[0][localPos.y + 2][localPos.x + 2];
 
 	float4 na = max(-a, 0);
 	float4 nb = max(-b, 0);
@@ -242,28 +255,42 @@ void Pass2(uint2 blockStart, uint3 threadId) {
 //!BLOCK_SIZE 8
 //!NUM_THREADS 64
 
+#define SH_SIZE (MP_BLOCK_WIDTH + 2)
+
+groupshared float4 shFeatures[2][SH_SIZE][SH_SIZE];
+
 void Pass3(uint2 blockStart, uint3 threadId) {
-	uint2 gxy = Rmp8x8(threadId.x) + blockStart;
+	float2 inputPt = GetInputPt();
 	uint2 inputSize = GetInputSize();
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE * SH_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE, k / SH_SIZE);
+		const float2 tpos = (blockStart + shPos - 0.5f) * inputPt;
+		shFeatures[0][shPos.y][shPos.x] = tex4.SampleLevel(sam, tpos, 0);
+		shFeatures[1][shPos.y][shPos.x] = tex3.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 localPos = Rmp8x8(threadId.x);
+	const uint2 gxy = localPos + blockStart;
 	if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
 		return;
 	}
 
-	float2 inputPt = GetInputPt();
-	float2 pos = (gxy + 0.5f) * inputPt;
-
 	// [ a, d, g ]
 	// [ b, e, h ]
 	// [ c, f, i ]
-	float4 a = tex4.SampleLevel(sam, pos - inputPt, 0);
-	float4 b = tex4.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c = tex4.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d = tex4.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e = tex4.SampleLevel(sam, pos, 0);
-	float4 f = tex4.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g = tex4.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h = tex4.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i = tex4.SampleLevel(sam, pos + inputPt, 0);
+	float4 a = shFeatures[0][localPos.y][localPos.x];
+	float4 b = shFeatures[0][localPos.y + 1][localPos.x];
+	float4 c = shFeatures[0][localPos.y + 2][localPos.x];
+	float4 d = shFeatures[0][localPos.y][localPos.x + 1];
+	float4 e = shFeatures[0][localPos.y + 1][localPos.x + 1];
+	float4 f = shFeatures[0][localPos.y + 2][localPos.x + 1];
+	float4 g = shFeatures[0][localPos.y][localPos.x + 2];
+	float4 h = shFeatures[0][localPos.y + 1][localPos.x + 2];
+	float4 i = shFeatures[0][localPos.y + 2][localPos.x + 2];
 
 	float4 na = max(-a, 0);
 	float4 nb = max(-b, 0);
@@ -325,7 +352,7 @@ void Pass3(uint2 blockStart, uint3 threadId) {
 	target1 += mul(ni, float4x4(-0.010075166, -0.08621876, -0.19569752, 0.1553574, -0.115346536, -0.009765705, -0.37459797, -0.017294222, -0.18065308, 0.052127127, 0.045157496, 0.11466202, 0.036598917, 0.1750653, -0.18558112, 0.13441156));
 	target1 += float4(0.09810561, 0.044599928, -0.0019709724, 0.064204566);
 
-	float4 conv2d_1_tf = tex3.SampleLevel(sam, pos, 0);
+	float4 conv2d_1_tf = shFeatures[1][localPos.y + 1][localPos.x + 1];
 
 	float4 target2 = mul(e, float4x4(0.16594207, 0.47900248, 0.15186168, -0.38448718, -0.33396608, -0.12204449, -0.21397614, 0.22567725, 0.2399077, 0.16945037, 0.072409995, -0.015192162, -0.5004075, -0.10852234, 0.14456534, 0.36797065));
 	target2 += mul(ne, float4x4(-0.03527082, -0.13062008, 0.2529196, 0.16799021, 0.2743078, 0.22924475, 0.4391596, -0.34473032, -0.08008852, 0.14463465, -0.30243787, 0.0352092, 0.49160767, 0.18479864, -0.13473135, -0.40414095));
@@ -349,28 +376,43 @@ void Pass3(uint2 blockStart, uint3 threadId) {
 //!BLOCK_SIZE 8
 //!NUM_THREADS 64
 
+#define SH_SIZE (MP_BLOCK_WIDTH + 2)
+
+groupshared float4 shFeatures[3][SH_SIZE][SH_SIZE];
+
 void Pass4(uint2 blockStart, uint3 threadId) {
-	uint2 gxy = Rmp8x8(threadId.x) + blockStart;
+	float2 inputPt = GetInputPt();
 	uint2 inputSize = GetInputSize();
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE * SH_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE, k / SH_SIZE);
+		const float2 tpos = (blockStart + shPos - 0.5f) * inputPt;
+		shFeatures[0][shPos.y][shPos.x] = tex5.SampleLevel(sam, tpos, 0);
+		shFeatures[1][shPos.y][shPos.x] = tex3.SampleLevel(sam, tpos, 0);
+		shFeatures[2][shPos.y][shPos.x] = tex2.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 localPos = Rmp8x8(threadId.x);
+	const uint2 gxy = localPos + blockStart;
 	if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
 		return;
 	}
 
-	float2 inputPt = GetInputPt();
-	float2 pos = (gxy + 0.5f) * inputPt;
-
 	// [ a, d, g ]
 	// [ b, e, h ]
 	// [ c, f, i ]
-	float4 a = tex5.SampleLevel(sam, pos - inputPt, 0);
-	float4 b = tex5.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c = tex5.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d = tex5.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e = tex5.SampleLevel(sam, pos, 0);
-	float4 f = tex5.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g = tex5.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h = tex5.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i = tex5.SampleLevel(sam, pos + inputPt, 0);
+	float4 a = shFeatures[0][localPos.y][localPos.x];
+	float4 b = shFeatures[0][localPos.y + 1][localPos.x];
+	float4 c = shFeatures[0][localPos.y + 2][localPos.x];
+	float4 d = shFeatures[0][localPos.y][localPos.x + 1];
+	float4 e = shFeatures[0][localPos.y + 1][localPos.x + 1];
+	float4 f = shFeatures[0][localPos.y + 2][localPos.x + 1];
+	float4 g = shFeatures[0][localPos.y][localPos.x + 2];
+	float4 h = shFeatures[0][localPos.y + 1][localPos.x + 2];
+	float4 i = shFeatures[0][localPos.y + 2][localPos.x + 2];
 
 	float4 na = max(-a, 0);
 	float4 nb = max(-b, 0);
@@ -432,8 +474,8 @@ void Pass4(uint2 blockStart, uint3 threadId) {
 	target1 += mul(ni, float4x4(0.0041185757, 0.0843081, 0.07231875, 0.100667596, -0.31684703, -0.2574812, -0.03461963, 0.11267055, -0.22542828, -0.104221806, -0.095156625, -0.08219916, 0.18497708, -0.08431334, -0.074380755, 0.07518058));
 	target1 += float4(0.034884464, 0.055267137, 0.03452981, 0.012002485);
 
-	float4 conv2d_1_tf = tex3.SampleLevel(sam, pos, 0);
-	float4 conv2d_4_tf = tex2.SampleLevel(sam, pos, 0);
+	float4 conv2d_1_tf = shFeatures[1][localPos.y + 1][localPos.x + 1];
+	float4 conv2d_4_tf = shFeatures[2][localPos.y + 1][localPos.x + 1];
 
 	float4 target2 = mul(e, float4x4(0.09644354, -0.12061228, -0.15139145, 0.010084075, 0.19283041, -0.15289722, 0.0028078665, 0.15971705, -0.03884288, -0.06906346, -0.04772131, 0.32280502, -0.42069855, 0.21643022, -0.8389786, -0.50325495));
 	target2 += mul(ne, float4x4(0.18034904, 0.037142154, 0.41413367, 0.08413125, -0.14397736, -0.4820656, 0.32794252, 0.2589487, 0.46948192, 0.26964813, -0.07420985, -0.16767345, 0.086358115, -0.10306444, 0.36070088, 0.1681583));
@@ -459,28 +501,44 @@ void Pass4(uint2 blockStart, uint3 threadId) {
 //!BLOCK_SIZE 8
 //!NUM_THREADS 64
 
+#define SH_SIZE (MP_BLOCK_WIDTH + 2)
+
+groupshared float4 shFeatures[4][SH_SIZE][SH_SIZE];
+
 void Pass5(uint2 blockStart, uint3 threadId) {
-	uint2 gxy = Rmp8x8(threadId.x) + blockStart;
+	float2 inputPt = GetInputPt();
 	uint2 inputSize = GetInputSize();
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE * SH_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE, k / SH_SIZE);
+		const float2 tpos = (blockStart + shPos - 0.5f) * inputPt;
+		shFeatures[0][shPos.y][shPos.x] = tex6.SampleLevel(sam, tpos, 0);
+		shFeatures[1][shPos.y][shPos.x] = tex3.SampleLevel(sam, tpos, 0);
+		shFeatures[2][shPos.y][shPos.x] = tex2.SampleLevel(sam, tpos, 0);
+		shFeatures[3][shPos.y][shPos.x] = tex4.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 localPos = Rmp8x8(threadId.x);
+	const uint2 gxy = localPos + blockStart;
 	if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
 		return;
 	}
 
-	float2 inputPt = GetInputPt();
-	float2 pos = (gxy + 0.5f) * inputPt;
-
 	// [ a, d, g ]
 	// [ b, e, h ]
 	// [ c, f, i ]
-	float4 a = tex6.SampleLevel(sam, pos - inputPt, 0);
-	float4 b = tex6.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c = tex6.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d = tex6.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e = tex6.SampleLevel(sam, pos, 0);
-	float4 f = tex6.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g = tex6.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h = tex6.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i = tex6.SampleLevel(sam, pos + inputPt, 0);
+	float4 a = shFeatures[0][localPos.y][localPos.x];
+	float4 b = shFeatures[0][localPos.y + 1][localPos.x];
+	float4 c = shFeatures[0][localPos.y + 2][localPos.x];
+	float4 d = shFeatures[0][localPos.y][localPos.x + 1];
+	float4 e = shFeatures[0][localPos.y + 1][localPos.x + 1];
+	float4 f = shFeatures[0][localPos.y + 2][localPos.x + 1];
+	float4 g = shFeatures[0][localPos.y][localPos.x + 2];
+	float4 h = shFeatures[0][localPos.y + 1][localPos.x + 2];
+	float4 i = shFeatures[0][localPos.y + 2][localPos.x + 2];
 
 	float4 na = max(-a, 0);
 	float4 nb = max(-b, 0);
@@ -542,9 +600,9 @@ void Pass5(uint2 blockStart, uint3 threadId) {
 	target2 += mul(ni, float4x4(0.15082799, -0.1990422, -0.07347236, 0.106623515, -0.054368034, -0.10389193, -0.0711653, -0.022524087, -0.056636613, -0.07881972, 0.09727487, -0.16494693, 0.13156064, 0.176482, 0.11008391, 0.16038191));
 	target2 += float4(-0.0891901, 0.05071113, -0.026449949, -0.0051819966);
 
-	float4 conv2d_1_tf = tex3.SampleLevel(sam, pos, 0);
-	float4 conv2d_4_tf = tex2.SampleLevel(sam, pos, 0);
-	float4 conv2d_7_tf = tex4.SampleLevel(sam, pos, 0);
+	float4 conv2d_1_tf = shFeatures[1][localPos.y + 1][localPos.x + 1];
+	float4 conv2d_4_tf = shFeatures[2][localPos.y + 1][localPos.x + 1];
+	float4 conv2d_7_tf = shFeatures[3][localPos.y + 1][localPos.x + 1];
 
 	float4 target3 = mul(e, float4x4(-0.2967133, -0.18581349, -0.03749059, 0.30880052, -0.11064016, -0.23309472, 0.05572459, 0.04502667, -0.12098995, 0.1875494, 0.17095889, 0.008563628, -0.16092524, 0.03845401, 0.1908294, 0.10556762));
 	target3 += mul(ne, float4x4(0.23697758, 0.11629349, 0.19466121, -0.41413772, -0.20402254, 0.0062864223, -0.13700421, -0.10543815, -0.03498975, 0.02710536, -0.32383642, 0.12299909, -0.06849518, -0.005379719, 0.15714374, -0.15514039));
@@ -573,28 +631,46 @@ void Pass5(uint2 blockStart, uint3 threadId) {
 //!BLOCK_SIZE 8
 //!NUM_THREADS 64
 
+#define SH_SIZE (MP_BLOCK_WIDTH + 2)
+
+groupshared float4 shFeatures[6][SH_SIZE][SH_SIZE];
+
 void Pass6(uint2 blockStart, uint3 threadId) {
-	uint2 gxy = Rmp8x8(threadId.x) + blockStart;
+	float2 inputPt = GetInputPt();
 	uint2 inputSize = GetInputSize();
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE * SH_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE, k / SH_SIZE);
+		const float2 tpos = (blockStart + shPos - 0.5f) * inputPt;
+		shFeatures[0][shPos.y][shPos.x] = tex7.SampleLevel(sam, tpos, 0);
+		shFeatures[1][shPos.y][shPos.x] = tex1.SampleLevel(sam, tpos, 0);
+		shFeatures[2][shPos.y][shPos.x] = tex3.SampleLevel(sam, tpos, 0);
+		shFeatures[3][shPos.y][shPos.x] = tex2.SampleLevel(sam, tpos, 0);
+		shFeatures[4][shPos.y][shPos.x] = tex4.SampleLevel(sam, tpos, 0);
+		shFeatures[5][shPos.y][shPos.x] = tex5.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 localPos = Rmp8x8(threadId.x);
+	const uint2 gxy = localPos + blockStart;
 	if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
 		return;
 	}
 
-	float2 inputPt = GetInputPt();
-	float2 pos = (gxy + 0.5f) * inputPt;
-
 	// [ a, d, g ]
 	// [ b, e, h ]
 	// [ c, f, i ]
-	float4 a = tex7.SampleLevel(sam, pos - inputPt, 0);
-	float4 b = tex7.SampleLevel(sam, pos + float2(-inputPt.x, 0), 0);
-	float4 c = tex7.SampleLevel(sam, pos + float2(-inputPt.x, inputPt.y), 0);
-	float4 d = tex7.SampleLevel(sam, pos + float2(0, -inputPt.y), 0);
-	float4 e = tex7.SampleLevel(sam, pos, 0);
-	float4 f = tex7.SampleLevel(sam, pos + float2(0, inputPt.y), 0);
-	float4 g = tex7.SampleLevel(sam, pos + float2(inputPt.x, -inputPt.y), 0);
-	float4 h = tex7.SampleLevel(sam, pos + float2(inputPt.x, 0), 0);
-	float4 i = tex7.SampleLevel(sam, pos + inputPt, 0);
+	float4 a = shFeatures[0][localPos.y][localPos.x];
+	float4 b = shFeatures[0][localPos.y + 1][localPos.x];
+	float4 c = shFeatures[0][localPos.y + 2][localPos.x];
+	float4 d = shFeatures[0][localPos.y][localPos.x + 1];
+	float4 e = shFeatures[0][localPos.y + 1][localPos.x + 1];
+	float4 f = shFeatures[0][localPos.y + 2][localPos.x + 1];
+	float4 g = shFeatures[0][localPos.y][localPos.x + 2];
+	float4 h = shFeatures[0][localPos.y + 1][localPos.x + 2];
+	float4 i = shFeatures[0][localPos.y + 2][localPos.x + 2];
 
 	float4 na = max(-a, 0);
 	float4 nb = max(-b, 0);
@@ -636,11 +712,11 @@ void Pass6(uint2 blockStart, uint3 threadId) {
 	conv2d_13_tf += mul(ni, float4x4(-0.1459836, -0.092159286, 0.05037609, 0.07709965, -0.18563168, -0.017586546, -0.16244653, -0.017426869, -0.20880185, -0.26068223, 0.037480514, 0.056800563, 0.14884543, 0.13592677, -0.1492276, 0.023280073));
 	conv2d_13_tf += float4(-0.03207076, 0.045260444, 0.040100798, -0.014172305);
 
-	float4 conv2d_11_tf = tex1.SampleLevel(sam, pos, 0);
-	float4 conv2d_1_tf = tex3.SampleLevel(sam, pos, 0);
-	float4 conv2d_4_tf = tex2.SampleLevel(sam, pos, 0);
-	float4 conv2d_7_tf = tex4.SampleLevel(sam, pos, 0);
-	float4 conv2d_10_tf = tex5.SampleLevel(sam, pos, 0);
+	float4 conv2d_11_tf = shFeatures[1][localPos.y + 1][localPos.x + 1];
+	float4 conv2d_1_tf = shFeatures[2][localPos.y + 1][localPos.x + 1];
+	float4 conv2d_4_tf = shFeatures[3][localPos.y + 1][localPos.x + 1];
+	float4 conv2d_7_tf = shFeatures[4][localPos.y + 1][localPos.x + 1];
+	float4 conv2d_10_tf = shFeatures[5][localPos.y + 1][localPos.x + 1];
 
 	float4 n_conv2d_11_tf = max(-conv2d_11_tf, 0);
 	float4 n_conv2d_1_tf = max(-conv2d_1_tf, 0);
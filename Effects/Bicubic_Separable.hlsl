@@ -0,0 +1,166 @@
+// Bicubic 插值算法的可分离实现
+// 先水平再垂直缩放，每个方向只需 4 个抽头
+// 参数 B 和 C 可以在运行时修改，因此权重在着色器中计算而不是预先计算在纹理中
+
+//!MAGPIE EFFECT
+//!VERSION 2
+
+
+//!PARAMETER
+//!DEFAULT 0.333333
+//!MIN 0
+//!MAX 1
+
+float paramB;
+
+//!PARAMETER
+//!DEFAULT 0.333333
+//!MIN 0
+//!MAX 1
+
+float paramC;
+
+//!TEXTURE
+Texture2D INPUT;
+
+//!TEXTURE
+//!WIDTH OUTPUT_WIDTH
+//!HEIGHT INPUT_HEIGHT
+//!FORMAT R32G32B32A32_FLOAT
+Texture2D tex1;
+
+
+//!COMMON
+
+float weight(float x) {
+	const float B = paramB;
+	const float C = paramC;
+
+	float ax = abs(x);
+
+	if (ax < 1.0) {
+		return (x * x * ((12.0 - 9.0 * B - 6.0 * C) * ax + (-18.0 + 12.0 * B + 6.0 * C)) + (6.0 - 2.0 * B)) / 6.0;
+	} else if (ax >= 1.0 && ax < 2.0) {
+		return (x * x * ((-B - 6.0 * C) * ax + (6.0 * B + 30.0 * C)) + (-12.0 * B - 48.0 * C) * ax + (8.0 * B + 24.0 * C)) / 6.0;
+	} else {
+		return 0.0;
+	}
+}
+
+float4 weight4(float f) {
+	float4 w = float4(weight(f + 1.0), weight(f), weight(f - 1.0), weight(f - 2.0));
+	// make sure all taps added together is exactly 1.0, otherwise some (very small) distortion can occur
+	return w / (w.x + w.y + w.z + w.w);
+}
+
+
+//!PASS 1
+//!DESC Horizontal
+//!IN INPUT
+//!OUT tex1
+//!BLOCK_SIZE 32,8
+//!NUM_THREADS 32,8
+
+#define SH_WIDTH (MP_BLOCK_WIDTH + 4)
+
+groupshared float3 shSrc[MP_BLOCK_HEIGHT][SH_WIDTH];
+
+void Pass1(uint2 blockStart, uint3 threadId) {
+	const uint2 inputSize = GetInputSize();
+	const uint2 outputSize = GetOutputSize();
+	const float scale = (float)inputSize.x / outputSize.x;
+
+	// 区块需要的源像素范围
+	const int spanStart = (int)floor((blockStart.x + 0.5f) * scale - 0.5f) - 1;
+	const int spanEnd = (int)floor((blockStart.x + MP_BLOCK_WIDTH - 0.5f) * scale - 0.5f) + 2;
+	// 缩小时需要的源像素可能超出共享内存，此时直接读取 INPUT
+	const bool useShared = spanEnd - spanStart < SH_WIDTH;
+
+	// 协作加载源像素，每个纹素只读取一次
+	const int y = min(blockStart.y + threadId.y, inputSize.y - 1);
+	for (uint i = threadId.x; i < SH_WIDTH; i += MP_NUM_THREADS_X) {
+		const int x = clamp(spanStart + (int)i, 0, (int)inputSize.x - 1);
+		shSrc[threadId.y][i] = INPUT.Load(int3(x, y, 0)).rgb;
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 gxy = blockStart + threadId.xy;
+	if (gxy.x >= outputSize.x || gxy.y >= inputSize.y) {
+		return;
+	}
+
+	const float pos = (gxy.x + 0.5f) * scale - 0.5f;
+	const float c = floor(pos);
+
+	const float4 weights = weight4(pos - c);
+
+	float3 color = 0;
+	[unroll]
+	for (int j = 0; j < 4; ++j) {
+		const int x = (int)c - 1 + j;
+		float3 src;
+		if (useShared) {
+			src = shSrc[threadId.y][x - spanStart];
+		} else {
+			src = INPUT.Load(int3(clamp(x, 0, (int)inputSize.x - 1), y, 0)).rgb;
+		}
+		color += src * weights[j];
+	}
+
+	tex1[gxy] = float4(color, 1);
+}
+
+
+//!PASS 2
+//!DESC Vertical
+//!IN tex1
+//!BLOCK_SIZE 16,16
+//!NUM_THREADS 16,16
+
+#define SH_HEIGHT (MP_BLOCK_HEIGHT + 4)
+
+groupshared float3 shSrc[SH_HEIGHT][MP_BLOCK_WIDTH];
+
+void Pass2(uint2 blockStart, uint3 threadId) {
+	const uint2 inputSize = GetInputSize();
+	const uint2 outputSize = GetOutputSize();
+	const float scale = (float)inputSize.y / outputSize.y;
+
+	const int spanStart = (int)floor((blockStart.y + 0.5f) * scale - 0.5f) - 1;
+	const int spanEnd = (int)floor((blockStart.y + MP_BLOCK_HEIGHT - 0.5f) * scale - 0.5f) + 2;
+	const bool useShared = spanEnd - spanStart < SH_HEIGHT;
+
+	const int x = min(blockStart.x + threadId.x, outputSize.x - 1);
+	for (uint i = threadId.y; i < SH_HEIGHT; i += MP_NUM_THREADS_Y) {
+		const int y = clamp(spanStart + (int)i, 0, (int)inputSize.y - 1);
+		shSrc[i][threadId.x] = tex1.Load(int3(x, y, 0)).rgb;
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 gxy = blockStart + threadId.xy;
+	if (!CheckViewport(gxy)) {
+		return;
+	}
+
+	const float pos = (gxy.y + 0.5f) * scale - 0.5f;
+	const float c = floor(pos);
+
+	const float4 weights = weight4(pos - c);
+
+	float3 color = 0;
+	[unroll]
+	for (int j = 0; j < 4; ++j) {
+		const int y = (int)c - 1 + j;
+		float3 src;
+		if (useShared) {
+			src = shSrc[y - spanStart][threadId.x];
+		} else {
+			src = tex1.Load(int3(x, clamp(y, 0, (int)inputSize.y - 1), 0)).rgb;
+		}
+		color += src * weights[j];
+	}
+
+	WriteToOutput(gxy, color);
+}
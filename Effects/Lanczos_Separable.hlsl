@@ -0,0 +1,179 @@
+// Lanczos6 插值算法的可分离实现
+// 先水平再垂直缩放，每个方向只需 6 个抽头。权重预先计算在 Lanczos_Separable_Weights.dds 中，
+// 由 tools/ScalerLutGenerator 生成
+// 和 Lanczos.hlsl 一样使用中心 2x2 个源像素抗振铃，两者的结果只有舍入误差
+
+//!MAGPIE EFFECT
+//!VERSION 2
+
+
+//!PARAMETER
+//!DEFAULT 0.5
+//!MIN 0
+//!MAX 1
+float ARStrength;
+
+//!TEXTURE
+Texture2D INPUT;
+
+//!TEXTURE
+//!SOURCE Lanczos_Separable_Weights.dds
+//!FORMAT R32G32B32A32_FLOAT
+Texture2D lut;
+
+//!TEXTURE
+//!WIDTH OUTPUT_WIDTH
+//!HEIGHT INPUT_HEIGHT
+//!FORMAT R32G32B32A32_FLOAT
+Texture2D tex1;
+
+//!SAMPLER
+//!FILTER LINEAR
+SamplerState sam;
+
+
+//!COMMON
+
+// 权重表的相位数，有 PHASES + 1 行，每行两个纹素保存 6 个权重
+#define PHASES 256
+
+void LoadWeights(float f, out float weights[6]) {
+	// 在相邻的两个相位之间线性插值
+	const float v = (f * PHASES + 0.5f) / (PHASES + 1);
+	const float4 w0 = lut.SampleLevel(sam, float2(0.25f, v), 0);
+	const float4 w1 = lut.SampleLevel(sam, float2(0.75f, v), 0);
+	weights[0] = w0.x;
+	weights[1] = w0.y;
+	weights[2] = w0.z;
+	weights[3] = w0.w;
+	weights[4] = w1.x;
+	weights[5] = w1.y;
+}
+
+
+//!PASS 1
+//!DESC Horizontal
+//!IN INPUT, lut
+//!OUT tex1
+//!BLOCK_SIZE 32,8
+//!NUM_THREADS 32,8
+
+#define SH_WIDTH (MP_BLOCK_WIDTH + 8)
+
+groupshared float3 shSrc[MP_BLOCK_HEIGHT][SH_WIDTH];
+
+void Pass1(uint2 blockStart, uint3 threadId) {
+	const uint2 inputSize = GetInputSize();
+	const uint2 outputSize = GetOutputSize();
+	const float scale = (float)inputSize.x / outputSize.x;
+
+	// 区块需要的源像素范围
+	const int spanStart = (int)floor((blockStart.x + 0.5f) * scale - 0.5f) - 2;
+	const int spanEnd = (int)floor((blockStart.x + MP_BLOCK_WIDTH - 0.5f) * scale - 0.5f) + 3;
+	// 缩小时需要的源像素可能超出共享内存，此时直接读取 INPUT
+	const bool useShared = spanEnd - spanStart < SH_WIDTH;
+
+	// 协作加载源像素，每个纹素只读取一次
+	const int y = min(blockStart.y + threadId.y, inputSize.y - 1);
+	for (uint i = threadId.x; i < SH_WIDTH; i += MP_NUM_THREADS_X) {
+		const int x = clamp(spanStart + (int)i, 0, (int)inputSize.x - 1);
+		shSrc[threadId.y][i] = INPUT.Load(int3(x, y, 0)).rgb;
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 gxy = blockStart + threadId.xy;
+	if (gxy.x >= outputSize.x || gxy.y >= inputSize.y) {
+		return;
+	}
+
+	const float pos = (gxy.x + 0.5f) * scale - 0.5f;
+	const float c = floor(pos);
+
+	float weights[6];
+	LoadWeights(pos - c, weights);
+
+	// 抗振铃需要二维的邻域，在第二个通道中进行
+	float3 color = 0;
+	[unroll]
+	for (int j = 0; j < 6; ++j) {
+		const int x = (int)c - 2 + j;
+		float3 src;
+		if (useShared) {
+			src = shSrc[threadId.y][x - spanStart];
+		} else {
+			src = INPUT.Load(int3(clamp(x, 0, (int)inputSize.x - 1), y, 0)).rgb;
+		}
+		color += src * weights[j];
+	}
+
+	tex1[gxy] = float4(color, 1);
+}
+
+
+//!PASS 2
+//!DESC Vertical
+//!IN INPUT, tex1, lut
+//!BLOCK_SIZE 16,16
+//!NUM_THREADS 16,16
+
+#define SH_HEIGHT (MP_BLOCK_HEIGHT + 8)
+
+groupshared float3 shSrc[SH_HEIGHT][MP_BLOCK_WIDTH];
+
+void Pass2(uint2 blockStart, uint3 threadId) {
+	const uint2 inputSize = GetInputSize();
+	const uint2 outputSize = GetOutputSize();
+	const float scale = (float)inputSize.y / outputSize.y;
+
+	const int spanStart = (int)floor((blockStart.y + 0.5f) * scale - 0.5f) - 2;
+	const int spanEnd = (int)floor((blockStart.y + MP_BLOCK_HEIGHT - 0.5f) * scale - 0.5f) + 3;
+	const bool useShared = spanEnd - spanStart < SH_HEIGHT;
+
+	const int x = min(blockStart.x + threadId.x, outputSize.x - 1);
+	for (uint i = threadId.y; i < SH_HEIGHT; i += MP_NUM_THREADS_Y) {
+		const int y = clamp(spanStart + (int)i, 0, (int)inputSize.y - 1);
+		shSrc[i][threadId.x] = tex1.Load(int3(x, y, 0)).rgb;
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint2 gxy = blockStart + threadId.xy;
+	if (!CheckViewport(gxy)) {
+		return;
+	}
+
+	const float pos = (gxy.y + 0.5f) * scale - 0.5f;
+	const float c = floor(pos);
+
+	float weights[6];
+	LoadWeights(pos - c, weights);
+
+	float3 color = 0;
+	[unroll]
+	for (int j = 0; j < 6; ++j) {
+		const int y = (int)c - 2 + j;
+		float3 src;
+		if (useShared) {
+			src = shSrc[y - spanStart][threadId.x];
+		} else {
+			src = tex1.Load(int3(x, clamp(y, 0, (int)inputSize.y - 1), 0)).rgb;
+		}
+		color += src * weights[j];
+	}
+
+	// 抗振铃，和 Lanczos.hlsl 相同，使用离采样点最近的 2x2 个源像素
+	// 和第一个通道的计算方式相同
+	const int2 p = int2(floor((gxy.x + 0.5f) * ((float)inputSize.x / outputSize.x) - 0.5f), c);
+	const int2 p0 = clamp(p, 0, (int2)inputSize - 1);
+	const int2 p1 = clamp(p + 1, 0, (int2)inputSize - 1);
+	const float3 s00 = INPUT.Load(int3(p0, 0)).rgb;
+	const float3 s10 = INPUT.Load(int3(p1.x, p0.y, 0)).rgb;
+	const float3 s01 = INPUT.Load(int3(p0.x, p1.y, 0)).rgb;
+	const float3 s11 = INPUT.Load(int3(p1, 0)).rgb;
+	const float3 minSample = min(min(s00, s10), min(s01, s11));
+	const float3 maxSample = max(max(s00, s10), max(s01, s11));
+	color = lerp(color, clamp(color, minSample, maxSample), ARStrength);
+
+	WriteToOutput(gxy, color);
+}
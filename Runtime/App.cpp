@@ -5,6 +5,7 @@
 #include "GDIFrameSource.h"
 #include "DwmSharedSurfaceFrameSource.h"
 #include "DesktopDuplicationFrameSource.h"
+#include "ReplayFrameSource.h"
 #include "ExclModeHack.h"
 #include "Renderer.h"
 #include "DeviceResources.h"
@@ -13,7 +14,13 @@
 #include "CursorManager.h"
 #include "Config.h"
 #include "StrUtils.h"
+#include "FrameStatistics.h"
+#include "EffectCacheManager.h"
+#include "EffectDrawer.h"
 #include "WindowsMessages.h"
+#include "BatchProcessor.h"
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 
 
 static constexpr const wchar_t* HOST_WINDOW_CLASS_NAME = L"Window_Magpie_967EB565-6F73-4E94-AE53-00CC42592A22";
@@ -37,6 +44,8 @@ bool App::Initialize(HINSTANCE hInst) {
 
 	_RegisterWndClasses();
 
+	_frameStatistics.reset(new FrameStatistics());
+
 	Logger::Get().Info("App 初始化成功");
 	return true;
 }
@@ -52,11 +61,20 @@ bool App::Run(
 	const RECT& cropBorders,
 	UINT flags
 ) {
+	if (!_BeginSession()) {
+		Logger::Get().Error("已有缩放、基准测试或批处理正在执行");
+		return false;
+	}
+	Utils::ScopeExit se([this]() {
+		_isSessionActive.store(false, std::memory_order_release);
+	});
+
 	_hwndSrc = hwndSrc;
 	_config.reset(new Config());
 	_config->Initialize(cursorZoomFactor, cursorInterpolationMode, adapterIdx, multiMonitorUsage, cropBorders, flags);
 	
 	SetErrorMsg(ErrorMessages::GENERIC);
+	_frameStatistics->Reset();
 
 	// 模拟独占全屏
 	// 必须在主窗口创建前，否则 SHQueryUserNotificationState 可能返回 QUNS_BUSY 而不是 QUNS_RUNNING_D3D_FULL_SCREEN
@@ -113,6 +131,275 @@ bool App::Run(
 	return true;
 }
 
+// 基准测试开始统计前预热的帧数，排除首次执行着色器的开销
+static constexpr UINT BENCHMARK_WARMUP_FRAMES = 10;
+
+bool App::Benchmark(
+	const std::string& effectsJson,
+	SIZE inputSize,
+	SIZE outputSize,
+	UINT frameCount,
+	std::string& result
+) {
+	if (outputSize.cx <= 0 || outputSize.cy <= 0 || frameCount == 0) {
+		Logger::Get().Error("非法的基准测试参数");
+		return false;
+	}
+
+	if (!_BeginSession()) {
+		Logger::Get().Error("已有缩放、基准测试或批处理正在执行");
+		return false;
+	}
+	Utils::ScopeExit se([this]() {
+		_isSessionActive.store(false, std::memory_order_release);
+	});
+
+	_isHeadless = true;
+	_hwndSrc = NULL;
+	_hwndHost = NULL;
+	_hostWndRect = { 0, 0, outputSize.cx, outputSize.cy };
+
+	// 使用第一个支持的显卡，其他选项均为默认值
+	_config.reset(new Config());
+	_config->Initialize(0, 0, -1, 0, {}, 0);
+
+	// 未设置回放路径时使用合成帧，不限制帧率
+	const ReplayOptions replayOptions = _replayOptions;
+	_replayOptions.frameRate = 0;
+	_replayOptions.recordPath.clear();
+	_replayOptions.syntheticFrameSize = inputSize;
+
+	const UINT cacheHits = EffectCacheManager::Get().GetHitCount();
+	const UINT cacheMisses = EffectCacheManager::Get().GetMissCount();
+
+	bool success = [&]() {
+		_deviceResources.reset(new DeviceResources());
+		if (!_deviceResources->Initialize()) {
+			Logger::Get().Error("初始化 DeviceResources 失败");
+			return false;
+		}
+
+		if (!_InitFrameSource(4)) {
+			Logger::Get().Error("_InitFrameSource 失败");
+			return false;
+		}
+
+		_renderer.reset(new Renderer());
+		if (!_renderer->Initialize(effectsJson)) {
+			Logger::Get().Error("初始化 Renderer 失败");
+			return false;
+		}
+
+		// 不初始化，始终没有光标
+		_cursorManager.reset(new CursorManager());
+
+		for (UINT i = 0; i < BENCHMARK_WARMUP_FRAMES; ++i) {
+			_renderer->Render();
+		}
+		_renderer->FinishProfiling();
+		_frameStatistics->Reset();
+
+		for (UINT i = 0; i < frameCount; ++i) {
+			_renderer->Render();
+		}
+		_renderer->FinishProfiling();
+
+		return true;
+	}();
+
+	if (success) {
+		result = _GetBenchmarkResult(inputSize, outputSize, frameCount,
+			EffectCacheManager::Get().GetHitCount() - cacheHits,
+			EffectCacheManager::Get().GetMissCount() - cacheMisses);
+	}
+
+	_OnQuit();
+	_replayOptions = replayOptions;
+	_isHeadless = false;
+
+	return success;
+}
+
+std::string App::_GetBenchmarkResult(SIZE inputSize, SIZE outputSize, UINT frameCount, UINT cacheHits, UINT cacheMisses) {
+	rapidjson::StringBuffer buffer;
+	rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+	const auto writeHistogram = [&writer](const AtomicHistogram& histogram) {
+		writer.Key("mean");
+		writer.Double(histogram.GetAverage());
+		writer.Key("p50");
+		writer.Double(histogram.GetPercentile(0.5f));
+		writer.Key("p99");
+		writer.Double(histogram.GetPercentile(0.99f));
+	};
+
+	writer.StartObject();
+
+	DXGI_ADAPTER_DESC1 adapterDesc{};
+	if (SUCCEEDED(_deviceResources->GetGraphicsAdapter()->GetDesc1(&adapterDesc))) {
+		writer.Key("adapter");
+		writer.String(StrUtils::UTF16ToUTF8(adapterDesc.Description).c_str());
+	}
+
+	// 输入可能来自回放路径，以实际的帧尺寸为准
+	const SIZE frameSize = Utils::GetSizeOfRect(_frameSource->GetSrcFrameRect());
+	writer.Key("input");
+	writer.StartArray();
+	writer.Int(frameSize.cx);
+	writer.Int(frameSize.cy);
+	writer.EndArray();
+
+	writer.Key("output");
+	writer.StartArray();
+	writer.Int(outputSize.cx);
+	writer.Int(outputSize.cy);
+	writer.EndArray();
+
+	writer.Key("frames");
+	writer.Uint(frameCount);
+
+	// 以下时间单位均为 ms
+	writer.Key("compileTime");
+	writer.Double(_renderer->GetCompileTime());
+
+	writer.Key("cache");
+	writer.StartObject();
+	writer.Key("hits");
+	writer.Uint(cacheHits);
+	writer.Key("misses");
+	writer.Uint(cacheMisses);
+	writer.EndObject();
+
+	writer.Key("frameTime");
+	writer.StartObject();
+	writeHistogram(_frameStatistics->GetFrameTimes());
+	writer.EndObject();
+
+	writer.Key("passes");
+	writer.StartArray();
+	std::vector<std::string> passNames = _renderer->GetPassNames();
+	std::span<const std::unique_ptr<AtomicHistogram>> passTimes = _frameStatistics->GetPassTimes();
+	for (size_t i = 0; i < passTimes.size() && i < passNames.size(); ++i) {
+		writer.StartObject();
+		writer.Key("name");
+		writer.String(passNames[i].c_str());
+		writer.Key("samples");
+		writer.Uint(passTimes[i]->GetCount());
+		writeHistogram(*passTimes[i]);
+		writer.EndObject();
+	}
+	writer.EndArray();
+
+	// 单位为字节
+	writer.Key("vram");
+	writer.StartObject();
+	DXGI_QUERY_VIDEO_MEMORY_INFO memInfo{};
+	if (_deviceResources->QueryVideoMemoryInfo(memInfo)) {
+		writer.Key("usage");
+		writer.Uint64(memInfo.CurrentUsage);
+		writer.Key("budget");
+		writer.Uint64(memInfo.Budget);
+	}
+	writer.Key("effects");
+	writer.StartArray();
+	for (UINT i = 0, effectCount = _renderer->GetEffectCount(); i < effectCount; ++i) {
+		writer.Uint64(_renderer->GetEffectDrawer(i).GetTotalTextureMemory());
+	}
+	writer.EndArray();
+	writer.EndObject();
+
+	writer.EndObject();
+
+	return buffer.GetString();
+}
+
+bool App::BatchProcess(
+	const std::string& effectsJson,
+	const std::wstring& inputDir,
+	const std::wstring& outputDir,
+	SIZE boxSize,
+	std::string& result
+) {
+	if (boxSize.cx <= 0 || boxSize.cy <= 0 || inputDir.empty() || outputDir.empty()) {
+		Logger::Get().Error("非法的批处理参数");
+		return false;
+	}
+
+	if (!_BeginSession()) {
+		Logger::Get().Error("已有缩放、基准测试或批处理正在执行");
+		return false;
+	}
+	Utils::ScopeExit se([this]() {
+		_isSessionActive.store(false, std::memory_order_release);
+	});
+
+	_isHeadless = true;
+	_hwndSrc = NULL;
+	_hwndHost = NULL;
+	// 只用于计算 scale 属性，也是离屏后缓冲区的尺寸
+	_hostWndRect = { 0, 0, boxSize.cx, boxSize.cy };
+
+	// 使用第一个支持的显卡，其他选项均为默认值
+	_config.reset(new Config());
+	_config->Initialize(0, 0, -1, 0, {}, 0);
+
+	bool success = [&]() {
+		_deviceResources.reset(new DeviceResources());
+		if (!_deviceResources->Initialize()) {
+			Logger::Get().Error("初始化 DeviceResources 失败");
+			return false;
+		}
+
+		// 不需要捕获和 Renderer，效果由 BatchProcessor 直接绘制
+		BatchProcessor batchProcessor;
+		if (!batchProcessor.Initialize(effectsJson)) {
+			Logger::Get().Error("初始化 BatchProcessor 失败");
+			return false;
+		}
+
+		if (!batchProcessor.Process(inputDir, outputDir)) {
+			Logger::Get().Error("批处理失败");
+			return false;
+		}
+
+		result = _GetBatchResult(batchProcessor);
+		return true;
+	}();
+
+	_OnQuit();
+	_isHeadless = false;
+
+	return success;
+}
+
+std::string App::_GetBatchResult(const BatchProcessor& batchProcessor) {
+	rapidjson::StringBuffer buffer;
+	rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+	writer.StartObject();
+
+	DXGI_ADAPTER_DESC1 adapterDesc{};
+	if (SUCCEEDED(_deviceResources->GetGraphicsAdapter()->GetDesc1(&adapterDesc))) {
+		writer.Key("adapter");
+		writer.String(StrUtils::UTF16ToUTF8(adapterDesc.Description).c_str());
+	}
+
+	writer.Key("images");
+	writer.Uint(batchProcessor.GetImageCount());
+	writer.Key("failed");
+	writer.Uint(batchProcessor.GetFailedCount());
+
+	// 以下时间单位均为 ms
+	writer.Key("compileTime");
+	writer.Double(batchProcessor.GetCompileTime());
+	writer.Key("processTime");
+	writer.Double(batchProcessor.GetProcessTime());
+
+	writer.EndObject();
+
+	return buffer.GetString();
+}
+
 void App::_RunMessageLoop() {
 	Logger::Get().Info("开始接收窗口消息");
 
@@ -128,6 +415,11 @@ void App::_RunMessageLoop() {
 			DispatchMessage(&msg);
 		}
 
+		if (!_WaitForNextRender()) {
+			// 有新消息
+			continue;
+		}
+
 		_renderer->Render();
 
 		// 第二帧（等待时或完成后）显示 DDF 窗口
@@ -143,9 +435,44 @@ void App::_RunMessageLoop() {
 	}
 }
 
+// 阻塞直到可以渲染下一帧，返回 false 表示被新消息唤醒
+// 如果渲染器正在等待新帧则等待捕获源的新帧事件，否则等待交换链
+bool App::_WaitForNextRender() {
+	// 等待新帧时的超时，超时后仍要调用 Render 以检查源窗口状态
+	static constexpr DWORD WAIT_FOR_NEW_FRAME_TIMEOUT = 8;
+
+	HANDLE hWait;
+	DWORD timeout;
+	if (_renderer->IsWaitingForNextFrame()) {
+		// 已经等待过交换链
+		hWait = _frameSource->GetNewFrameEvent();
+		timeout = WAIT_FOR_NEW_FRAME_TIMEOUT;
+	} else {
+		hWait = _deviceResources->GetFrameLatencyWaitableObject();
+		timeout = 1000;
+	}
+
+	if (!hWait) {
+		// 捕获方式不支持事件，只能轮询
+		return true;
+	}
+
+	DWORD result = MsgWaitForMultipleObjectsEx(1, &hWait, timeout, QS_ALLINPUT, MWMO_INPUTAVAILABLE | MWMO_ALERTABLE);
+	if (result == WAIT_FAILED) {
+		Logger::Get().Win32Error("MsgWaitForMultipleObjectsEx 失败");
+		return true;
+	}
+
+	return result != WAIT_OBJECT_0 + 1;
+}
+
 winrt::com_ptr<IWICImagingFactory2> App::GetWICImageFactory() {
+	// 纹理在线程池中并行加载，因此需要同步
+	static Utils::CSMutex cs;
 	static winrt::com_ptr<IWICImagingFactory2> wicImgFactory;
 
+	std::scoped_lock lk(cs);
+
 	if (wicImgFactory == nullptr) {
 		HRESULT hr = CoCreateInstance(
 			CLSID_WICImagingFactory,
@@ -340,6 +667,9 @@ bool App::_InitFrameSource(int captureMode) {
 	case 3:
 		_frameSource.reset(new DwmSharedSurfaceFrameSource());
 		break;
+	case 4:
+		_frameSource.reset(new ReplayFrameSource());
+		break;
 	default:
 		Logger::Get().Critical("未知的捕获模式");
 		return false;
@@ -433,6 +763,11 @@ LRESULT App::_HostWndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 	return DefWindowProc(hWnd, message, wParam, lParam);
 }
 
+bool App::_BeginSession() noexcept {
+	bool expected = false;
+	return _isSessionActive.compare_exchange_strong(expected, true, std::memory_order_acq_rel);
+}
+
 void App::_OnQuit() {
 	// 释放资源
 	_cursorManager = nullptr;
@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include <unordered_map>
+#include <atomic>
 #include "ErrorMessages.h"
 
 
@@ -9,6 +10,8 @@ class Renderer;
 class FrameSourceBase;
 class CursorManager;
 class Config;
+class FrameStatistics;
+class BatchProcessor;
 
 
 class App {
@@ -22,6 +25,35 @@ public:
 
 	bool Initialize(HINSTANCE hInst);
 
+	// 回放和录制的选项，须在 Run 之前设置
+	struct ReplayOptions {
+		// 图像文件夹或原始帧文件
+		std::wstring replayPath;
+		// 0 表示不限制帧率
+		float frameRate = 0;
+		// 非空时将捕获到的帧录制到此文件
+		std::wstring recordPath;
+		// replayPath 为空时生成此尺寸的合成帧，只用于基准测试
+		SIZE syntheticFrameSize{};
+	};
+
+	void SetReplayOptions(const ReplayOptions& options) {
+		_replayOptions = options;
+	}
+
+	const ReplayOptions& GetReplayOptions() const noexcept {
+		return _replayOptions;
+	}
+
+	// 非空时将每帧的时间线记录到此文件，须在 Run 之前设置
+	void SetTraceFile(std::wstring_view fileName) {
+		_traceFile = fileName;
+	}
+
+	const std::wstring& GetTraceFile() const noexcept {
+		return _traceFile;
+	}
+
 	bool Run(
 		HWND hwndSrc,
 		const std::string& effectsJson,
@@ -34,8 +66,40 @@ public:
 		UINT flags
 	);
 
+	// 不创建窗口和交换链，使用回放的帧或合成帧将 effectsJson 渲染 frameCount 帧
+	// 成功时 result 为 json 格式的统计结果，包括编译用时、缓存命中、各通道的 GPU 时间和显存占用
+	bool Benchmark(
+		const std::string& effectsJson,
+		SIZE inputSize,
+		SIZE outputSize,
+		UINT frameCount,
+		std::string& result
+	);
+
+	// 不创建窗口，将 inputDir 中的所有图像通过 effectsJson 处理后以 PNG 格式保存到 outputDir
+	// scale 属性为 [0, 0] 或负数时相对于 boxSize 计算
+	// 成功时 result 为 json 格式的统计结果
+	bool BatchProcess(
+		const std::string& effectsJson,
+		const std::wstring& inputDir,
+		const std::wstring& outputDir,
+		SIZE boxSize,
+		std::string& result
+	);
+
 	void Quit();
 
+	// Run、Benchmark 和 BatchProcess 共用 App 的状态，同一时间只能有一个在执行
+	// 可在任何线程调用
+	bool IsSessionActive() const noexcept {
+		return _isSessionActive.load(std::memory_order_acquire);
+	}
+
+	// 无窗口模式下没有源窗口、主窗口和交换链，只用于基准测试和批处理
+	bool IsHeadless() const noexcept {
+		return _isHeadless;
+	}
+
 	HINSTANCE GetHInstance() const noexcept {
 		return _hInst;
 	}
@@ -72,6 +136,11 @@ public:
 		return *_config;
 	}
 
+	// 在 Initialize 中创建，可以在其他线程读取
+	FrameStatistics& GetFrameStatistics() noexcept {
+		return *_frameStatistics;
+	}
+
 	const char* GetErrorMsg() const noexcept {
 		return _errorMsg;
 	}
@@ -91,6 +160,8 @@ private:
 
 	void _RunMessageLoop();
 
+	bool _WaitForNextRender();
+
 	void _RegisterWndClasses() const;
 
 	// 创建主窗口
@@ -100,12 +171,19 @@ private:
 
 	bool _DisableDirectFlip();
 
+	std::string _GetBenchmarkResult(SIZE inputSize, SIZE outputSize, UINT frameCount, UINT cacheHits, UINT cacheMisses);
+
+	std::string _GetBatchResult(const BatchProcessor& batchProcessor);
+
 	static LRESULT CALLBACK _HostWndProcStatic(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam);
 
 	LRESULT _HostWndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam);
 
 	void _OnQuit();
 
+	// 已有会话在执行时返回 false
+	bool _BeginSession() noexcept;
+
 	const char* _errorMsg = ErrorMessages::GENERIC;
 
 	HINSTANCE _hInst = NULL;
@@ -117,6 +195,9 @@ private:
 
 	RECT _hostWndRect{};
 
+	bool _isHeadless = false;
+	std::atomic<bool> _isSessionActive = false;
+
 	bool _windowResizingDisabled = false;
 	bool _roundCornerDisabled = false;
 
@@ -125,6 +206,10 @@ private:
 	std::unique_ptr<FrameSourceBase> _frameSource;
 	std::unique_ptr<CursorManager> _cursorManager;
 	std::unique_ptr<Config> _config;
+	std::unique_ptr<FrameStatistics> _frameStatistics;
+
+	ReplayOptions _replayOptions;
+	std::wstring _traceFile;
 
 	std::map<UINT, std::function<std::optional<LRESULT>(HWND, UINT, WPARAM, LPARAM)>> _wndProcHandlers;
 	UINT _nextWndProcHandlerID = 1;
@@ -0,0 +1,426 @@
+#include "pch.h"
+#include "BatchProcessor.h"
+#include "App.h"
+#include "DeviceResources.h"
+#include "Renderer.h"
+#include "EffectDrawer.h"
+#include "Logger.h"
+#include "StrUtils.h"
+#include <deque>
+
+
+// 预先解码的图像数，GPU 处理当前图像时后面的图像在线程池中解码
+static constexpr UINT MAX_PENDING_DECODES = 4;
+// 进行中的编码任务数，超过时 GPU 处理等待编码完成，限制内存占用
+static constexpr UINT MAX_PENDING_ENCODES = 4;
+// 缓存的效果链数，输入尺寸不断变化时释放最久未使用的
+static constexpr UINT MAX_EFFECT_CHAINS = 4;
+
+BatchProcessor::_EffectChain::~_EffectChain() {
+	effects.clear();
+
+	if (inputTex) {
+		App::Get().GetDeviceResources().ReleaseViews(inputTex.get());
+	}
+
+	TextureLoader::WaitAll(sourceTextures);
+}
+
+BatchProcessor::BatchProcessor() {
+	InitializeConditionVariable(&_encodeCV);
+}
+
+BatchProcessor::~BatchProcessor() {
+	// 编码任务引用了 this
+	_WaitForEncodes(0);
+
+	_effectChains.clear();
+
+	TextureLoader::WaitAll(_sourceTextures);
+}
+
+bool BatchProcessor::Initialize(const std::string& effectsJson) {
+	// 输入尺寸未知，先编译原效果
+	if (!Renderer::CompileEffects(effectsJson, true, {}, _effectDescs, _effectParams, _sourceTextures, _compileTime)) {
+		Logger::Get().Error("编译效果失败");
+		return false;
+	}
+
+	_effectsJson = effectsJson;
+	_hasSeparableVariants = std::any_of(_effectDescs.begin(), _effectDescs.end(), [](const EffectDesc& desc) {
+		return Renderer::HasSeparableVariant(desc.name);
+	});
+
+	return true;
+}
+
+bool BatchProcessor::Process(const std::wstring& inputDir, const std::wstring& outputDir) {
+	static const std::wstring_view IMAGE_EXTS[] = { L"bmp", L"jpg", L"jpeg", L"png", L"tif", L"tiff", L"dds" };
+
+	std::vector<std::wstring> fileNames;
+
+	WIN32_FIND_DATA findData{};
+	HANDLE hFind = FindFirstFileEx(StrUtils::ConcatW(inputDir, L"\\*").c_str(),
+		FindExInfoBasic, &findData, FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+	if (hFind == INVALID_HANDLE_VALUE) {
+		Logger::Get().Win32Error("FindFirstFileEx 失败");
+		return false;
+	}
+
+	do {
+		if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+			continue;
+		}
+
+		std::wstring_view fileName(findData.cFileName);
+		size_t dotPos = fileName.find_last_of(L'.');
+		if (dotPos == std::wstring_view::npos) {
+			continue;
+		}
+
+		std::wstring ext(fileName.substr(dotPos + 1));
+		std::transform(ext.begin(), ext.end(), ext.begin(), [](wchar_t c) { return (wchar_t)std::towlower(c); });
+		if (std::find(std::begin(IMAGE_EXTS), std::end(IMAGE_EXTS), ext) != std::end(IMAGE_EXTS)) {
+			fileNames.emplace_back(fileName);
+		}
+	} while (FindNextFile(hFind, &findData));
+	FindClose(hFind);
+
+	if (fileNames.empty()) {
+		Logger::Get().Error("文件夹中没有图像");
+		return false;
+	}
+
+	std::sort(fileNames.begin(), fileNames.end());
+
+	if (!CreateDirectory(outputDir.c_str(), nullptr) && GetLastError() != ERROR_ALREADY_EXISTS) {
+		Logger::Get().Win32Error("创建输出文件夹失败");
+		return false;
+	}
+
+	_imageCount = (UINT)fileNames.size();
+	_failedCount = 0;
+
+	auto d3dDC = App::Get().GetDeviceResources().GetD3DDC();
+
+	int duration = Utils::Measure([&]() {
+		// 解码在线程池中进行，始终保持 MAX_PENDING_DECODES 张图像在解码
+		std::deque<TextureLoader::AsyncTexture> decodes;
+		size_t nextDecode = 0;
+		const auto submitDecodes = [&]() {
+			while (decodes.size() < MAX_PENDING_DECODES && nextDecode < fileNames.size()) {
+				decodes.push_back(TextureLoader::LoadAsync(StrUtils::ConcatW(inputDir, L"\\", fileNames[nextDecode])));
+				++nextDecode;
+			}
+		};
+
+		std::optional<_PendingReadback> pending;
+
+		for (const std::wstring& fileName : fileNames) {
+			submitDecodes();
+
+			winrt::com_ptr<ID3D11Texture2D> decoded = decodes.front().get();
+			decodes.pop_front();
+
+			if (!decoded) {
+				Logger::Get().Error(StrUtils::Concat("加载 ", StrUtils::UTF16ToUTF8(fileName), " 失败"));
+				++_failedCount;
+				continue;
+			}
+
+			_EffectChain* chain = _GetEffectChain(decoded.get());
+			if (!chain) {
+				Logger::Get().Error(StrUtils::Concat("为 ", StrUtils::UTF16ToUTF8(fileName), " 初始化效果失败"));
+				++_failedCount;
+				continue;
+			}
+
+			d3dDC->CopySubresourceRegion(chain->inputTex.get(), 0, 0, 0, 0, decoded.get(), 0, nullptr);
+
+			// 离线处理时没有动态常量，b0 未绑定，读取的值均为 0
+			UINT passIdx = 0;
+			for (const std::unique_ptr<EffectDrawer>& effect : chain->effects) {
+				effect->Draw(nullptr, passIdx);
+			}
+
+			ID3D11Texture2D* stagingTex = chain->stagingTextures[chain->nextStagingIdx].get();
+			chain->nextStagingIdx = (chain->nextStagingIdx + 1) % (UINT)chain->stagingTextures.size();
+			d3dDC->CopyResource(stagingTex, chain->outputTex);
+			// 立即提交，读回上一张图像时 GPU 处理这一张
+			d3dDC->Flush();
+
+			if (pending) {
+				_ReadBack(*pending);
+			}
+
+			std::wstring outputFileName(fileName.substr(0, fileName.find_last_of(L'.')));
+			pending.emplace();
+			pending->stagingTexture.copy_from(stagingTex);
+			pending->size = chain->outputSize;
+			pending->outputFileName = StrUtils::ConcatW(outputDir, L"\\", outputFileName, L".png");
+		}
+
+		if (pending) {
+			_ReadBack(*pending);
+		}
+
+		_WaitForEncodes(0);
+	});
+
+	_processTime = duration / 1000.0f;
+
+	Logger::Get().Info(fmt::format("批处理完成，共 {} 张图像，失败 {} 张，用时 {} 毫秒",
+		_imageCount, _failedCount.load(), _processTime));
+	return true;
+}
+
+BatchProcessor::_EffectChain* BatchProcessor::_GetEffectChain(ID3D11Texture2D* inputTex) {
+	D3D11_TEXTURE2D_DESC inputDesc;
+	inputTex->GetDesc(&inputDesc);
+
+	auto it = std::find_if(_effectChains.begin(), _effectChains.end(), [&](const std::unique_ptr<_EffectChain>& chain) {
+		return chain->inputSize.cx == (LONG)inputDesc.Width && chain->inputSize.cy == (LONG)inputDesc.Height
+			&& chain->inputFormat == inputDesc.Format;
+	});
+	if (it != _effectChains.end()) {
+		// 移到末尾
+		std::rotate(it, it + 1, _effectChains.end());
+		return _effectChains.back().get();
+	}
+
+	if (_effectChains.size() >= MAX_EFFECT_CHAINS) {
+		_effectChains.erase(_effectChains.begin());
+	}
+
+	DeviceResources& dr = App::Get().GetDeviceResources();
+
+	std::unique_ptr<_EffectChain> chain = std::make_unique<_EffectChain>();
+	chain->inputSize = { (LONG)inputDesc.Width, (LONG)inputDesc.Height };
+	chain->inputFormat = inputDesc.Format;
+
+	chain->inputTex = dr.CreateTexture2D(inputDesc.Format, inputDesc.Width, inputDesc.Height, D3D11_BIND_SHADER_RESOURCE);
+	if (!chain->inputTex) {
+		Logger::Get().Error("创建纹理失败");
+		return nullptr;
+	}
+
+	const std::vector<EffectDesc>* effectDescs = &_effectDescs;
+	const std::vector<std::vector<TextureLoader::AsyncTexture>>* sourceTextures = &_sourceTextures;
+
+	// 是否使用可分离的版本取决于输入尺寸，因此为每个输入尺寸重新编译。原效果已在缓存中
+	std::vector<EffectDesc> chainEffectDescs;
+	if (_hasSeparableVariants) {
+		std::vector<EffectParams> effectParams;
+		float compileTime = 0;
+		if (!Renderer::CompileEffects(_effectsJson, true, chain->inputSize,
+			chainEffectDescs, effectParams, chain->sourceTextures, compileTime)) {
+			Logger::Get().Error("编译效果失败");
+			return nullptr;
+		}
+
+		_compileTime += compileTime;
+		effectDescs = &chainEffectDescs;
+		sourceTextures = &chain->sourceTextures;
+	}
+
+	ID3D11Texture2D* effectInput = chain->inputTex.get();
+	const UINT effectCount = (UINT)effectDescs->size();
+	chain->effects.resize(effectCount);
+	for (UINT i = 0; i < effectCount; ++i) {
+		const EffectDesc& effectDesc = (*effectDescs)[i];
+		chain->effects[i].reset(new EffectDrawer());
+		if (!chain->effects[i]->Initialize(effectDesc, _effectParams[i], (*sourceTextures)[i], effectInput, &effectInput)) {
+			Logger::Get().Error(fmt::format("初始化效果#{} ({}) 失败", i, effectDesc.name));
+			return nullptr;
+		}
+	}
+	chain->outputTex = effectInput;
+
+	D3D11_TEXTURE2D_DESC outputDesc;
+	chain->outputTex->GetDesc(&outputDesc);
+	chain->outputSize = { (LONG)outputDesc.Width, (LONG)outputDesc.Height };
+
+	for (winrt::com_ptr<ID3D11Texture2D>& tex : chain->stagingTextures) {
+		D3D11_TEXTURE2D_DESC desc{};
+		desc.Format = outputDesc.Format;
+		desc.Width = outputDesc.Width;
+		desc.Height = outputDesc.Height;
+		desc.MipLevels = 1;
+		desc.ArraySize = 1;
+		desc.SampleDesc.Count = 1;
+		desc.Usage = D3D11_USAGE_STAGING;
+		desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+
+		HRESULT hr = dr.GetD3DDevice()->CreateTexture2D(&desc, nullptr, tex.put());
+		if (FAILED(hr)) {
+			Logger::Get().ComError("创建 Staging Texture2D 失败", hr);
+			return nullptr;
+		}
+	}
+
+	Logger::Get().Info(fmt::format("已为输入尺寸 {}x{} 创建效果链，输出尺寸 {}x{}",
+		chain->inputSize.cx, chain->inputSize.cy, chain->outputSize.cx, chain->outputSize.cy));
+
+	_effectChains.push_back(std::move(chain));
+	return _effectChains.back().get();
+}
+
+void BatchProcessor::_ReadBack(_PendingReadback& pending) {
+	auto d3dDC = App::Get().GetDeviceResources().GetD3DDC();
+
+	// 阻塞直到 GPU 处理完这张图像
+	D3D11_MAPPED_SUBRESOURCE ms;
+	HRESULT hr = d3dDC->Map(pending.stagingTexture.get(), 0, D3D11_MAP_READ, 0, &ms);
+	if (FAILED(hr)) {
+		Logger::Get().ComError("Map 失败", hr);
+		++_failedCount;
+		return;
+	}
+
+	// 中间纹理的输出格式为 R8G8B8A8_UNORM，每像素 4 字节
+	const UINT rowSize = pending.size.cx * 4;
+	std::vector<BYTE> pixels((size_t)rowSize * pending.size.cy);
+	for (LONG y = 0; y < pending.size.cy; ++y) {
+		std::memcpy(pixels.data() + (size_t)y * rowSize, (const BYTE*)ms.pData + (size_t)y * ms.RowPitch, rowSize);
+	}
+
+	d3dDC->Unmap(pending.stagingTexture.get(), 0);
+
+	_SubmitEncode(std::move(pending.outputFileName), pending.size, std::move(pixels));
+}
+
+struct EncodeTask {
+	BatchProcessor* processor;
+	std::wstring fileName;
+	SIZE size;
+	std::vector<BYTE> pixels;
+};
+
+void BatchProcessor::_SubmitEncode(std::wstring fileName, SIZE size, std::vector<BYTE> pixels) {
+	_WaitForEncodes(MAX_PENDING_ENCODES - 1);
+
+	{
+		std::scoped_lock lk(_encodeCS);
+		++_pendingEncodes;
+	}
+
+	EncodeTask* task = new EncodeTask{ this, std::move(fileName), size, std::move(pixels) };
+	if (!TrySubmitThreadpoolCallback(_EncodeCallback, task, nullptr)) {
+		Logger::Get().Win32Error("TrySubmitThreadpoolCallback 失败，回退到同步编码");
+		_EncodeCallback(nullptr, task);
+	}
+}
+
+void CALLBACK BatchProcessor::_EncodeCallback(PTP_CALLBACK_INSTANCE, PVOID context) {
+	std::unique_ptr<EncodeTask> task((EncodeTask*)context);
+	BatchProcessor& processor = *task->processor;
+
+	if (!_EncodePng(task->fileName.c_str(), task->size, task->pixels)) {
+		Logger::Get().Error(StrUtils::Concat("保存 ", StrUtils::UTF16ToUTF8(task->fileName), " 失败"));
+		++processor._failedCount;
+	}
+
+	// 释放像素数据后再通知，保证内存占用有上限
+	task.reset();
+
+	std::scoped_lock lk(processor._encodeCS);
+	--processor._pendingEncodes;
+	WakeAllConditionVariable(&processor._encodeCV);
+}
+
+bool BatchProcessor::_EncodePng(const wchar_t* fileName, SIZE size, const std::vector<BYTE>& pixels) {
+	winrt::com_ptr<IWICImagingFactory2> factory = App::Get().GetWICImageFactory();
+	if (!factory) {
+		Logger::Get().Error("GetWICImageFactory 失败");
+		return false;
+	}
+
+	winrt::com_ptr<IWICBitmap> bitmap;
+	HRESULT hr = factory->CreateBitmapFromMemory(size.cx, size.cy, GUID_WICPixelFormat32bppRGBA,
+		size.cx * 4, (UINT)pixels.size(), (BYTE*)pixels.data(), bitmap.put());
+	if (FAILED(hr)) {
+		Logger::Get().ComError("CreateBitmapFromMemory 失败", hr);
+		return false;
+	}
+
+	winrt::com_ptr<IWICStream> stream;
+	hr = factory->CreateStream(stream.put());
+	if (FAILED(hr)) {
+		Logger::Get().ComError("CreateStream 失败", hr);
+		return false;
+	}
+
+	hr = stream->InitializeFromFilename(fileName, GENERIC_WRITE);
+	if (FAILED(hr)) {
+		Logger::Get().ComError("InitializeFromFilename 失败", hr);
+		return false;
+	}
+
+	winrt::com_ptr<IWICBitmapEncoder> encoder;
+	hr = factory->CreateEncoder(GUID_ContainerFormatPng, nullptr, encoder.put());
+	if (FAILED(hr)) {
+		Logger::Get().ComError("CreateEncoder 失败", hr);
+		return false;
+	}
+
+	hr = encoder->Initialize(stream.get(), WICBitmapEncoderNoCache);
+	if (FAILED(hr)) {
+		Logger::Get().ComError("IWICBitmapEncoder::Initialize 失败", hr);
+		return false;
+	}
+
+	winrt::com_ptr<IWICBitmapFrameEncode> frame;
+	winrt::com_ptr<IPropertyBag2> props;
+	hr = encoder->CreateNewFrame(frame.put(), props.put());
+	if (FAILED(hr)) {
+		Logger::Get().ComError("CreateNewFrame 失败", hr);
+		return false;
+	}
+
+	hr = frame->Initialize(props.get());
+	if (FAILED(hr)) {
+		Logger::Get().ComError("IWICBitmapFrameEncode::Initialize 失败", hr);
+		return false;
+	}
+
+	hr = frame->SetSize(size.cx, size.cy);
+	if (FAILED(hr)) {
+		Logger::Get().ComError("SetSize 失败", hr);
+		return false;
+	}
+
+	// 编码器可能选择其他格式，WriteSource 会自动转换
+	WICPixelFormatGUID format = GUID_WICPixelFormat32bppRGBA;
+	hr = frame->SetPixelFormat(&format);
+	if (FAILED(hr)) {
+		Logger::Get().ComError("SetPixelFormat 失败", hr);
+		return false;
+	}
+
+	hr = frame->WriteSource(bitmap.get(), nullptr);
+	if (FAILED(hr)) {
+		Logger::Get().ComError("WriteSource 失败", hr);
+		return false;
+	}
+
+	hr = frame->Commit();
+	if (FAILED(hr)) {
+		Logger::Get().ComError("IWICBitmapFrameEncode::Commit 失败", hr);
+		return false;
+	}
+
+	hr = encoder->Commit();
+	if (FAILED(hr)) {
+		Logger::Get().ComError("IWICBitmapEncoder::Commit 失败", hr);
+		return false;
+	}
+
+	return true;
+}
+
+void BatchProcessor::_WaitForEncodes(UINT maxPending) {
+	std::scoped_lock lk(_encodeCS);
+	while (_pendingEncodes > maxPending) {
+		SleepConditionVariableCS(&_encodeCV, _encodeCS.get(), INFINITE);
+	}
+}
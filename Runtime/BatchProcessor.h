@@ -0,0 +1,104 @@
+#pragma once
+#include "pch.h"
+#include "EffectDesc.h"
+#include "TextureLoader.h"
+#include "Utils.h"
+#include <atomic>
+
+class EffectDrawer;
+
+
+// 离线批处理：将文件夹中的图像依次通过效果链，结果保存为 PNG
+// 解码和编码在线程池中进行，和 GPU 上的处理重叠
+// 使用 App 的 DeviceResources，须在无窗口模式下使用
+class BatchProcessor {
+public:
+	BatchProcessor();
+	BatchProcessor(const BatchProcessor&) = delete;
+	BatchProcessor(BatchProcessor&&) = delete;
+
+	~BatchProcessor();
+
+	bool Initialize(const std::string& effectsJson);
+
+	// 处理 inputDir 中所有支持的图像，以相同的文件名保存到 outputDir，后缀名改为 png
+	// 单个图像失败不会中止处理，没有任何图像时返回 false
+	bool Process(const std::wstring& inputDir, const std::wstring& outputDir);
+
+	// 编译所有效果的用时，单位为 ms
+	float GetCompileTime() const noexcept {
+		return _compileTime;
+	}
+
+	// 处理所有图像的用时，包括解码和编码，单位为 ms
+	float GetProcessTime() const noexcept {
+		return _processTime;
+	}
+
+	UINT GetImageCount() const noexcept {
+		return _imageCount;
+	}
+
+	UINT GetFailedCount() const noexcept {
+		return _failedCount;
+	}
+
+private:
+	// 为某个输入尺寸和格式创建的效果链，效果的纹理尺寸依赖于输入尺寸
+	struct _EffectChain {
+		~_EffectChain();
+
+		SIZE inputSize{};
+		DXGI_FORMAT inputFormat = DXGI_FORMAT_UNKNOWN;
+		SIZE outputSize{};
+		// 解码后的图像复制到这里，效果初始化时已绑定它的 SRV
+		winrt::com_ptr<ID3D11Texture2D> inputTex;
+		ID3D11Texture2D* outputTex = nullptr;
+		std::vector<std::unique_ptr<EffectDrawer>> effects;
+		// 为此输入尺寸重新编译时加载的 SOURCE 纹理
+		std::vector<std::vector<TextureLoader::AsyncTexture>> sourceTextures;
+		// 交替使用，读回上一张图像时 GPU 可以写入另一个
+		std::array<winrt::com_ptr<ID3D11Texture2D>, 2> stagingTextures;
+		UINT nextStagingIdx = 0;
+	};
+
+	// 已提交到 GPU 但尚未读回的图像
+	struct _PendingReadback {
+		winrt::com_ptr<ID3D11Texture2D> stagingTexture;
+		SIZE size{};
+		std::wstring outputFileName;
+	};
+
+	_EffectChain* _GetEffectChain(ID3D11Texture2D* inputTex);
+
+	void _ReadBack(_PendingReadback& pending);
+
+	void _SubmitEncode(std::wstring fileName, SIZE size, std::vector<BYTE> pixels);
+
+	static void CALLBACK _EncodeCallback(PTP_CALLBACK_INSTANCE, PVOID context);
+
+	static bool _EncodePng(const wchar_t* fileName, SIZE size, const std::vector<BYTE>& pixels);
+
+	// 等待直到进行中的编码任务不超过 maxPending 个
+	void _WaitForEncodes(UINT maxPending);
+
+	std::string _effectsJson;
+	// 存在可分离版本的效果时每个效果链单独编译
+	bool _hasSeparableVariants = false;
+
+	std::vector<EffectDesc> _effectDescs;
+	std::vector<EffectParams> _effectParams;
+	std::vector<std::vector<TextureLoader::AsyncTexture>> _sourceTextures;
+
+	// 按最近使用排序，最后一个为最近使用的
+	std::vector<std::unique_ptr<_EffectChain>> _effectChains;
+
+	Utils::CSMutex _encodeCS;
+	CONDITION_VARIABLE _encodeCV{};
+	UINT _pendingEncodes = 0;
+
+	float _compileTime = 0;
+	float _processTime = 0;
+	UINT _imageCount = 0;
+	std::atomic<UINT> _failedCount = 0;
+};
@@ -0,0 +1,57 @@
+#include "pch.h"
+#include "CursorCache.h"
+#include "Logger.h"
+
+
+// 普通光标为 32x32，即使是 256x256 的大光标也只占用 16MB
+static constexpr const size_t MAX_CACHE_COUNT = 64;
+
+
+UINT64 CursorCache::GetHash(std::span<const BYTE> colorPixels, std::span<const BYTE> maskPixels, SIZE size) noexcept {
+	std::hash<std::string_view> hasher;
+	UINT64 result = hasher(std::string_view((const char*)colorPixels.data(), colorPixels.size()));
+	result = result * 31 + hasher(std::string_view((const char*)maskPixels.data(), maskPixels.size()));
+	result = result * 31 + ((UINT64)(UINT)size.cx << 32 | (UINT)size.cy);
+	return result;
+}
+
+std::shared_ptr<const CursorBitmap> CursorCache::Find(UINT64 hash) {
+	std::scoped_lock lk(_cs);
+
+	auto it = _cache.find(hash);
+	if (it == _cache.end()) {
+		return nullptr;
+	}
+
+	it->second.second = ++_lastAccess;
+	return it->second.first;
+}
+
+void CursorCache::Add(UINT64 hash, const std::shared_ptr<const CursorBitmap>& bitmap) {
+	std::scoped_lock lk(_cs);
+
+	_cache[hash] = { bitmap, ++_lastAccess };
+
+	if (_cache.size() > MAX_CACHE_COUNT) {
+		// 清理一半较旧的缓存，正在使用的光标位图由 shared_ptr 保持有效
+		std::vector<UINT> access;
+		access.reserve(_cache.size());
+		for (const auto& pair : _cache) {
+			access.push_back(pair.second.second);
+		}
+
+		auto midIt = access.begin() + access.size() / 2;
+		std::nth_element(access.begin(), midIt, access.end());
+		UINT mid = *midIt;
+
+		for (auto it = _cache.begin(); it != _cache.end();) {
+			if (it->second.second < mid) {
+				it = _cache.erase(it);
+			} else {
+				++it;
+			}
+		}
+
+		Logger::Get().Info("已清理光标缓存");
+	}
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include "pch.h"
+#include "Utils.h"
+#include "CursorManager.h"
+
+
+// 转换后的光标位图，可以直接上传到纹理
+struct CursorBitmap {
+	SIZE size{};
+	CursorManager::CursorType type = CursorManager::CursorType::Color;
+	// R8G8B8A8 格式，行间距为 size.cx * 4
+	std::vector<BYTE> pixels;
+};
+
+// 以原始位图的哈希为键缓存转换后的光标，在同一进程的多次缩放之间共享
+// 光标句柄在会话之间可能改变，而位图不变，因此不以句柄为键
+class CursorCache {
+public:
+	static CursorCache& Get() noexcept {
+		static CursorCache instance;
+		return instance;
+	}
+
+	// colorPixels 和 maskPixels 为 GetDIBits 得到的原始位图，单色光标的 colorPixels 为空
+	static UINT64 GetHash(std::span<const BYTE> colorPixels, std::span<const BYTE> maskPixels, SIZE size) noexcept;
+
+	std::shared_ptr<const CursorBitmap> Find(UINT64 hash);
+
+	void Add(UINT64 hash, const std::shared_ptr<const CursorBitmap>& bitmap);
+
+private:
+	// 用于同步对 _cache 的访问
+	Utils::CSMutex _cs;
+	// hash -> (bitmap, lastAccess)
+	std::unordered_map<UINT64, std::pair<std::shared_ptr<const CursorBitmap>, UINT>> _cache;
+	UINT _lastAccess = 0;
+};
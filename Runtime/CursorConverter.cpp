@@ -0,0 +1,307 @@
+#include "pch.h"
+#include "CursorConverter.h"
+#include <intrin.h>
+#include <immintrin.h>
+
+
+CursorConverter::ISA CursorConverter::GetBestISA() noexcept {
+	static const ISA isa = []() {
+		std::array<int, 4> cpuInfo{};
+		__cpuid(cpuInfo.data(), 0);
+
+		if (cpuInfo[0] >= 7) {
+			__cpuid(cpuInfo.data(), 1);
+
+			// 需要 CPU 支持 AVX 且操作系统会保存 YMM 寄存器
+			constexpr int OSXSAVE_AVX = (1 << 27) | (1 << 28);
+			if ((cpuInfo[2] & OSXSAVE_AVX) == OSXSAVE_AVX && (_xgetbv(0) & 6) == 6) {
+				__cpuidex(cpuInfo.data(), 7, 0);
+				if (cpuInfo[1] & (1 << 5)) {
+					return ISA::AVX2;
+				}
+			}
+		}
+
+		// x64 总是支持 SSE2
+		return ISA::SSE2;
+	}();
+
+	return isa;
+}
+
+// 等价于 round(c * a / 255.0)，所有输入都精确
+static BYTE Premultiply(UINT c, UINT a) noexcept {
+	UINT t = c * a + 128;
+	return BYTE((t + (t >> 8)) >> 8);
+}
+
+static bool HasAlphaScalar(const BYTE* pixels, size_t pixelCount) noexcept {
+	for (size_t i = 0; i < pixelCount; ++i) {
+		if (pixels[i * 4 + 3] != 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static void ConvertColorScalar(BYTE* pixels, size_t pixelCount) noexcept {
+	for (size_t i = 0; i < pixelCount; ++i) {
+		BYTE* p = pixels + i * 4;
+		const UINT alpha = p[3];
+
+		BYTE b = Premultiply(p[0], alpha);
+		p[0] = Premultiply(p[2], alpha);
+		p[1] = Premultiply(p[1], alpha);
+		p[2] = b;
+		p[3] = BYTE(255 - alpha);
+	}
+}
+
+static void ConvertMaskedColorScalar(BYTE* pixels, const BYTE* maskPixels, size_t pixelCount) noexcept {
+	for (size_t i = 0; i < pixelCount; ++i) {
+		std::swap(pixels[i * 4], pixels[i * 4 + 2]);
+		pixels[i * 4 + 3] = maskPixels[i * 4];
+	}
+}
+
+static void ConvertMonochromeScalar(BYTE* andPixels, const BYTE* xorPixels, size_t pixelCount) noexcept {
+	for (size_t i = 0; i < pixelCount; ++i) {
+		andPixels[i * 4 + 1] = xorPixels[i * 4];
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// SSE2，每次处理 4 个像素
+//
+////////////////////////////////////////////////////////////////////////////////
+
+static size_t HasAlphaSSE2(const BYTE* pixels, size_t pixelCount, bool& result) noexcept {
+	const __m128i alphaMask = _mm_set1_epi32((int)0xFF000000);
+	const __m128i zero = _mm_setzero_si128();
+
+	size_t i = 0;
+	for (; i + 4 <= pixelCount; i += 4) {
+		__m128i v = _mm_loadu_si128((const __m128i*)(pixels + i * 4));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(v, alphaMask), zero)) != 0xFFFF) {
+			result = true;
+			return i;
+		}
+	}
+
+	result = false;
+	return i;
+}
+
+// x 为两个像素，每个通道 16 位
+static __m128i ConvertColorPixelsSSE2(__m128i x) noexcept {
+	const __m128i round = _mm_set1_epi16(128);
+	const __m128i max = _mm_set1_epi16(255);
+	const __m128i alphaLanes = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+
+	__m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+
+	// 255 * 255 + 128 + 254 不会溢出 16 位
+	__m128i t = _mm_add_epi16(_mm_mullo_epi16(x, alpha), round);
+	t = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+
+	// 交换 R 和 B
+	t = _mm_shufflehi_epi16(_mm_shufflelo_epi16(t, _MM_SHUFFLE(3, 0, 1, 2)), _MM_SHUFFLE(3, 0, 1, 2));
+
+	return _mm_or_si128(_mm_andnot_si128(alphaLanes, t), _mm_and_si128(alphaLanes, _mm_sub_epi16(max, alpha)));
+}
+
+static size_t ConvertColorSSE2(BYTE* pixels, size_t pixelCount) noexcept {
+	const __m128i zero = _mm_setzero_si128();
+
+	size_t i = 0;
+	for (; i + 4 <= pixelCount; i += 4) {
+		__m128i* p = (__m128i*)(pixels + i * 4);
+		__m128i v = _mm_loadu_si128(p);
+
+		__m128i lo = ConvertColorPixelsSSE2(_mm_unpacklo_epi8(v, zero));
+		__m128i hi = ConvertColorPixelsSSE2(_mm_unpackhi_epi8(v, zero));
+
+		_mm_storeu_si128(p, _mm_packus_epi16(lo, hi));
+	}
+
+	return i;
+}
+
+static size_t ConvertMaskedColorSSE2(BYTE* pixels, const BYTE* maskPixels, size_t pixelCount) noexcept {
+	const __m128i channelMask = _mm_set1_epi32(0xFF);
+	const __m128i greenMask = _mm_set1_epi32(0xFF00);
+
+	size_t i = 0;
+	for (; i + 4 <= pixelCount; i += 4) {
+		__m128i* p = (__m128i*)(pixels + i * 4);
+		__m128i v = _mm_loadu_si128(p);
+		__m128i mask = _mm_loadu_si128((const __m128i*)(maskPixels + i * 4));
+
+		__m128i r = _mm_and_si128(_mm_srli_epi32(v, 16), channelMask);
+		__m128i b = _mm_slli_epi32(_mm_and_si128(v, channelMask), 16);
+		__m128i a = _mm_slli_epi32(mask, 24);
+
+		_mm_storeu_si128(p, _mm_or_si128(_mm_or_si128(r, b), _mm_or_si128(_mm_and_si128(v, greenMask), a)));
+	}
+
+	return i;
+}
+
+static size_t ConvertMonochromeSSE2(BYTE* andPixels, const BYTE* xorPixels, size_t pixelCount) noexcept {
+	const __m128i channelMask = _mm_set1_epi32(0xFF);
+	const __m128i greenMask = _mm_set1_epi32(0xFF00);
+
+	size_t i = 0;
+	for (; i + 4 <= pixelCount; i += 4) {
+		__m128i* p = (__m128i*)(andPixels + i * 4);
+		__m128i v = _mm_loadu_si128(p);
+		__m128i x = _mm_loadu_si128((const __m128i*)(xorPixels + i * 4));
+
+		x = _mm_slli_epi32(_mm_and_si128(x, channelMask), 8);
+		_mm_storeu_si128(p, _mm_or_si128(_mm_andnot_si128(greenMask, v), x));
+	}
+
+	return i;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// AVX2，每次处理 8 个像素。和 SSE2 实现相同，unpack 和 pack 都在 128 位的半边内进行，不会打乱像素顺序
+//
+////////////////////////////////////////////////////////////////////////////////
+
+static size_t HasAlphaAVX2(const BYTE* pixels, size_t pixelCount, bool& result) noexcept {
+	const __m256i alphaMask = _mm256_set1_epi32((int)0xFF000000);
+
+	size_t i = 0;
+	for (; i + 8 <= pixelCount; i += 8) {
+		__m256i v = _mm256_loadu_si256((const __m256i*)(pixels + i * 4));
+		if (!_mm256_testz_si256(v, alphaMask)) {
+			result = true;
+			return i;
+		}
+	}
+
+	result = false;
+	return i;
+}
+
+static __m256i ConvertColorPixelsAVX2(__m256i x) noexcept {
+	const __m256i round = _mm256_set1_epi16(128);
+	const __m256i max = _mm256_set1_epi16(255);
+	const __m256i alphaLanes = _mm256_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0);
+
+	__m256i alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(x, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+
+	__m256i t = _mm256_add_epi16(_mm256_mullo_epi16(x, alpha), round);
+	t = _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+
+	t = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(t, _MM_SHUFFLE(3, 0, 1, 2)), _MM_SHUFFLE(3, 0, 1, 2));
+
+	return _mm256_blendv_epi8(t, _mm256_sub_epi16(max, alpha), alphaLanes);
+}
+
+static size_t ConvertColorAVX2(BYTE* pixels, size_t pixelCount) noexcept {
+	const __m256i zero = _mm256_setzero_si256();
+
+	size_t i = 0;
+	for (; i + 8 <= pixelCount; i += 8) {
+		__m256i* p = (__m256i*)(pixels + i * 4);
+		__m256i v = _mm256_loadu_si256(p);
+
+		__m256i lo = ConvertColorPixelsAVX2(_mm256_unpacklo_epi8(v, zero));
+		__m256i hi = ConvertColorPixelsAVX2(_mm256_unpackhi_epi8(v, zero));
+
+		_mm256_storeu_si256(p, _mm256_packus_epi16(lo, hi));
+	}
+
+	return i;
+}
+
+static size_t ConvertMaskedColorAVX2(BYTE* pixels, const BYTE* maskPixels, size_t pixelCount) noexcept {
+	// 每个像素内交换 R 和 B，A 通道稍后写入
+	const __m256i swapRB = _mm256_setr_epi8(
+		2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1,
+		2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1
+	);
+
+	size_t i = 0;
+	for (; i + 8 <= pixelCount; i += 8) {
+		__m256i* p = (__m256i*)(pixels + i * 4);
+		__m256i v = _mm256_loadu_si256(p);
+		__m256i mask = _mm256_loadu_si256((const __m256i*)(maskPixels + i * 4));
+
+		_mm256_storeu_si256(p, _mm256_or_si256(_mm256_shuffle_epi8(v, swapRB), _mm256_slli_epi32(mask, 24)));
+	}
+
+	return i;
+}
+
+static size_t ConvertMonochromeAVX2(BYTE* andPixels, const BYTE* xorPixels, size_t pixelCount) noexcept {
+	const __m256i channelMask = _mm256_set1_epi32(0xFF);
+	const __m256i greenMask = _mm256_set1_epi32(0xFF00);
+
+	size_t i = 0;
+	for (; i + 8 <= pixelCount; i += 8) {
+		__m256i* p = (__m256i*)(andPixels + i * 4);
+		__m256i v = _mm256_loadu_si256(p);
+		__m256i x = _mm256_loadu_si256((const __m256i*)(xorPixels + i * 4));
+
+		x = _mm256_slli_epi32(_mm256_and_si256(x, channelMask), 8);
+		_mm256_storeu_si256(p, _mm256_or_si256(_mm256_andnot_si256(greenMask, v), x));
+	}
+
+	return i;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// 向量实现返回已处理的像素数，剩余的像素由标量实现处理
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool CursorConverter::HasAlpha(const BYTE* pixels, size_t pixelCount, ISA isa) noexcept {
+	size_t i = 0;
+	bool result = false;
+	if (isa == ISA::AVX2) {
+		i = HasAlphaAVX2(pixels, pixelCount, result);
+	} else if (isa == ISA::SSE2) {
+		i = HasAlphaSSE2(pixels, pixelCount, result);
+	}
+
+	return result || HasAlphaScalar(pixels + i * 4, pixelCount - i);
+}
+
+void CursorConverter::ConvertColor(BYTE* pixels, size_t pixelCount, ISA isa) noexcept {
+	size_t i = 0;
+	if (isa == ISA::AVX2) {
+		i = ConvertColorAVX2(pixels, pixelCount);
+	} else if (isa == ISA::SSE2) {
+		i = ConvertColorSSE2(pixels, pixelCount);
+	}
+
+	ConvertColorScalar(pixels + i * 4, pixelCount - i);
+}
+
+void CursorConverter::ConvertMaskedColor(BYTE* pixels, const BYTE* maskPixels, size_t pixelCount, ISA isa) noexcept {
+	size_t i = 0;
+	if (isa == ISA::AVX2) {
+		i = ConvertMaskedColorAVX2(pixels, maskPixels, pixelCount);
+	} else if (isa == ISA::SSE2) {
+		i = ConvertMaskedColorSSE2(pixels, maskPixels, pixelCount);
+	}
+
+	ConvertMaskedColorScalar(pixels + i * 4, maskPixels + i * 4, pixelCount - i);
+}
+
+void CursorConverter::ConvertMonochrome(BYTE* andPixels, const BYTE* xorPixels, size_t pixelCount, ISA isa) noexcept {
+	size_t i = 0;
+	if (isa == ISA::AVX2) {
+		i = ConvertMonochromeAVX2(andPixels, xorPixels, pixelCount);
+	} else if (isa == ISA::SSE2) {
+		i = ConvertMonochromeSSE2(andPixels, xorPixels, pixelCount);
+	}
+
+	ConvertMonochromeScalar(andPixels + i * 4, xorPixels + i * 4, pixelCount - i);
+}
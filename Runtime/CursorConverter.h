@@ -0,0 +1,29 @@
+#pragma once
+#include "pch.h"
+
+
+// 将 GetDIBits 得到的 32 位 BGRA 光标位图转换为光标纹理的格式
+// 每个函数都有标量、SSE2 和 AVX2 实现，运行时根据 CPU 选择，结果逐字节相同
+// 标量实现作为参考，也用于处理末尾不足一个向量的像素
+struct CursorConverter {
+	enum class ISA {
+		Scalar,
+		SSE2,
+		AVX2
+	};
+
+	// CPU 支持的最佳指令集
+	static ISA GetBestISA() noexcept;
+
+	// 是否存在 A 通道不为 0 的像素
+	static bool HasAlpha(const BYTE* pixels, size_t pixelCount, ISA isa = GetBestISA()) noexcept;
+
+	// 彩色光标：预乘 A 通道，交换 R 和 B 通道，A 通道取反
+	static void ConvertColor(BYTE* pixels, size_t pixelCount, ISA isa = GetBestISA()) noexcept;
+
+	// 彩色掩码光标：交换 R 和 B 通道，将 AND 掩码复制到 A 通道
+	static void ConvertMaskedColor(BYTE* pixels, const BYTE* maskPixels, size_t pixelCount, ISA isa = GetBestISA()) noexcept;
+
+	// 单色光标：将 XOR 掩码复制到 AND 掩码的 G 通道，两者的像素数都是 pixelCount
+	static void ConvertMonochrome(BYTE* andPixels, const BYTE* xorPixels, size_t pixelCount, ISA isa = GetBestISA()) noexcept;
+};
@@ -7,6 +7,8 @@
 #include "Utils.h"
 #include "DeviceResources.h"
 #include "Config.h"
+#include "CursorCache.h"
+#include "CursorConverter.h"
 
 
 // 将源窗口的光标位置映射到缩放后的光标位置
@@ -94,6 +96,10 @@ CursorManager::~CursorManager() {
 		_StopCapture(pt, true);
 	}
 
+	if (_atlas) {
+		App::Get().GetDeviceResources().ReleaseViews(_atlas.get());
+	}
+
 	Logger::Get().Info("CursorDrawer 已析构");
 }
 
@@ -212,33 +218,48 @@ void CursorManager::OnBeginFrame() {
 		return;
 	}
 
+	// 系统可能以动画光标的某一帧作为当前光标，此时继续播放整个动画
+	auto frameIt = _frameToAnimatedCursor.find(ci.hCursor);
+	if (frameIt != _frameToAnimatedCursor.end()) {
+		ci.hCursor = frameIt->second;
+	}
+
 	if (!_ResolveCursor(ci.hCursor, false)) {
 		Logger::Get().Error("解析光标失败");
 		_curCursor = NULL;
 		return;
 	}
 
+	if (ci.hCursor != _curCursor) {
+		_animationStart = std::chrono::steady_clock::now();
+	}
+
 	_curCursorPos = SrcToHost(ci.ptScreenPos, false);
 	_curCursor = ci.hCursor;
+	_curFrameIdx = _GetAnimationFrame();
 }
 
-bool CursorManager::GetCursorTexture(ID3D11Texture2D** texture, CursorManager::CursorType& cursorType) {
-	if (_curCursorInfo->texture) {
-		*texture = _curCursorInfo->texture.get();
-		cursorType = _curCursorInfo->type;
-		return true;
+bool CursorManager::GetCursorTexture(ID3D11Texture2D** texture, CursorManager::CursorType& cursorType, RECT& atlasRect) {
+	if (_curCursorInfo->frames.empty()) {
+		if (!_ResolveCursor(_curCursor, true)) {
+			return false;
+		} else {
+			const char* cursorTypes[] = { "Color", "Masked Color", "Monochrome" };
+			Logger::Get().Info(fmt::format("已解析光标：{}\n\t类型：{}\n\t帧数：{}",
+				(void*)_curCursor, cursorTypes[(int)_curCursorInfo->frames[0].bitmap->type], _curCursorInfo->frames.size()));
+		}
 	}
 
-	if (!_ResolveCursor(_curCursor, true)) {
+	// 不创建新纹理，只上传到图集中。动画光标的所有帧一起上传
+	if (!_curCursorInfo->isInAtlas && !_UploadToAtlas(*_curCursorInfo)) {
 		return false;
-	} else {
-		const char* cursorTypes[] = { "Color", "Masked Color", "Monochrome" };
-		Logger::Get().Info(fmt::format("已解析光标：{}\n\t类型：{}",
-			(void*)_curCursor, cursorTypes[(int)_curCursorInfo->type]));
 	}
 
-	*texture = _curCursorInfo->texture.get();
-	cursorType = _curCursorInfo->type;
+	// 切换动画帧只需改变图集中的位置
+	const _CursorFrame& frame = _curCursorInfo->frames[std::min(_curFrameIdx, (UINT)_curCursorInfo->frames.size() - 1)];
+	*texture = _atlas.get();
+	cursorType = frame.bitmap->type;
+	atlasRect = frame.atlasRect;
 	return true;
 }
 
@@ -356,17 +377,45 @@ void CursorManager::_StopCapture(POINT cursorPos, bool onDestroy) {
 	}
 }
 
-bool CursorManager::_ResolveCursor(HCURSOR hCursor, bool resolveTexture) {
-	auto it = _cursorInfos.find(hCursor);
-	if (it != _cursorInfos.end() && (!resolveTexture || (resolveTexture && _curCursorInfo->texture))) {
-		_curCursorInfo = &it->second;
-		return true;
+// 光标图集的边长，可以容纳 16 个 256x256 的光标
+static constexpr LONG CURSOR_ATLAS_SIZE = 1024;
+
+// 未公开的 API，返回动画光标第 step 帧的句柄，rate 的单位为 1/60 秒
+using GetCursorFrameInfoFunc = HCURSOR(WINAPI*)(HCURSOR hCursor, DWORD reserved, DWORD step, DWORD* rate, DWORD* stepCount);
+
+static GetCursorFrameInfoFunc GetCursorFrameInfoProc() {
+	static const GetCursorFrameInfoFunc getCursorFrameInfo = []()->GetCursorFrameInfoFunc {
+		HMODULE hUser32 = GetModuleHandle(L"user32.dll");
+		if (!hUser32) {
+			return nullptr;
+		}
+
+		return (GetCursorFrameInfoFunc)GetProcAddress(hUser32, "GetCursorFrameInfo");
+	}();
+
+	return getCursorFrameInfo;
+}
+
+static bool GetBitmapPixels(HBITMAP hBmp, BITMAPINFO& bi, std::vector<BYTE>& pixels) {
+	const int height = -bi.bmiHeader.biHeight;
+	pixels.resize(bi.bmiHeader.biSizeImage);
+
+	HDC hdc = GetDC(NULL);
+	bool success = GetDIBits(hdc, hBmp, 0, height, pixels.data(), &bi, DIB_RGB_COLORS) == height;
+	ReleaseDC(NULL, hdc);
+
+	if (!success) {
+		Logger::Get().Win32Error("GetDIBits 失败");
 	}
+	return success;
+}
 
+// 获取光标转换后的位图，相同的光标在之前的缩放中可能已经转换过
+static std::shared_ptr<const CursorBitmap> ResolveCursorBitmap(HCURSOR hCursor) {
 	ICONINFO ii{};
 	if (!GetIconInfo(hCursor, &ii)) {
 		Logger::Get().Win32Error("GetIconInfo 失败");
-		return false;
+		return nullptr;
 	}
 
 	Utils::ScopeExit se([&ii]() {
@@ -379,21 +428,9 @@ bool CursorManager::_ResolveCursor(HCURSOR hCursor, bool resolveTexture) {
 	BITMAP bmp{};
 	if (!GetObject(ii.hbmMask, sizeof(bmp), &bmp)) {
 		Logger::Get().Win32Error("GetObject 失败");
-		return false;
-	}
-
-	_curCursorInfo = it == _cursorInfos.end() ? &_cursorInfos[hCursor] : &it->second;
-
-	_curCursorInfo->hotSpot = { (LONG)ii.xHotspot, (LONG)ii.yHotspot };
-	// 单色光标的 hbmMask 高度为实际高度的两倍
-	_curCursorInfo->size = { bmp.bmWidth, ii.hbmColor ? bmp.bmHeight : bmp.bmHeight / 2 };
-
-	if (!resolveTexture) {
-		return true;
+		return nullptr;
 	}
 
-	auto& dr = App::Get().GetDeviceResources();
-
 	BITMAPINFO bi{};
 	bi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
 	bi.bmiHeader.biWidth = bmp.bmWidth;
@@ -403,123 +440,251 @@ bool CursorManager::_ResolveCursor(HCURSOR hCursor, bool resolveTexture) {
 	bi.bmiHeader.biBitCount = 32;
 	bi.bmiHeader.biSizeImage = bmp.bmWidth * bmp.bmHeight * 4;
 
-	if (ii.hbmColor == NULL) {
-		// 单色光标
-		_curCursorInfo->type = CursorType::Monochrome;
+	std::vector<BYTE> colorPixels;
+	std::vector<BYTE> maskPixels;
 
-		std::vector<BYTE> pixels(bi.bmiHeader.biSizeImage);
-		HDC hdc = GetDC(NULL);
-		if (GetDIBits(hdc, ii.hbmMask, 0, bmp.bmHeight, &pixels[0], &bi, DIB_RGB_COLORS) != bmp.bmHeight) {
-			Logger::Get().Win32Error("GetDIBits 失败");
-			ReleaseDC(NULL, hdc);
-			return false;
+	// 若颜色掩码有 A 通道，则是彩色光标，否则是彩色掩码光标，没有颜色掩码的是单色光标
+	bool hasAlpha = false;
+	if (ii.hbmColor) {
+		if (!GetBitmapPixels(ii.hbmColor, bi, colorPixels)) {
+			return nullptr;
 		}
-		ReleaseDC(NULL, hdc);
 
+		hasAlpha = CursorConverter::HasAlpha(colorPixels.data(), colorPixels.size() / 4);
+	}
+
+	// 彩色光标不使用 AND 掩码
+	if (!hasAlpha && !GetBitmapPixels(ii.hbmMask, bi, maskPixels)) {
+		return nullptr;
+	}
+
+	// 单色光标的 hbmMask 高度为实际高度的两倍
+	const SIZE size = { bmp.bmWidth, ii.hbmColor ? bmp.bmHeight : bmp.bmHeight / 2 };
+
+	const UINT64 hash = CursorCache::GetHash(colorPixels, maskPixels, size);
+	std::shared_ptr<const CursorBitmap> cached = CursorCache::Get().Find(hash);
+	if (cached) {
+		return cached;
+	}
+
+	std::shared_ptr<CursorBitmap> bitmap = std::make_shared<CursorBitmap>();
+	bitmap->size = size;
+
+	const size_t pixelCount = (size_t)size.cx * size.cy;
+	if (!ii.hbmColor) {
+		// 单色光标
 		// 红色通道是 AND 掩码，绿色通道是 XOR 掩码
 		// 这里将下半部分的 XOR 掩码复制到上半部分的绿色通道中
-		const int halfSize = bi.bmiHeader.biSizeImage / 8;
-		BYTE* upPtr = &pixels[1];
-		BYTE* downPtr = &pixels[static_cast<size_t>(halfSize) * 4];
-		for (int i = 0; i < halfSize; ++i) {
-			*upPtr = *downPtr;
-
-			upPtr += 4;
-			downPtr += 4;
+		bitmap->type = CursorManager::CursorType::Monochrome;
+		CursorConverter::ConvertMonochrome(maskPixels.data(), maskPixels.data() + pixelCount * 4, pixelCount);
+		maskPixels.resize(pixelCount * 4);
+		bitmap->pixels = std::move(maskPixels);
+	} else if (hasAlpha) {
+		// 彩色光标
+		bitmap->type = CursorManager::CursorType::Color;
+		CursorConverter::ConvertColor(colorPixels.data(), pixelCount);
+		bitmap->pixels = std::move(colorPixels);
+	} else {
+		// 彩色掩码光标
+		// 将 XOR 掩码复制到透明通道中
+		bitmap->type = CursorManager::CursorType::MaskedColor;
+		CursorConverter::ConvertMaskedColor(colorPixels.data(), maskPixels.data(), pixelCount);
+		bitmap->pixels = std::move(colorPixels);
+	}
+
+	CursorCache::Get().Add(hash, bitmap);
+	return bitmap;
+}
+
+bool CursorManager::_ResolveCursor(HCURSOR hCursor, bool resolveTexture) {
+	auto it = _cursorInfos.find(hCursor);
+	if (it != _cursorInfos.end() && (!resolveTexture || !it->second.frames.empty())) {
+		_curCursorInfo = &it->second;
+		return true;
+	}
+
+	if (it == _cursorInfos.end()) {
+		ICONINFO ii{};
+		if (!GetIconInfo(hCursor, &ii)) {
+			Logger::Get().Win32Error("GetIconInfo 失败");
+			return false;
 		}
 
-		D3D11_SUBRESOURCE_DATA initData{};
-		initData.pSysMem = &pixels[0];
-		initData.SysMemPitch = bmp.bmWidth * 4;
+		Utils::ScopeExit se([&ii]() {
+			if (ii.hbmColor) {
+				DeleteBitmap(ii.hbmColor);
+			}
+			DeleteBitmap(ii.hbmMask);
+		});
 
-		_curCursorInfo->texture = dr.CreateTexture2D(
-			DXGI_FORMAT_R8G8B8A8_UNORM,
-			bmp.bmWidth,
-			bmp.bmHeight / 2,
-			D3D11_BIND_SHADER_RESOURCE,
-			D3D11_USAGE_IMMUTABLE,
-			0,
-			&initData
-		);
-		if (!_curCursorInfo->texture) {
-			Logger::Get().Error("创建纹理失败");
+		BITMAP bmp{};
+		if (!GetObject(ii.hbmMask, sizeof(bmp), &bmp)) {
+			Logger::Get().Win32Error("GetObject 失败");
 			return false;
 		}
 
+		_curCursorInfo = &_cursorInfos[hCursor];
+
+		_curCursorInfo->hotSpot = { (LONG)ii.xHotspot, (LONG)ii.yHotspot };
+		// 单色光标的 hbmMask 高度为实际高度的两倍
+		_curCursorInfo->size = { bmp.bmWidth, ii.hbmColor ? bmp.bmHeight : bmp.bmHeight / 2 };
+	} else {
+		_curCursorInfo = &it->second;
+	}
+
+	if (!resolveTexture) {
 		return true;
 	}
 
-	std::vector<BYTE> pixels(bi.bmiHeader.biSizeImage);
-	HDC hdc = GetDC(NULL);
-	if (GetDIBits(hdc, ii.hbmColor, 0, bmp.bmHeight, &pixels[0], &bi, DIB_RGB_COLORS) != bmp.bmHeight) {
-		Logger::Get().Win32Error("GetDIBits 失败");
-		ReleaseDC(NULL, hdc);
-		return false;
+	// 动画光标一次性解码所有帧，之后播放时不再调用 GDI
+	DWORD rate = 0;
+	DWORD stepCount = 0;
+	GetCursorFrameInfoFunc getCursorFrameInfo = GetCursorFrameInfoProc();
+	if (getCursorFrameInfo && getCursorFrameInfo(hCursor, 0, 0, &rate, &stepCount) && stepCount > 1) {
+		std::vector<_CursorFrame> frames(stepCount);
+		for (DWORD i = 0; i < stepCount; ++i) {
+			DWORD unused;
+			HCURSOR hFrame = getCursorFrameInfo(hCursor, 0, i, &rate, &unused);
+			if (!hFrame) {
+				Logger::Get().Error(fmt::format("获取动画光标的第 {} 帧失败", i));
+				return false;
+			}
+
+			frames[i].bitmap = ResolveCursorBitmap(hFrame);
+			if (!frames[i].bitmap) {
+				return false;
+			}
+
+			// rate 为 0 时使用系统的默认帧率
+			frames[i].duration = std::max(1u, (UINT)(rate ? rate : 6) * 1000 / 60);
+
+			if (hFrame != hCursor) {
+				_frameToAnimatedCursor[hFrame] = hCursor;
+			}
+		}
+
+		_curCursorInfo->frames = std::move(frames);
+	} else {
+		_curCursorInfo->frames.resize(1);
+		_curCursorInfo->frames[0].bitmap = ResolveCursorBitmap(hCursor);
+		if (!_curCursorInfo->frames[0].bitmap) {
+			_curCursorInfo->frames.clear();
+			return false;
+		}
 	}
-	ReleaseDC(NULL, hdc);
 
-	// 若颜色掩码有 A 通道，则是彩色光标，否则是彩色掩码光标
-	bool hasAlpha = false;
-	for (UINT i = 3; i < bi.bmiHeader.biSizeImage; i += 4) {
-		if (pixels[i] != 0) {
-			hasAlpha = true;
+	_curCursorInfo->isInAtlas = false;
+	return true;
+}
+
+UINT CursorManager::_GetAnimationFrame() const noexcept {
+	if (!_curCursorInfo || _curCursorInfo->frames.size() <= 1) {
+		return 0;
+	}
+
+	UINT totalDuration = 0;
+	for (const _CursorFrame& frame : _curCursorInfo->frames) {
+		totalDuration += frame.duration;
+	}
+
+	using namespace std::chrono;
+	UINT elapsed = UINT(duration_cast<milliseconds>(steady_clock::now() - _animationStart).count() % totalDuration);
+
+	UINT idx = 0;
+	for (const _CursorFrame& frame : _curCursorInfo->frames) {
+		if (elapsed < frame.duration) {
 			break;
 		}
+		elapsed -= frame.duration;
+		++idx;
 	}
 
-	if (hasAlpha) {
-		// 彩色光标
-		_curCursorInfo->type = CursorType::Color;
-
-		for (size_t i = 0; i < bi.bmiHeader.biSizeImage; i += 4) {
-			// 预乘 Alpha 通道
-			double alpha = pixels[i + 3] / 255.0f;
-
-			BYTE b = (BYTE)std::lround(pixels[i] * alpha);
-			pixels[i] = (BYTE)std::lround(pixels[i + 2] * alpha);
-			pixels[i + 1] = (BYTE)std::lround(pixels[i + 1] * alpha);
-			pixels[i + 2] = b;
-			
-			pixels[i + 3] = 255 - pixels[i + 3];
+	return idx;
+}
+
+size_t CursorManager::_AllocateAtlasRects(_CursorInfo& cursorInfo) {
+	for (size_t i = 0; i < cursorInfo.frames.size(); ++i) {
+		const SIZE size = cursorInfo.frames[i].bitmap->size;
+
+		// 当前行放不下时换行
+		if (_atlasNextPos.x + size.cx > CURSOR_ATLAS_SIZE) {
+			_atlasNextPos = { 0, _atlasNextPos.y + _atlasRowHeight };
+			_atlasRowHeight = 0;
 		}
-	} else {
-		// 彩色掩码光标
-		_curCursorInfo->type = CursorType::MaskedColor;
 
-		std::vector<BYTE> maskPixels(bi.bmiHeader.biSizeImage);
-		HDC hdc = GetDC(NULL);
-		if (GetDIBits(hdc, ii.hbmMask, 0, bmp.bmHeight, &maskPixels[0], &bi, DIB_RGB_COLORS) != bmp.bmHeight) {
-			Logger::Get().Win32Error("GetDIBits 失败");
-			ReleaseDC(NULL, hdc);
+		if (size.cx > CURSOR_ATLAS_SIZE || _atlasNextPos.y + size.cy > CURSOR_ATLAS_SIZE) {
+			return i;
+		}
+
+		cursorInfo.frames[i].atlasRect = {
+			_atlasNextPos.x,
+			_atlasNextPos.y,
+			_atlasNextPos.x + size.cx,
+			_atlasNextPos.y + size.cy
+		};
+
+		_atlasNextPos.x += size.cx;
+		_atlasRowHeight = std::max(_atlasRowHeight, size.cy);
+	}
+
+	return cursorInfo.frames.size();
+}
+
+bool CursorManager::_UploadToAtlas(_CursorInfo& cursorInfo) {
+	auto& dr = App::Get().GetDeviceResources();
+
+	if (!_atlas) {
+		_atlas = dr.CreateTexture2D(
+			DXGI_FORMAT_R8G8B8A8_UNORM,
+			CURSOR_ATLAS_SIZE,
+			CURSOR_ATLAS_SIZE,
+			D3D11_BIND_SHADER_RESOURCE
+		);
+		if (!_atlas) {
+			Logger::Get().Error("创建光标图集失败");
 			return false;
 		}
-		ReleaseDC(NULL, hdc);
+	}
 
-		// 将 XOR 掩码复制到透明通道中
-		for (size_t i = 0; i < bi.bmiHeader.biSizeImage; i += 4) {
-			std::swap(pixels[i], pixels[i + 2]);
-			pixels[i + 3] = maskPixels[i];
+	// 动画光标的所有帧必须同时位于图集中
+	size_t count = _AllocateAtlasRects(cursorInfo);
+	if (count < cursorInfo.frames.size()) {
+		// 图集已满则清空，其他光标再次使用时重新上传
+		for (auto& pair : _cursorInfos) {
+			pair.second.isInAtlas = false;
+		}
+
+		_atlasNextPos = {};
+		_atlasRowHeight = 0;
+
+		Logger::Get().Info("光标图集已满，已清空");
+
+		count = _AllocateAtlasRects(cursorInfo);
+		if (count == 0) {
+			const SIZE size = cursorInfo.frames[0].bitmap->size;
+			Logger::Get().Error(fmt::format("光标尺寸过大：{}x{}", size.cx, size.cy));
+			return false;
+		}
+
+		if (count < cursorInfo.frames.size()) {
+			Logger::Get().Warn(fmt::format("光标图集无法容纳所有 {} 帧，只播放前 {} 帧", cursorInfo.frames.size(), count));
+			cursorInfo.frames.resize(count);
 		}
 	}
 
-	D3D11_SUBRESOURCE_DATA initData{};
-	initData.pSysMem = &pixels[0];
-	initData.SysMemPitch = bmp.bmWidth * 4;
-
-	_curCursorInfo->texture = dr.CreateTexture2D(
-		DXGI_FORMAT_R8G8B8A8_UNORM,
-		bmp.bmWidth,
-		bmp.bmHeight,
-		D3D11_BIND_SHADER_RESOURCE,
-		D3D11_USAGE_IMMUTABLE,
-		0,
-		&initData
-	);
-	if (!_curCursorInfo->texture) {
-		Logger::Get().Error("创建纹理失败");
-		return false;
+	for (const _CursorFrame& frame : cursorInfo.frames) {
+		D3D11_BOX box{
+			(UINT)frame.atlasRect.left,
+			(UINT)frame.atlasRect.top,
+			0,
+			(UINT)frame.atlasRect.right,
+			(UINT)frame.atlasRect.bottom,
+			1
+		};
+		dr.GetD3DDC()->UpdateSubresource(_atlas.get(), 0, &box, frame.bitmap->pixels.data(), frame.bitmap->size.cx * 4, 0);
 	}
 
+	cursorInfo.isInAtlas = true;
 	return true;
 }
 
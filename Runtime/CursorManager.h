@@ -2,6 +2,8 @@
 #include "pch.h"
 
 
+struct CursorBitmap;
+
 class CursorManager {
 public:
 	CursorManager() = default;
@@ -42,7 +44,8 @@ public:
 		// RG 通道的值只能是 0 或 255
 		Monochrome
 	};
-	bool GetCursorTexture(ID3D11Texture2D** texture, CursorManager::CursorType& cursorType);
+	// 所有光标都位于同一个图集中，atlasRect 为当前光标在图集中的位置
+	bool GetCursorTexture(ID3D11Texture2D** texture, CursorManager::CursorType& cursorType, RECT& atlasRect);
 
 	void OnCursorCapturedOnOverlay();
 
@@ -67,6 +70,15 @@ private:
 
 	bool _ResolveCursor(HCURSOR hCursor, bool resolveTexture);
 
+	// 当前动画光标应显示的帧
+	UINT _GetAnimationFrame() const noexcept;
+
+	struct _CursorInfo;
+	// 返回成功分配的帧数
+	size_t _AllocateAtlasRects(_CursorInfo& cursorInfo);
+
+	bool _UploadToAtlas(_CursorInfo& cursorInfo);
+
 	void _AdjustCursorSpeed();
 
 	void _UpdateCursorClip();
@@ -83,12 +95,30 @@ private:
 	HCURSOR _curCursor = NULL;
 	POINT _curCursorPos{};
 
+	struct _CursorFrame {
+		// 转换后的位图，由 CursorCache 共享
+		std::shared_ptr<const CursorBitmap> bitmap;
+		RECT atlasRect{};
+		// 显示时长，单位为毫秒
+		UINT duration = 0;
+	};
+
 	struct _CursorInfo : CursorInfo {
-		winrt::com_ptr<ID3D11Texture2D> texture = nullptr;
-		CursorType type = CursorType::Color;
+		// 静态光标只有一帧
+		std::vector<_CursorFrame> frames;
+		bool isInAtlas = false;
 	};
 	_CursorInfo* _curCursorInfo = nullptr;
+	UINT _curFrameIdx = 0;
+	std::chrono::steady_clock::time_point _animationStart{};
 
 	std::unordered_map<HCURSOR, _CursorInfo> _cursorInfos;
+	// 动画光标的每一帧也是一个光标句柄
+	std::unordered_map<HCURSOR, HCURSOR> _frameToAnimatedCursor;
+
+	// 按行分配的光标图集，已满时清空
+	winrt::com_ptr<ID3D11Texture2D> _atlas;
+	POINT _atlasNextPos{};
+	LONG _atlasRowHeight = 0;
 };
 
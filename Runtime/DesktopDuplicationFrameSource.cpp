@@ -194,6 +194,12 @@ bool DesktopDuplicationFrameSource::Initialize() {
 	}
 	
 
+	_newFrameEvent.reset(CreateEvent(nullptr, FALSE, FALSE, nullptr));
+	if (!_newFrameEvent) {
+		Logger::Get().Win32Error("CreateEvent 失败");
+		return false;
+	}
+
 	_hDDPThread = CreateThread(nullptr, 0, _DDPThreadProc, this, 0, nullptr);
 	if (!_hDDPThread) {
 		return false;
@@ -377,7 +383,18 @@ DWORD WINAPI DesktopDuplicationFrameSource::_DDPThreadProc(LPVOID lpThreadParame
 
 		that._ddpD3dDC->CopySubresourceRegion(that._ddpSharedTex.get(), 0, 0, 0, 0, d3dRes.get(), 0, &that._frameInMonitor);
 		that._ddpSharedTexMutex->ReleaseSync(1);
+
+		// LastPresentTime 为桌面画面更新的时间
+		INT64 arrivalTime = info.LastPresentTime.QuadPart;
+		if (arrivalTime == 0) {
+			LARGE_INTEGER now;
+			QueryPerformanceCounter(&now);
+			arrivalTime = now.QuadPart;
+		}
+		that._frameArrivalTime.store(arrivalTime, std::memory_order_relaxed);
+
 		that._newFrameState.store(1);
+		SetEvent(that._newFrameEvent.get());
 	}
 
 	return 0;
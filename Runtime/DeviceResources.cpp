@@ -4,6 +4,7 @@
 #include "StrUtils.h"
 #include "Logger.h"
 #include "Config.h"
+#include "DDSLoderHelpers.h"
 
 
 static inline void LogAdapter(const DXGI_ADAPTER_DESC1& adapterDesc) {
@@ -177,9 +178,16 @@ bool DeviceResources::Initialize() {
 		return false;
 	}
 
-	if (!_CreateSwapChain()) {
-		Logger::Get().Error("_CreateSwapChain 失败");
-		return false;
+	if (App::Get().IsHeadless()) {
+		if (!_CreateOffscreenBackBuffer()) {
+			Logger::Get().Error("_CreateOffscreenBackBuffer 失败");
+			return false;
+		}
+	} else {
+		if (!_CreateSwapChain()) {
+			Logger::Get().Error("_CreateSwapChain 失败");
+			return false;
+		}
 	}
 
 	return true;
@@ -244,12 +252,56 @@ winrt::com_ptr<ID3D11Texture2D> DeviceResources::CreateTexture2D(
 	return result;
 }
 
+UINT64 DeviceResources::GetTextureSize(ID3D11Texture2D* texture) {
+	D3D11_TEXTURE2D_DESC desc;
+	texture->GetDesc(&desc);
+
+	const UINT64 bitsPerPixel = BitsPerPixel(desc.Format);
+	UINT64 result = 0;
+	for (UINT i = 0; i < desc.MipLevels; ++i) {
+		const UINT64 width = std::max(1U, desc.Width >> i);
+		const UINT64 height = std::max(1U, desc.Height >> i);
+		result += width * height * bitsPerPixel / 8;
+	}
+
+	return result * desc.ArraySize;
+}
+
+bool DeviceResources::QueryVideoMemoryInfo(DXGI_QUERY_VIDEO_MEMORY_INFO& info) const {
+	HRESULT hr = _graphicsAdapter->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &info);
+	if (FAILED(hr)) {
+		Logger::Get().ComError("QueryVideoMemoryInfo 失败", hr);
+		return false;
+	}
+
+	return true;
+}
+
 void DeviceResources::BeginFrame() {
-	WaitForSingleObjectEx(_frameLatencyWaitableObject.get(), 1000, TRUE);
+	// 等待 _frameLatencyWaitableObject 的工作已移至 App::_RunMessageLoop
 	_d3dDC->ClearState();
 }
 
+void DeviceResources::WaitForQuery(ID3D11DeviceContext* d3dDC, ID3D11Query* query) {
+	BOOL done = FALSE;
+	while (d3dDC->GetData(query, &done, sizeof(done), 0) == S_FALSE) {
+		SwitchToThread();
+	}
+}
+
 void DeviceResources::EndFrame() {
+	if (!_swapChain) {
+		// 提交本帧后等待上一帧完成，因此返回时 GPU 上最多只有本帧在排队，
+		// CPU 最多领先 GPU 一帧
+		_d3dDC->End(_frameEndQueries[_endedFrameCount % 2].get());
+		_d3dDC->Flush();
+
+		if (++_endedFrameCount >= 2) {
+			WaitForQuery(_d3dDC.get(), _frameEndQueries[_endedFrameCount % 2].get());
+		}
+		return;
+	}
+
 	if (App::Get().GetConfig().IsDisableVSync()) {
 		_swapChain->Present(0, DXGI_PRESENT_ALLOW_TEARING);
 	} else {
@@ -257,6 +309,46 @@ void DeviceResources::EndFrame() {
 	}
 }
 
+void DeviceResources::WaitForGPU() {
+	winrt::com_ptr<ID3D11Query> query;
+	D3D11_QUERY_DESC desc{ D3D11_QUERY_EVENT, 0 };
+	HRESULT hr = _d3dDevice->CreateQuery(&desc, query.put());
+	if (FAILED(hr)) {
+		Logger::Get().ComError("CreateQuery 失败", hr);
+		return;
+	}
+
+	_d3dDC->End(query.get());
+	WaitForQuery(_d3dDC.get(), query.get());
+}
+
+bool DeviceResources::_CreateOffscreenBackBuffer() {
+	const RECT& hostWndRect = App::Get().GetHostWndRect();
+
+	// 格式和用法与交换链的后缓冲区相同
+	_backBuffer = CreateTexture2D(
+		DXGI_FORMAT_R8G8B8A8_UNORM,
+		hostWndRect.right - hostWndRect.left,
+		hostWndRect.bottom - hostWndRect.top,
+		D3D11_BIND_UNORDERED_ACCESS | D3D11_BIND_RENDER_TARGET
+	);
+	if (!_backBuffer) {
+		Logger::Get().Error("创建离屏纹理失败");
+		return false;
+	}
+
+	D3D11_QUERY_DESC desc{ D3D11_QUERY_EVENT, 0 };
+	for (winrt::com_ptr<ID3D11Query>& query : _frameEndQueries) {
+		HRESULT hr = _d3dDevice->CreateQuery(&desc, query.put());
+		if (FAILED(hr)) {
+			Logger::Get().ComError("CreateQuery 失败", hr);
+			return false;
+		}
+	}
+
+	return true;
+}
+
 bool DeviceResources::_CreateSwapChain() {
 	const RECT& hostWndRect = App::Get().GetHostWndRect();
 	const Config& config = App::Get().GetConfig();
@@ -395,6 +487,32 @@ bool DeviceResources::GetUnorderedAccessView(ID3D11Texture2D* texture, ID3D11Uno
 	}
 }
 
+void DeviceResources::ReleaseViews(ID3D11Texture2D* texture) {
+	_rtvMap.erase(texture);
+	_srvMap.erase(texture);
+	_uavMap.erase(texture);
+}
+
+TextureLoader::AsyncTexture DeviceResources::LoadSourceTexture(const std::wstring& fileName) {
+	std::wstring fileKey = TextureLoader::GetFileKey(fileName.c_str());
+	if (fileKey.empty()) {
+		// 无法确定文件是否改变，不使用缓存
+		return TextureLoader::LoadAsync(fileName);
+	}
+
+	std::scoped_lock lk(_sourceTexturesCS);
+
+	auto it = _sourceTextures.find(fileKey);
+	if (it != _sourceTextures.end()) {
+		return it->second;
+	}
+
+	// 加载失败的结果也被缓存，避免多个效果重复读取同一个损坏的文件
+	TextureLoader::AsyncTexture result = TextureLoader::LoadAsync(fileName, fileKey);
+	_sourceTextures.emplace(std::move(fileKey), result);
+	return result;
+}
+
 bool DeviceResources::CompileShader(std::string_view hlsl, const char* entryPoint, ID3DBlob** blob, const char* sourceName, ID3DInclude* include, const std::vector<std::pair<std::string, std::string>>& macros) {
 	winrt::com_ptr<ID3DBlob> errorMsgs = nullptr;
 
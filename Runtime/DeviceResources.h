@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "Utils.h"
+#include "TextureLoader.h"
 
 
 class DeviceResources {
@@ -23,6 +24,12 @@ public:
 		const D3D11_SUBRESOURCE_DATA* pInitialData = nullptr
 	);
 
+	// 估算纹理占用的显存，单位为字节。不包括驱动的对齐和填充
+	static UINT64 GetTextureSize(ID3D11Texture2D* texture);
+
+	// 本进程在本地显存中的用量和系统分配的预算，超出预算后驱动将换页，导致周期性的卡顿
+	bool QueryVideoMemoryInfo(DXGI_QUERY_VIDEO_MEMORY_INFO& info) const;
+
 	bool GetSampler(D3D11_FILTER filterMode, D3D11_TEXTURE_ADDRESS_MODE addressMode, ID3D11SamplerState** result);
 
 	bool GetRenderTargetView(ID3D11Texture2D* texture, ID3D11RenderTargetView** result);
@@ -31,6 +38,13 @@ public:
 
 	bool GetUnorderedAccessView(ID3D11Texture2D* texture, ID3D11UnorderedAccessView** result);
 
+	// 释放缓存的视图，视图持有纹理的引用，否则纹理不会被销毁
+	void ReleaseViews(ID3D11Texture2D* texture);
+
+	// 加载 SOURCE 纹理。纹理是不可变的，相同的文件在此设备上只加载一次，由所有效果共享
+	// 可以在任意线程调用
+	TextureLoader::AsyncTexture LoadSourceTexture(const std::wstring& fileName);
+
 	bool CompileShader(std::string_view hlsl, const char* entryPoint,
 		ID3DBlob** blob, const char* sourceName = nullptr, ID3DInclude* include = nullptr, const std::vector<std::pair<std::string, std::string>>& macros = {});
 
@@ -42,14 +56,25 @@ public:
 	IDXGIFactory5* GetDXGIFactory() const noexcept { return _dxgiFactory.get(); }
 	IDXGIDevice4* GetDXGIDevice() const noexcept { return _dxgiDevice.get(); }
 	IDXGIAdapter3* GetGraphicsAdapter() const noexcept { return _graphicsAdapter.get(); }
+	// 交换链可以接受新帧时触发，由 App 的消息循环等待
+	HANDLE GetFrameLatencyWaitableObject() const noexcept { return _frameLatencyWaitableObject.get(); }
 
 	void BeginFrame();
 
 	void EndFrame();
 
+	// 阻塞直到 GPU 完成所有已提交的工作
+	void WaitForGPU();
+
+	// 等待事件查询完成，期间不断刷新命令缓冲区
+	static void WaitForQuery(ID3D11DeviceContext* d3dDC, ID3D11Query* query);
+
 private:
 	bool _CreateSwapChain();
 
+	// 无窗口模式下以离屏纹理代替后缓冲区
+	bool _CreateOffscreenBackBuffer();
+
 	winrt::com_ptr<IDXGIFactory5> _dxgiFactory;
 	winrt::com_ptr<IDXGIDevice4> _dxgiDevice;
 	winrt::com_ptr<IDXGISwapChain4> _swapChain;
@@ -63,6 +88,10 @@ private:
 
 	winrt::com_ptr<ID3D11Texture2D> _backBuffer;
 
+	// 无窗口模式下没有交换链限制 CPU 领先 GPU 的帧数，以事件查询代替
+	std::array<winrt::com_ptr<ID3D11Query>, 2> _frameEndQueries;
+	UINT _endedFrameCount = 0;
+
 	std::unordered_map<ID3D11Texture2D*, winrt::com_ptr<ID3D11RenderTargetView>> _rtvMap;
 	std::unordered_map<ID3D11Texture2D*, winrt::com_ptr<ID3D11ShaderResourceView>> _srvMap;
 	std::unordered_map<ID3D11Texture2D*, winrt::com_ptr<ID3D11UnorderedAccessView>> _uavMap;
@@ -71,4 +100,9 @@ private:
 		std::pair<D3D11_FILTER, D3D11_TEXTURE_ADDRESS_MODE>,
 		winrt::com_ptr<ID3D11SamplerState>
 	> _samMap;
+
+	// 用于同步对 _sourceTextures 的访问
+	Utils::CSMutex _sourceTexturesCS;
+	// fileKey -> texture
+	std::unordered_map<std::wstring, TextureLoader::AsyncTexture> _sourceTextures;
 };
@@ -19,6 +19,7 @@
 #include "Utils.h"
 #include "StrUtils.h"
 #include "Logger.h"
+#include "FrameStatistics.h"
 
 
 #define API_DECLSPEC extern "C" __declspec(dllexport)
@@ -77,6 +78,105 @@ API_DECLSPEC BOOL WINAPI Initialize(
 	return TRUE;
 }
 
+// 须在 Run 之前调用，然后使用捕获模式 4 进行回放
+// replayPath：图像文件夹或原始帧文件，frameRate：回放帧率，0 表示不限制
+// recordPath：非空时将捕获到的帧录制为原始帧文件
+API_DECLSPEC void WINAPI SetReplayOptions(const wchar_t* replayPath, float frameRate, const wchar_t* recordPath) {
+	if (App::Get().IsSessionActive()) {
+		Logger::Get().Error("缩放、基准测试或批处理期间不能设置回放选项");
+		return;
+	}
+
+	App::ReplayOptions options;
+	options.replayPath = replayPath ? replayPath : L"";
+	options.frameRate = std::max(0.0f, frameRate);
+	options.recordPath = recordPath ? recordPath : L"";
+	App::Get().SetReplayOptions(options);
+}
+
+// 须在 Run 之前调用。fileName 非空时记录每帧 CPU 各阶段和 GPU 各通道的时间线
+// 扩展名为 .json 时输出 Chrome Trace 格式，否则输出二进制格式
+API_DECLSPEC void WINAPI SetTraceFile(const wchar_t* fileName) {
+	if (App::Get().IsSessionActive()) {
+		Logger::Get().Error("缩放、基准测试或批处理期间不能设置时间线文件");
+		return;
+	}
+
+	App::Get().SetTraceFile(fileName ? fileName : L"");
+}
+
+// 不创建窗口，将 effectsJson 渲染 frames 帧后返回 json 格式的统计结果，失败时返回空
+// 如果通过 SetReplayOptions 设置了回放路径则以其中的帧作为输入，否则使用 inputWidth x inputHeight 的合成帧
+// 返回值在下一次调用前有效
+API_DECLSPEC const char* WINAPI Benchmark(
+	const char* effectsJson,
+	UINT inputWidth,
+	UINT inputHeight,
+	UINT outputWidth,
+	UINT outputHeight,
+	UINT frames
+) {
+	// 检查在先，避免修改正在使用的 result。App::Benchmark 会再次检查
+	if (App::Get().IsSessionActive()) {
+		Logger::Get().Error("已有缩放、基准测试或批处理正在执行");
+		return nullptr;
+	}
+
+	static std::string result;
+	result.clear();
+
+	Logger::Get().Info(fmt::format("开始基准测试，输入：{}x{}，输出：{}x{}，帧数：{}",
+		inputWidth, inputHeight, outputWidth, outputHeight, frames));
+
+	if (!App::Get().Benchmark(effectsJson ? effectsJson : "", { (LONG)inputWidth, (LONG)inputHeight },
+		{ (LONG)outputWidth, (LONG)outputHeight }, frames, result)
+	) {
+		Logger::Get().Error("基准测试失败");
+		return nullptr;
+	}
+
+	Logger::Get().Info("基准测试完成");
+	return result.c_str();
+}
+
+// 不创建窗口，将 inputDir 中的所有图像通过 effectsJson 处理后以 PNG 格式保存到 outputDir，文件名不变
+// 解码、GPU 处理和编码在不同线程中重叠进行。boxWidth 和 boxHeight 相当于屏幕尺寸，用于 scale 属性
+// 返回 json 格式的统计结果，失败时返回空。返回值在下一次调用前有效
+API_DECLSPEC const char* WINAPI BatchProcess(
+	const char* effectsJson,
+	const wchar_t* inputDir,
+	const wchar_t* outputDir,
+	UINT boxWidth,
+	UINT boxHeight
+) {
+	// 检查在先，避免修改正在使用的 result。App::BatchProcess 会再次检查
+	if (App::Get().IsSessionActive()) {
+		Logger::Get().Error("已有缩放、基准测试或批处理正在执行");
+		return nullptr;
+	}
+
+	static std::string result;
+	result.clear();
+
+	if (!inputDir || !outputDir) {
+		Logger::Get().Error("未指定输入或输出文件夹");
+		return nullptr;
+	}
+
+	Logger::Get().Info(StrUtils::Concat("开始批处理，输入：", StrUtils::UTF16ToUTF8(inputDir),
+		"，输出：", StrUtils::UTF16ToUTF8(outputDir)));
+
+	if (!App::Get().BatchProcess(effectsJson ? effectsJson : "", inputDir, outputDir,
+		{ (LONG)boxWidth, (LONG)boxHeight }, result)
+	) {
+		Logger::Get().Error("批处理失败");
+		return nullptr;
+	}
+
+	Logger::Get().Info("批处理完成");
+	return result.c_str();
+}
+
 API_DECLSPEC const char* WINAPI Run(
 	HWND hwndSrc,
 	const char* effectsJson,
@@ -93,6 +193,11 @@ API_DECLSPEC const char* WINAPI Run(
 ) {
 	Logger& logger = Logger::Get();
 
+	if (App::Get().IsSessionActive()) {
+		logger.Error("已有缩放、基准测试或批处理正在执行");
+		return ErrorMessages::GENERIC;
+	}
+
 	if (!hwndSrc || !IsWindow(hwndSrc)) {
 		logger.Critical("非法的源窗口句柄");
 		return ErrorMessages::GENERIC;
@@ -136,6 +241,13 @@ API_DECLSPEC const char* WINAPI Run(
 
 
 
+// 查询当前或上一次缩放的帧时间统计，可在缩放时调用
+API_DECLSPEC void WINAPI GetFrameStatistics(FrameStatistics::Summary* summary) {
+	if (summary) {
+		*summary = App::Get().GetFrameStatistics().GetSummary();
+	}
+}
+
 API_DECLSPEC const char* WINAPI GetAllGraphicsAdapters(const char* delimiter) {
 	static std::string result;
 	result.clear();
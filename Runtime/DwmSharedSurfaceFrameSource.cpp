@@ -63,10 +63,13 @@ bool DwmSharedSurfaceFrameSource::Initialize() {
 		1
 	};
 
+	const UINT frameWidth = frameRect.right - frameRect.left;
+	const UINT frameHeight = frameRect.bottom - frameRect.top;
+
 	_output = App::Get().GetDeviceResources().CreateTexture2D(
 		DXGI_FORMAT_B8G8R8A8_UNORM,
-		frameRect.right - frameRect.left,
-		frameRect.bottom - frameRect.top,
+		frameWidth,
+		frameHeight,
 		D3D11_BIND_SHADER_RESOURCE
 	);
 	if (!_output) {
@@ -74,30 +77,59 @@ bool DwmSharedSurfaceFrameSource::Initialize() {
 		return false;
 	}
 
+	if (!_changeDetector.Initialize(frameWidth, frameHeight)) {
+		Logger::Get().Error("初始化 FrameChangeDetector 失败");
+		return false;
+	}
+
 	Logger::Get().Info("DwmSharedSurfaceFrameSource 初始化完成");
 	return true;
 }
 
 FrameSourceBase::UpdateState DwmSharedSurfaceFrameSource::Update() {
+	// 上一次捕获的帧的检测结果
+	const bool hasPendingFrame = _hasPendingFrame;
+	const bool lastFrameChanged = hasPendingFrame && _changeDetector.IsLastFrameChanged();
+	_hasPendingFrame = false;
+
 	HANDLE sharedTextureHandle = NULL;
+	ULONGLONG updateId = 0;
 	if (!_dwmGetDxSharedSurface(App::Get().GetHwndSrc(),
-		&sharedTextureHandle, nullptr, nullptr, nullptr, nullptr)
+		&sharedTextureHandle, nullptr, nullptr, nullptr, &updateId)
 		|| !sharedTextureHandle
 	) {
 		Logger::Get().Win32Error("DwmGetDxSharedSurface 失败");
 		return UpdateState::Error;
 	}
 
-	winrt::com_ptr<ID3D11Texture2D> sharedTexture;
-	HRESULT hr = App::Get().GetDeviceResources().GetD3DDevice()
-		->OpenSharedResource(sharedTextureHandle, IID_PPV_ARGS(&sharedTexture));
-	if (FAILED(hr)) {
-		Logger::Get().ComError("OpenSharedResource 失败", hr);
-		return UpdateState::Error;
+	if (sharedTextureHandle != _sharedTextureHandle) {
+		// 窗口尺寸改变等情况下 DWM 会创建新的表面
+		_sharedTexture = nullptr;
+		_sharedTextureHandle = NULL;
+
+		HRESULT hr = App::Get().GetDeviceResources().GetD3DDevice()
+			->OpenSharedResource(sharedTextureHandle, IID_PPV_ARGS(&_sharedTexture));
+		if (FAILED(hr)) {
+			Logger::Get().ComError("OpenSharedResource 失败", hr);
+			return UpdateState::Error;
+		}
+
+		_sharedTextureHandle = sharedTextureHandle;
+	} else if (updateId != 0 && updateId == _lastUpdateId) {
+		// 表面没有更新，_output 中已是最新的帧。上一次捕获的帧返回了 NoUpdate 但实际已改变时需要渲染
+		return lastFrameChanged ? UpdateState::NewFrame : UpdateState::NoUpdate;
 	}
-	
+
+	_lastUpdateId = updateId;
+
+	// 捕获的帧直接写入 _output，不增加延迟
 	App::Get().GetDeviceResources().GetD3DDC()
-		->CopySubresourceRegion(_output.get(), 0, 0, 0, 0, sharedTexture.get(), 0, &_frameInWnd);
+		->CopySubresourceRegion(_output.get(), 0, 0, 0, 0, _sharedTexture.get(), 0, &_frameInWnd);
+
+	_changeDetector.Submit(_output.get());
+	_hasPendingFrame = true;
 
-	return UpdateState::NewFrame;
+	// 上一次捕获的帧和再之前的帧相同时，假定这一帧也没有改变。猜错时
+	// 下一次 Update 会得到上一次捕获的帧已改变的结果，并返回 NewFrame
+	return hasPendingFrame && !lastFrameChanged ? UpdateState::NoUpdate : UpdateState::NewFrame;
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "FrameSourceBase.h"
+#include "FrameChangeDetector.h"
 
 
 class DwmSharedSurfaceFrameSource : public FrameSourceBase {
@@ -37,6 +38,15 @@ private:
 	_DwmGetDxSharedSurfaceFunc *_dwmGetDxSharedSurface = nullptr;
 
 	D3D11_BOX _frameInWnd{};
-	
+
+	// 缓存打开的共享纹理，只在句柄改变时重新打开
+	HANDLE _sharedTextureHandle = NULL;
+	winrt::com_ptr<ID3D11Texture2D> _sharedTexture;
+	// DWM 每次更新表面时改变，为 0 表示不支持
+	ULONGLONG _lastUpdateId = 0;
+
+	// 表面更新不代表内容改变，检测结果晚一帧
+	FrameChangeDetector _changeDetector;
+	bool _hasPendingFrame = false;
 };
 
@@ -18,7 +18,7 @@ static constexpr const size_t MAX_CACHE_COUNT = 128;
 
 // 缓存版本
 // 当缓存文件结构有更改时更新它，使旧缓存失效
-static constexpr const UINT CACHE_VERSION = 8;
+static constexpr const UINT CACHE_VERSION = 11;
 
 // 缓存的压缩等级
 static constexpr const int CACHE_COMPRESSION_LEVEL = 1;
@@ -141,6 +141,11 @@ void serialize(Archive& ar, EffectSamplerDesc& o) {
 	ar& o.filterType& o.addressType& o.name;
 }
 
+template<typename Archive>
+void serialize(Archive& ar, EffectBufferDesc& o) {
+	ar& o.name& o.source& o.size;
+}
+
 template<typename Archive>
 void serialize(Archive& ar, EffectPassDesc& o) {
 	ar& o.cso& o.inputs& o.outputs& o.numThreads[0] & o.numThreads[1] & o.numThreads[2] & o.blockSize& o.desc& o.isPSStyle;
@@ -148,7 +153,7 @@ void serialize(Archive& ar, EffectPassDesc& o) {
 
 template<typename Archive>
 void serialize(Archive& ar, EffectDesc& o) {
-	ar& o.name& o.outSizeExpr& o.params& o.textures& o.samplers& o.passes& o.flags& o.isUseDynamic;
+	ar& o.name& o.outSizeExpr& o.params& o.textures& o.samplers& o.buffers& o.passes& o.flags& o.isUseDynamic;
 }
 
 void EffectCacheManager::_AddToMemCache(const std::wstring& cacheFileName, const EffectDesc& desc) {
@@ -194,6 +199,12 @@ bool EffectCacheManager::_LoadFromMemCache(const std::wstring& cacheFileName, Ef
 }
 
 bool EffectCacheManager::Load(std::string_view effectName, std::string_view hash, EffectDesc& desc) {
+	bool result = _Load(effectName, hash, desc);
+	(result ? _hitCount : _missCount).fetch_add(1, std::memory_order_relaxed);
+	return result;
+}
+
+bool EffectCacheManager::_Load(std::string_view effectName, std::string_view hash, EffectDesc& desc) {
 	assert(!effectName.empty() && !hash.empty());
 
 	std::wstring cacheFileName = GetCacheFileName(effectName, hash, desc.flags);
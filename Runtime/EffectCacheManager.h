@@ -15,6 +15,15 @@ public:
 
 	void Save(std::string_view effectName, std::string_view hash, const EffectDesc& desc);
 
+	// 自进程启动以来 Load 成功和失败的次数
+	UINT GetHitCount() const noexcept {
+		return _hitCount.load(std::memory_order_relaxed);
+	}
+
+	UINT GetMissCount() const noexcept {
+		return _missCount.load(std::memory_order_relaxed);
+	}
+
 	// inlineParams 为内联变量，可以为空
 	// 接受 std::string& 的重载速度更快，且保证不修改 source
 	static std::string GetHash(
@@ -27,6 +36,8 @@ public:
 	);
 
 private:
+	bool _Load(std::string_view effectName, std::string_view hash, EffectDesc& desc);
+
 	void _AddToMemCache(const std::wstring& cacheFileName, const EffectDesc& desc);
 	bool _LoadFromMemCache(const std::wstring& cacheFileName, EffectDesc& desc);
 
@@ -35,4 +46,8 @@ private:
 	// cacheFileName -> (EffectDesc, lastAccess)
 	std::unordered_map<std::wstring, std::pair<EffectDesc, UINT>> _memCache;
 	UINT _lastAccess = 0;
+
+	// 效果并行编译，可能同时调用 Load
+	std::atomic<UINT> _hitCount = 0;
+	std::atomic<UINT> _missCount = 0;
 };
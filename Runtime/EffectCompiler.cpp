@@ -172,6 +172,114 @@ static UINT GetNextToken(std::string_view& source, std::string_view& value) {
 	}
 }
 
+UINT GetNextString(std::string_view& source, std::string_view& value) {
+	RemoveLeadingBlanks<false>(source);
+	size_t pos = source.find('\n');
+
+	value = source.substr(0, pos);
+	StrUtils::Trim(value);
+	if (value.empty()) {
+		return 1;
+	}
+
+	source.remove_prefix(std::min(pos + 1, source.size()));
+	return 0;
+}
+
+// 寻址方式不是 CLAMP 的采样器的名字。只做粗略的解析，格式错误由 ResolveSampler 报告
+static std::vector<std::string> GetNonClampSamplers(std::string_view source) {
+	std::vector<std::string> result;
+
+	const std::string_view metaIndicator(META_INDICATOR);
+	size_t pos = 0;
+	while ((pos = source.find(metaIndicator, pos)) != std::string_view::npos) {
+		pos += metaIndicator.size();
+
+		std::string_view block = source.substr(pos);
+		std::string_view token;
+		if (GetNextToken<false>(block, token) || StrUtils::ToUpperCase(token) != "SAMPLER") {
+			continue;
+		}
+
+		bool isClamp = true;
+		while (CheckNextToken<true>(block, META_INDICATOR)) {
+			if (GetNextToken<false>(block, token)) {
+				break;
+			}
+			std::string option = StrUtils::ToUpperCase(token);
+
+			if (GetNextString(block, token)) {
+				break;
+			}
+			if (option == "ADDRESS" && StrUtils::ToUpperCase(token) != "CLAMP") {
+				isClamp = false;
+			}
+		}
+
+		if (!isClamp && CheckNextToken<true>(block, "SamplerState") && !GetNextToken<true>(block, token)) {
+			result.emplace_back(token);
+		}
+	}
+
+	return result;
+}
+
+// 带偏移的 INPUT 通过结构体模拟，只支持成员函数调用
+// 将 INPUT 作为参数传递的效果（如 FXAA、SMAA）无法使用
+// 模拟的采样总是使用 CLAMP 寻址，因此用其他寻址方式的采样器采样 INPUT 的效果也无法使用
+static bool IsInputOffsetSupported(std::string_view source) {
+	static constexpr std::string_view INPUT_NAME = "INPUT";
+
+	const std::vector<std::string> nonClampSamplers = GetNonClampSamplers(source);
+
+	auto isIdChar = [](char c) {
+		return StrUtils::isalnum(c) || c == '_';
+	};
+
+	size_t pos = 0;
+	while ((pos = source.find(INPUT_NAME, pos)) != std::string_view::npos) {
+		size_t end = pos + INPUT_NAME.size();
+		if ((pos > 0 && isIdChar(source[pos - 1])) || (end < source.size() && isIdChar(source[end]))) {
+			pos = end;
+			continue;
+		}
+
+		size_t lineStart = source.rfind('\n', pos);
+		lineStart = lineStart == std::string_view::npos ? 0 : lineStart + 1;
+		std::string_view prefix = source.substr(lineStart, pos - lineStart);
+		StrUtils::Trim(prefix);
+
+		// 跳过 //!IN INPUT 之类的指令和纹理声明
+		if (prefix.starts_with(META_INDICATOR) || prefix.ends_with("Texture2D") || prefix.ends_with('>')) {
+			pos = end;
+			continue;
+		}
+
+		while (end < source.size() && StrUtils::isspace(source[end])) {
+			++end;
+		}
+		if (end >= source.size() || source[end] != '.') {
+			return false;
+		}
+
+		if (!nonClampSamplers.empty()) {
+			// Load 和 GetDimensions 不使用采样器，其他成员函数的第一个参数是采样器
+			std::string_view call = source.substr(end + 1);
+			std::string_view token;
+			if (!GetNextToken<true>(call, token) && token != "Load" && token != "GetDimensions"
+				&& CheckNextToken<true>(call, "(") && !GetNextToken<true>(call, token)
+				&& std::find(nonClampSamplers.begin(), nonClampSamplers.end(), token) != nonClampSamplers.end()
+			) {
+				return false;
+			}
+		}
+
+		pos = end;
+	}
+
+	return true;
+}
+
 bool CheckMagic(std::string_view& source) {
 	std::string_view token;
 	if (!CheckNextToken<true>(source, META_INDICATOR)) {
@@ -196,20 +304,6 @@ bool CheckMagic(std::string_view& source) {
 	return true;
 }
 
-UINT GetNextString(std::string_view& source, std::string_view& value) {
-	RemoveLeadingBlanks<false>(source);
-	size_t pos = source.find('\n');
-
-	value = source.substr(0, pos);
-	StrUtils::Trim(value);
-	if (value.empty()) {
-		return 1;
-	}
-
-	source.remove_prefix(std::min(pos + 1, source.size()));
-	return 0;
-}
-
 template<typename T>
 static UINT GetNextNumber(std::string_view& source, T& value) {
 	RemoveLeadingBlanks<false>(source);
@@ -749,6 +843,92 @@ UINT ResolveSampler(std::string_view block, EffectDesc& desc) {
 	return 0;
 }
 
+UINT ResolveBuffer(std::string_view block, EffectDesc& desc) {
+	// 必选项：SOURCE
+
+	EffectBufferDesc& bufDesc = desc.buffers.emplace_back();
+
+	std::string_view token;
+
+	if (!CheckNextToken<true>(block, META_INDICATOR)) {
+		return 1;
+	}
+
+	if (!CheckNextToken<false>(block, "BUFFER")) {
+		return 1;
+	}
+	if (GetNextToken<false>(block, token) != 2) {
+		return 1;
+	}
+
+	while (true) {
+		if (!CheckNextToken<true>(block, META_INDICATOR)) {
+			break;
+		}
+
+		if (GetNextToken<false>(block, token)) {
+			return 1;
+		}
+
+		std::string t = StrUtils::ToUpperCase(token);
+
+		if (t == "SOURCE") {
+			if (!bufDesc.source.empty()) {
+				return 1;
+			}
+
+			if (GetNextString(block, token)) {
+				return 1;
+			}
+
+			bufDesc.source = token;
+		} else {
+			return 1;
+		}
+	}
+
+	if (bufDesc.source.empty()) {
+		return 1;
+	}
+
+	// 代码部分，只支持 float4 数组
+	if (!CheckNextToken<true>(block, "float4")) {
+		return 1;
+	}
+
+	if (GetNextToken<true>(block, token)) {
+		return 1;
+	}
+
+	bufDesc.name = token;
+
+	if (!CheckNextToken<true>(block, "[")) {
+		return 1;
+	}
+
+	if (GetNextNumber(block, bufDesc.size)) {
+		return 1;
+	}
+
+	if (bufDesc.size == 0 || bufDesc.size > D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT) {
+		return 1;
+	}
+
+	if (!CheckNextToken<true>(block, "]")) {
+		return 1;
+	}
+
+	if (!CheckNextToken<true>(block, ";")) {
+		return 1;
+	}
+
+	if (GetNextToken<true>(block, token) != 2) {
+		return 1;
+	}
+
+	return 0;
+}
+
 UINT ResolveCommon(std::string_view& block) {
 	// 无选项
 
@@ -1065,8 +1245,17 @@ UINT GeneratePassSource(
 	////////////////////////////////////////////////////////////////////////////////////////////////////////
 	
 	// SRV
+	bool isInputOffset = false;
 	for (int i = 0; i < passDesc.inputs.size(); ++i) {
 		auto& texDesc = desc.textures[passDesc.inputs[i]];
+
+		if (passDesc.inputs[i] == 0 && (desc.flags & EFFECT_FLAG_INPUT_OFFSET)) {
+			// INPUT 由下面的 __InputTexture 模拟
+			isInputOffset = true;
+			result.append(fmt::format("Texture2D<float4> __INPUT : register(t{});\n", i));
+			continue;
+		}
+
 		result.append(fmt::format("Texture2D<{}> {} : register(t{});\n", EffectIntermediateTextureDesc::FORMAT_DESCS[(UINT)texDesc.format].srvTexelType, texDesc.name, i));
 	}
 
@@ -1216,7 +1405,8 @@ UINT GeneratePassSource(
 	color = saturate(color);
 	pos += __offset.zw;
 	if ((int)pos.x >= __cursorRect.x && (int)pos.y >= __cursorRect.y && (int)pos.x < __cursorRect.z && (int)pos.y < __cursorRect.w) {
-		float4 mask = __CURSOR.SampleLevel(__CURSOR_SAMPLER, (pos - __cursorRect.xy + 0.5f) * __cursorPt, 0);
+		float2 cursorUV = (pos - __cursorRect.xy + 0.5f) * __cursorPt + __cursorAtlasOffset;
+		float4 mask = __CURSOR.SampleLevel(__CURSOR_SAMPLER, clamp(cursorUV, __cursorAtlasClamp.xy, __cursorAtlasClamp.zw), 0);
 		if (__cursorType == 0){
 			color = color * mask.a + mask.rgb;
 		} else if (__cursorType == 1) {
@@ -1257,6 +1447,64 @@ float2 GetOutputPt() { return __outputPt; }
 float2 GetScale() { return __scale; }
 )");
 
+	if (std::any_of(desc.textures.begin(), desc.textures.end(), [](const EffectIntermediateTextureDesc& texDesc) {
+		return texDesc.format == EffectIntermediateTextureFormat::R32G32B32A32_UINT;
+	})) {
+		// 8 个半精度通道打包在 uint4 中：低 16 位为前 4 个通道，高 16 位为后 4 个通道
+		result.append(R"(void UnpackHalf8(uint4 v, out float4 lo, out float4 hi) { lo = f16tof32(v); hi = f16tof32(v >> 16); }
+uint4 PackHalf8(float4 lo, float4 hi) { return f32tof16(lo) | (f32tof16(hi) << 16); }
+void LoadHalf8(Texture2D<uint4> tex, int2 pos, out float4 lo, out float4 hi) { UnpackHalf8(tex.Load(int3(pos, 0)), lo, hi); }
+)");
+	}
+
+	if (isInputOffset) {
+		// 将 INPUT 上的坐标映射到捕获到的纹理中，并模拟 CLAMP 寻址和越界读取，使结果和复制后的纹理一致
+		result.append(R"(float4 __SampleInput(SamplerState s, float2 pos, float lod) {
+	pos = clamp(pos, 0.5f * __inputPt, 1.0f - 0.5f * __inputPt);
+	return __INPUT.SampleLevel(s, (pos * __inputSize + __inputOffset) * __inputTexPt, lod);
+}
+float4 __GatherInput(SamplerState s, float2 pos, uint c) {
+	int2 p = (int2)floor(pos * __inputSize - 0.5f);
+	if (all(p >= 0 && p + 1 < (int2)__inputSize)) {
+		float2 uv = (pos * __inputSize + __inputOffset) * __inputTexPt;
+		switch (c) {
+		case 0: return __INPUT.GatherRed(s, uv);
+		case 1: return __INPUT.GatherGreen(s, uv);
+		case 2: return __INPUT.GatherBlue(s, uv);
+		default: return __INPUT.GatherAlpha(s, uv);
+		}
+	}
+	int2 p0 = clamp(p, 0, (int2)__inputSize - 1) + __inputOffset;
+	int2 p1 = clamp(p + 1, 0, (int2)__inputSize - 1) + __inputOffset;
+	return float4(__INPUT.Load(int3(p0.x, p1.y, 0))[c], __INPUT.Load(int3(p1, 0))[c], __INPUT.Load(int3(p1.x, p0.y, 0))[c], __INPUT.Load(int3(p0, 0))[c]);
+}
+float4 __LoadInput(int3 pos) {
+	if (any(pos.xy < 0 || pos.xy >= (int2)__inputSize)) {
+		return 0;
+	}
+	return __INPUT.Load(int3(pos.xy + __inputOffset, pos.z));
+}
+struct __InputTexture {
+	float4 SampleLevel(SamplerState s, float2 pos, float lod) { return __SampleInput(s, pos, lod); }
+	float4 SampleLevel(SamplerState s, float2 pos, float lod, int2 offset) { return __SampleInput(s, pos + offset * __inputPt, lod); }
+	float4 Gather(SamplerState s, float2 pos) { return __GatherInput(s, pos, 0); }
+	float4 Gather(SamplerState s, float2 pos, int2 offset) { return __GatherInput(s, pos + offset * __inputPt, 0); }
+	float4 GatherRed(SamplerState s, float2 pos) { return __GatherInput(s, pos, 0); }
+	float4 GatherRed(SamplerState s, float2 pos, int2 offset) { return __GatherInput(s, pos + offset * __inputPt, 0); }
+	float4 GatherGreen(SamplerState s, float2 pos) { return __GatherInput(s, pos, 1); }
+	float4 GatherGreen(SamplerState s, float2 pos, int2 offset) { return __GatherInput(s, pos + offset * __inputPt, 1); }
+	float4 GatherBlue(SamplerState s, float2 pos) { return __GatherInput(s, pos, 2); }
+	float4 GatherBlue(SamplerState s, float2 pos, int2 offset) { return __GatherInput(s, pos + offset * __inputPt, 2); }
+	float4 GatherAlpha(SamplerState s, float2 pos) { return __GatherInput(s, pos, 3); }
+	float4 GatherAlpha(SamplerState s, float2 pos, int2 offset) { return __GatherInput(s, pos + offset * __inputPt, 3); }
+	float4 Load(int3 pos) { return __LoadInput(pos); }
+	float4 Load(int3 pos, int2 offset) { return __LoadInput(int3(pos.xy + offset, pos.z)); }
+	void GetDimensions(out uint width, out uint height) { width = __inputSize.x; height = __inputSize.y; }
+};
+static __InputTexture INPUT;
+)");
+	}
+
 	if (desc.isUseDynamic) {
 		result.append(R"(uint GetFrameCount() { return __frameCount; }
 uint2 GetCursorPos() { return __cursorPos; }
@@ -1440,6 +1688,8 @@ UINT CompilePasses(
 	uint2 __cursorPos;
 	uint __cursorType;
 	uint __frameCount;
+	float2 __cursorAtlasOffset;
+	float4 __cursorAtlasClamp;
 };
 cbuffer __CB2 : register(b1) {
 	uint2 __inputSize;
@@ -1455,6 +1705,11 @@ cbuffer __CB2 : register(b1) {
 		cbHlsl.append("\tint4 __offset;\n");
 	}
 
+	if (desc.flags & EFFECT_FLAG_INPUT_OFFSET) {
+		// INPUT 在捕获到的纹理中的位置
+		cbHlsl.append("\tint2 __inputOffset;\n\tfloat2 __inputTexPt;\n");
+	}
+
 	// PS 样式需要获知输出纹理的尺寸
 	// 最后一个通道不需要
 	for (UINT i = 0, end = (UINT)desc.passes.size() - 1; i < end; ++i) {
@@ -1472,7 +1727,15 @@ cbuffer __CB2 : register(b1) {
 		}
 	}
 
-	cbHlsl.append("};\n\n");
+	cbHlsl.append("};\n");
+
+	// BUFFER 块从 b2 开始
+	for (size_t i = 0; i < desc.buffers.size(); ++i) {
+		const EffectBufferDesc& bufDesc = desc.buffers[i];
+		cbHlsl.append(fmt::format("cbuffer __BUFFER_{0} : register(b{1}) {{\n\tfloat4 {0}[{2}];\n}};\n", bufDesc.name, i + 2, bufDesc.size));
+	}
+
+	cbHlsl.push_back('\n');
 
 	if (App::Get().GetConfig().IsSaveEffectSources() && !Utils::DirExists(SAVE_SOURCE_DIR)) {
 		if (!CreateDirectory(SAVE_SOURCE_DIR, nullptr)) {
@@ -1519,11 +1782,24 @@ cbuffer __CB2 : register(b1) {
 }
 
 
+static void LoadSourceTexture(const EffectDesc& desc, size_t idx, std::vector<TextureLoader::AsyncTexture>& sourceTextures) {
+	const std::string& source = desc.textures[idx].source;
+	if (source.empty()) {
+		return;
+	}
+
+	if (sourceTextures.size() <= idx) {
+		sourceTextures.resize(idx + 1);
+	}
+	sourceTextures[idx] = App::Get().GetDeviceResources().LoadSourceTexture(L"effects\\" + StrUtils::UTF8ToUTF16(source));
+}
+
 UINT EffectCompiler::Compile(
 	std::string_view effectName,
 	UINT flags,
 	const std::map<std::string, std::variant<float, int>>& inlineParams,
-	EffectDesc& desc
+	EffectDesc& desc,
+	std::vector<TextureLoader::AsyncTexture>* sourceTextures
 ) {
 	desc = {};
 	desc.name = effectName;
@@ -1548,12 +1824,24 @@ UINT EffectCompiler::Compile(
 		return 1;
 	}
 
+	if ((flags & EFFECT_FLAG_INPUT_OFFSET) && !IsInputOffsetSupported(source)) {
+		// 回落到复制捕获到的帧，调用者应检查 desc.flags
+		Logger::Get().Info(fmt::format("{} 不支持带偏移的输入", effectName));
+		flags &= ~EFFECT_FLAG_INPUT_OFFSET;
+		desc.flags = flags;
+	}
+
 	std::string hash;
 	if (!App::Get().GetConfig().IsDisableEffectCache()) {
 		hash = EffectCacheManager::GetHash(source, flags & EFFECT_FLAG_INLINE_PARAMETERS ? &inlineParams : nullptr);
 		if (!hash.empty()) {
 			if (EffectCacheManager::Get().Load(effectName, hash, desc)) {
 				// 已从缓存中读取
+				if (sourceTextures) {
+					for (size_t i = 0; i < desc.textures.size(); ++i) {
+						LoadSourceTexture(desc, i, *sourceTextures);
+					}
+				}
 				return 0;
 			}
 		}
@@ -1572,6 +1860,7 @@ UINT EffectCompiler::Compile(
 		Constant,
 		Texture,
 		Sampler,
+		Buffer,
 		Common,
 		Pass
 	};
@@ -1580,6 +1869,7 @@ UINT EffectCompiler::Compile(
 	std::vector<std::string_view> paramBlocks;
 	std::vector<std::string_view> textureBlocks;
 	std::vector<std::string_view> samplerBlocks;
+	std::vector<std::string_view> bufferBlocks;
 	std::vector<std::string_view> commonBlocks;
 	std::vector<std::string_view> passBlocks;
 
@@ -1600,6 +1890,9 @@ UINT EffectCompiler::Compile(
 		case BlockType::Sampler:
 			samplerBlocks.push_back(sourceView.substr(curBlockOff, len));
 			break;
+		case BlockType::Buffer:
+			bufferBlocks.push_back(sourceView.substr(curBlockOff, len));
+			break;
 		case BlockType::Common:
 			commonBlocks.push_back(sourceView.substr(curBlockOff, len));
 			break;
@@ -1635,6 +1928,8 @@ UINT EffectCompiler::Compile(
 					completeCurrentBlock(len, BlockType::Texture);
 				} else if (blockType == "SAMPLER") {
 					completeCurrentBlock(len, BlockType::Sampler);
+				} else if (blockType == "BUFFER") {
+					completeCurrentBlock(len, BlockType::Buffer);
 				} else if (blockType == "COMMON") {
 					completeCurrentBlock(len, BlockType::Common);
 				} else if (blockType == "PASS") {
@@ -1686,6 +1981,10 @@ UINT EffectCompiler::Compile(
 			Logger::Get().Error(fmt::format("解析 Texture#{} 块失败", i + 1));
 			return 1;
 		}
+
+		if (sourceTextures) {
+			LoadSourceTexture(desc, desc.textures.size() - 1, *sourceTextures);
+		}
 	}
 
 	for (size_t i = 0; i < samplerBlocks.size(); ++i) {
@@ -1695,6 +1994,19 @@ UINT EffectCompiler::Compile(
 		}
 	}
 
+	// b0 和 b1 已被占用
+	if (bufferBlocks.size() > D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 2) {
+		Logger::Get().Error("Buffer 块过多");
+		return 1;
+	}
+
+	for (size_t i = 0; i < bufferBlocks.size(); ++i) {
+		if (ResolveBuffer(bufferBlocks[i], desc)) {
+			Logger::Get().Error(fmt::format("解析 Buffer#{} 块失败", i + 1));
+			return 1;
+		}
+	}
+
 	{
 		// 确保没有重复的名字
 		std::unordered_set<std::string> names;
@@ -1719,6 +2031,13 @@ UINT EffectCompiler::Compile(
 			}
 			names.insert(d.name);
 		}
+		for (const auto& d : desc.buffers) {
+			if (names.find(d.name) != names.end()) {
+				Logger::Get().Error("标识符重复");
+				return 1;
+			}
+			names.insert(d.name);
+		}
 	}
 
 	for (size_t i = 0; i < commonBlocks.size(); ++i) {
@@ -1,17 +1,21 @@
 #pragma once
 #include "pch.h"
 #include "EffectDesc.h"
+#include "TextureLoader.h"
 
 
 class EffectCompiler {
 public:
 	EffectCompiler() = default;
 
+	// sourceTextures 非空时在解析到 SOURCE 纹理后立即开始异步加载，和着色器编译同时进行
+	// 结果的索引和 desc.textures 相同，不是 SOURCE 纹理的元素为空
 	static UINT Compile(
 		std::string_view effectName,
 		UINT flags,
 		const std::map<std::string, std::variant<float, int>>& inlineParams,
-		EffectDesc& desc
+		EffectDesc& desc,
+		std::vector<TextureLoader::AsyncTexture>* sourceTextures = nullptr
 	);
 
 	// 当前 MagpieFX 版本
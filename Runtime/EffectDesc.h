@@ -24,6 +24,8 @@ enum class EffectIntermediateTextureFormat {
 	R16_SNORM,
 	R8_UNORM,
 	R8_SNORM,
+	// 每个通道存储两个半精度浮点数，共 8 个通道。不能采样，使用 LoadHalf8 读取，PackHalf8 打包后写入
+	R32G32B32A32_UINT,
 	UNKNOWN
 };
 
@@ -62,10 +64,20 @@ struct EffectIntermediateTextureDesc {
 		{"R16_SNORM", DXGI_FORMAT_R16_SNORM,1, "float", "snorm float"},
 		{"R8_UNORM", DXGI_FORMAT_R8_UNORM, 1, "float", "unorm float"},
 		{"R8_SNORM", DXGI_FORMAT_R8_SNORM, 1, "float", "snorm float"},
+		{"R32G32B32A32_UINT", DXGI_FORMAT_R32G32B32A32_UINT, 8, "uint4", "uint4"},
 		{"UNKNOWN", DXGI_FORMAT_UNKNOWN, 4, "float4", "float4"}
 	};
 };
 
+// 只读的常量缓冲区，用于存放 CNN 权重等大量常量。相比内联在着色器中可以大大缩短编译时间
+struct EffectBufferDesc {
+	std::string name;
+	// 相对于 effects 文件夹的路径，内容为小端序的 float4 数组
+	std::string source;
+	// float4 的数量
+	UINT size = 0;
+};
+
 enum class EffectSamplerFilterType {
 	Linear,
 	Point
@@ -109,7 +121,9 @@ struct EffectPassDesc {
 enum EffectFlags {
 	EFFECT_FLAG_LAST_EFFECT = 0x1,
 	EFFECT_FLAG_INLINE_PARAMETERS = 0x2,
-	EFFECT_FLAG_FP16 = 0x4
+	EFFECT_FLAG_FP16 = 0x4,
+	// INPUT 是更大的纹理中的一块区域，用于零拷贝
+	EFFECT_FLAG_INPUT_OFFSET = 0x8
 };
 
 struct EffectDesc {
@@ -121,6 +135,7 @@ struct EffectDesc {
 	std::vector<EffectParameterDesc> params;
 	std::vector<EffectIntermediateTextureDesc> textures;
 	std::vector<EffectSamplerDesc> samplers;
+	std::vector<EffectBufferDesc> buffers;
 
 	std::vector<EffectPassDesc> passes;
 
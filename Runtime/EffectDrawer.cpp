@@ -11,6 +11,7 @@
 #include <unordered_set>
 #include "Config.h"
 #include "GPUTimer.h"
+#include "FrameSourceBase.h"
 
 #pragma push_macro("_UNICODE")
 #undef _UNICODE
@@ -19,36 +20,40 @@
 #pragma pop_macro("_UNICODE")
 
 
-bool EffectDrawer::Initialize(
-	const EffectDesc& desc,
-	const EffectParams& params,
-	ID3D11Texture2D* inputTex,
-	ID3D11Texture2D** outputTex,
-	RECT* outputRect,
-	RECT* virtualOutputRect
-) {
-	_desc = desc;
+// 中间纹理和输出尺寸的表达式共用
+static mu::Parser exprParser;
 
-	SIZE inputSize{};
-	{
-		D3D11_TEXTURE2D_DESC inputDesc;
-		inputTex->GetDesc(&inputDesc);
-		inputSize = { (LONG)inputDesc.Width, (LONG)inputDesc.Height };
-	}
 
-	const SIZE hostSize = Utils::GetSizeOfRect(App::Get().GetHostWndRect());;
-	bool isLastEffect = desc.flags & EFFECT_FLAG_LAST_EFFECT;
-	bool isInlineParams = desc.flags & EFFECT_FLAG_INLINE_PARAMETERS;
+EffectDrawer::~EffectDrawer() {
+	if (_textures.empty()) {
+		return;
+	}
 
+	// INPUT 和后缓冲区不属于此效果，SOURCE 纹理由 DeviceResources 共享
 	DeviceResources& dr = App::Get().GetDeviceResources();
-	auto d3dDevice = dr.GetD3DDevice();
+	const size_t end = (_desc.flags & EFFECT_FLAG_LAST_EFFECT) ? _textures.size() - 1 : _textures.size();
+	for (size_t i = 1; i < end; ++i) {
+		if (i < _desc.textures.size() && !_desc.textures[i].source.empty()) {
+			continue;
+		}
+
+		if (_textures[i]) {
+			dr.ReleaseViews(_textures[i].get());
+		}
+	}
+}
+
+bool EffectDrawer::CalcOutputSize(
+	const EffectDesc& desc,
+	const EffectParams& params,
+	SIZE inputSize,
+	SIZE& outputSize
+) {
+	const SIZE hostSize = Utils::GetSizeOfRect(App::Get().GetHostWndRect());
 
-	static mu::Parser exprParser;
 	exprParser.DefineConst("INPUT_WIDTH", inputSize.cx);
 	exprParser.DefineConst("INPUT_HEIGHT", inputSize.cy);
 
-	SIZE outputSize{};
-
 	if (desc.outSizeExpr.first.empty()) {
 		if (params.scale.has_value()) {
 			outputSize = hostSize;
@@ -104,6 +109,45 @@ bool EffectDrawer::Initialize(
 		return false;
 	}
 
+	return true;
+}
+
+bool EffectDrawer::Initialize(
+	const EffectDesc& desc,
+	const EffectParams& params,
+	std::span<const TextureLoader::AsyncTexture> sourceTextures,
+	ID3D11Texture2D* inputTex,
+	ID3D11Texture2D** outputTex,
+	RECT* outputRect,
+	RECT* virtualOutputRect,
+	bool lowPrecisionTextures
+) {
+	_desc = desc;
+
+	const SIZE hostSize = Utils::GetSizeOfRect(App::Get().GetHostWndRect());;
+	bool isLastEffect = desc.flags & EFFECT_FLAG_LAST_EFFECT;
+	bool isInlineParams = desc.flags & EFFECT_FLAG_INLINE_PARAMETERS;
+	bool isInputOffset = desc.flags & EFFECT_FLAG_INPUT_OFFSET;
+
+	SIZE inputSize{};
+	if (isInputOffset) {
+		// 零拷贝，输入纹理每帧都可能改变，在 Draw 中绑定
+		const D3D11_BOX& inputBox = App::Get().GetFrameSource().GetOutputBox();
+		inputSize = { LONG(inputBox.right - inputBox.left), LONG(inputBox.bottom - inputBox.top) };
+	} else {
+		D3D11_TEXTURE2D_DESC inputDesc;
+		inputTex->GetDesc(&inputDesc);
+		inputSize = { (LONG)inputDesc.Width, (LONG)inputDesc.Height };
+	}
+
+	DeviceResources& dr = App::Get().GetDeviceResources();
+	auto d3dDevice = dr.GetD3DDevice();
+
+	SIZE outputSize{};
+	if (!CalcOutputSize(desc, params, inputSize, outputSize)) {
+		return false;
+	}
+
 	exprParser.DefineConst("OUTPUT_WIDTH", outputSize.cx);
 	exprParser.DefineConst("OUTPUT_HEIGHT", outputSize.cy);
 
@@ -120,6 +164,37 @@ bool EffectDrawer::Initialize(
 		}
 	}
 
+	// 从文件加载 BUFFER 块的内容
+	_buffers.resize(desc.buffers.size());
+	for (size_t i = 0; i < _buffers.size(); ++i) {
+		const EffectBufferDesc& bufDesc = desc.buffers[i];
+
+		std::vector<BYTE> data;
+		if (!Utils::ReadFile((L"effects\\" + StrUtils::UTF8ToUTF16(bufDesc.source)).c_str(), data)) {
+			Logger::Get().Error(fmt::format("读取 {} 失败", bufDesc.source));
+			return false;
+		}
+
+		if (data.size() != (size_t)bufDesc.size * 16) {
+			Logger::Get().Error(fmt::format("{} 的大小与声明的不符", bufDesc.source));
+			return false;
+		}
+
+		D3D11_BUFFER_DESC bd{};
+		bd.Usage = D3D11_USAGE_IMMUTABLE;
+		bd.ByteWidth = (UINT)data.size();
+		bd.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+
+		D3D11_SUBRESOURCE_DATA initData{};
+		initData.pSysMem = data.data();
+
+		HRESULT hr = dr.GetD3DDevice()->CreateBuffer(&bd, &initData, _buffers[i].put());
+		if (FAILED(hr)) {
+			Logger::Get().ComError("CreateBuffer 失败", hr);
+			return false;
+		}
+	}
+
 	// 创建中间纹理
 	// 第一个为 INPUT，最后一个为 OUTPUT
 	_textures.resize(desc.textures.size() + 1);
@@ -129,7 +204,11 @@ bool EffectDrawer::Initialize(
 
 		if (!texDesc.source.empty()) {
 			// 从文件加载纹理
-			_textures[i] = TextureLoader::Load((L"effects\\" + StrUtils::UTF8ToUTF16(texDesc.source)).c_str());
+			if (i < sourceTextures.size() && sourceTextures[i].valid()) {
+				_textures[i] = sourceTextures[i].get();
+			} else {
+				_textures[i] = App::Get().GetDeviceResources().LoadSourceTexture(L"effects\\" + StrUtils::UTF8ToUTF16(texDesc.source)).get();
+			}
 			if (!_textures[i]) {
 				Logger::Get().Error(fmt::format("加载纹理 {} 失败", texDesc.source));
 				return false;
@@ -162,8 +241,26 @@ bool EffectDrawer::Initialize(
 				return false;
 			}
 
+			DXGI_FORMAT format = EffectIntermediateTextureDesc::FORMAT_DESCS[(UINT)texDesc.format].dxgiFormat;
+			if (lowPrecisionTextures) {
+				// 着色器中的类型不变，只降低存储精度
+				switch (format) {
+				case DXGI_FORMAT_R32G32B32A32_FLOAT:
+					format = DXGI_FORMAT_R16G16B16A16_FLOAT;
+					break;
+				case DXGI_FORMAT_R32G32_FLOAT:
+					format = DXGI_FORMAT_R16G16_FLOAT;
+					break;
+				case DXGI_FORMAT_R32_FLOAT:
+					format = DXGI_FORMAT_R16_FLOAT;
+					break;
+				default:
+					break;
+				}
+			}
+
 			_textures[i] = dr.CreateTexture2D(
-				EffectIntermediateTextureDesc::FORMAT_DESCS[(UINT)texDesc.format].dxgiFormat,
+				format,
 				texSize.cx,
 				texSize.cy,
 				D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_UNORDERED_ACCESS
@@ -192,6 +289,16 @@ bool EffectDrawer::Initialize(
 		_textures.back().copy_from(dr.GetBackBuffer());
 	}
 
+	for (size_t i = 1; i < _textures.size(); ++i) {
+		if (i == _textures.size() - 1) {
+			if (!isLastEffect) {
+				_textureMemory.push_back({ "OUTPUT", DeviceResources::GetTextureSize(_textures[i].get()) });
+			}
+		} else {
+			_textureMemory.push_back({ desc.textures[i].name, DeviceResources::GetTextureSize(_textures[i].get()) });
+		}
+	}
+
 	*outputTex = _textures.back().get();
 
 	_shaders.resize(desc.passes.size());
@@ -209,6 +316,10 @@ bool EffectDrawer::Initialize(
 
 		_srvs[i].resize(passDesc.inputs.size());
 		for (UINT j = 0; j < passDesc.inputs.size(); ++j) {
+			if (isInputOffset && passDesc.inputs[j] == 0) {
+				continue;
+			}
+
 			if (!dr.GetShaderResourceView(_textures[passDesc.inputs[j]].get(), &_srvs[i][j])) {
 				Logger::Get().Error("GetShaderResourceView 失败");
 				return false;
@@ -264,6 +375,9 @@ bool EffectDrawer::Initialize(
 
 	// 大小必须为 4 的倍数
 	size_t builtinConstantCount = isLastEffect ? 16 : 12;
+	if (isInputOffset) {
+		builtinConstantCount += 4;
+	}
 	size_t psStylePassParams = 0;
 	for (UINT i = 0, end = (UINT)desc.passes.size() - 1; i < end; ++i) {
 		if (desc.passes[i].isPSStyle) {
@@ -279,6 +393,8 @@ bool EffectDrawer::Initialize(
 	//     float2 __scale;
 	//     int2 __viewport;
 	//     [uint4 __offset;]
+	//     [int2 __inputOffset;]
+	//     [float2 __inputTexPt;]
 	//     [PARAMETERS...]
 	// );
 	_constants[0].uintVal = inputSize.cx;
@@ -323,6 +439,18 @@ bool EffectDrawer::Initialize(
 		_constants[11].intVal = outputSize.cy;
 	}
 
+	if (isInputOffset) {
+		const FrameSourceBase& frameSource = App::Get().GetFrameSource();
+		const D3D11_BOX& inputBox = frameSource.GetOutputBox();
+		const SIZE inputTexSize = frameSource.GetOutputTextureSize();
+
+		size_t idx = isLastEffect ? 16 : 12;
+		_constants[idx].intVal = inputBox.left;
+		_constants[idx + 1].intVal = inputBox.top;
+		_constants[idx + 2].floatVal = 1.0f / inputTexSize.cx;
+		_constants[idx + 3].floatVal = 1.0f / inputTexSize.cy;
+	}
+
 	if (outputRect) {
 		*outputRect = outputRect1;
 	}
@@ -431,14 +559,32 @@ bool EffectDrawer::Initialize(
 	return true;
 }
 
-void EffectDrawer::Draw(UINT& idx, bool noUpdate) {
+UINT64 EffectDrawer::GetTotalTextureMemory() const noexcept {
+	UINT64 result = 0;
+	for (const TextureMemory& texture : _textureMemory) {
+		result += texture.size;
+	}
+	return result;
+}
+
+void EffectDrawer::Draw(GPUTimer* gpuTimer, UINT& idx, bool noUpdate) {
 	auto d3dDC = App::Get().GetDeviceResources().GetD3DDC();
-	auto& gpuTimer = App::Get().GetRenderer().GetGPUTimer();
+
+	if (_desc.flags & EFFECT_FLAG_INPUT_OFFSET) {
+		_UpdateInputSrv();
+	}
 
 	{
 		ID3D11Buffer* t = _constantBuffer.get();
 		d3dDC->CSSetConstantBuffers(1, 1, &t);
 	}
+	if (!_buffers.empty()) {
+		std::array<ID3D11Buffer*, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT> t{};
+		for (size_t i = 0; i < _buffers.size(); ++i) {
+			t[i] = _buffers[i].get();
+		}
+		d3dDC->CSSetConstantBuffers(2, (UINT)_buffers.size(), t.data());
+	}
 	d3dDC->CSSetSamplers(0, (UINT)_samplers.size(), _samplers.data());
 
 	for (UINT i = 0; i < _dispatches.size(); ++i) {
@@ -448,7 +594,35 @@ void EffectDrawer::Draw(UINT& idx, bool noUpdate) {
 		}
 
 		// 不渲染的通道也在 GPUTimer 中记录
-		gpuTimer.OnEndPass(idx++);
+		if (gpuTimer) {
+			gpuTimer->OnEndPass(idx);
+		}
+		++idx;
+	}
+}
+
+void EffectDrawer::_UpdateInputSrv() {
+	ID3D11Texture2D* inputTex = App::Get().GetFrameSource().GetOutput();
+	if (inputTex == _textures[0].get()) {
+		return;
+	}
+
+	// DeviceResources 缓存了每个纹理的 SRV，因此帧缓冲池中的每个缓冲区只会创建一次
+	ID3D11ShaderResourceView* inputSrv = nullptr;
+	if (!App::Get().GetDeviceResources().GetShaderResourceView(inputTex, &inputSrv)) {
+		Logger::Get().Error("GetShaderResourceView 失败");
+		return;
+	}
+
+	_textures[0].copy_from(inputTex);
+
+	for (UINT i = 0; i < _desc.passes.size(); ++i) {
+		const std::vector<UINT>& inputs = _desc.passes[i].inputs;
+		for (UINT j = 0; j < inputs.size(); ++j) {
+			if (inputs[j] == 0) {
+				_srvs[i][j] = inputSrv;
+			}
+		}
 	}
 }
 
@@ -464,7 +638,8 @@ void EffectDrawer::_DrawPass(UINT i) {
 		if (cm.HasCursor()) {
 			ID3D11Texture2D* cursorTex;
 			CursorManager::CursorType ct;
-			if (cm.GetCursorTexture(&cursorTex, ct)) {
+			RECT atlasRect;
+			if (cm.GetCursorTexture(&cursorTex, ct, atlasRect)) {
 				if (!App::Get().GetDeviceResources().GetShaderResourceView(cursorTex, &_srvs[i].back())) {
 					Logger::Get().Error("GetShaderResourceView 出错");
 				}
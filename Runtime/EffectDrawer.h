@@ -1,6 +1,9 @@
 #pragma once
 #include "pch.h"
 #include "EffectDesc.h"
+#include "TextureLoader.h"
+
+class GPUTimer;
 
 
 class EffectDrawer {
@@ -9,16 +12,31 @@ public:
 	EffectDrawer(const EffectDrawer&) = delete;
 	EffectDrawer(EffectDrawer&&) = delete;
 
+	~EffectDrawer();
+
 	bool Initialize(
 		const EffectDesc& desc,
 		const EffectParams& params,
+		// EffectCompiler 开始异步加载的 SOURCE 纹理，为空时同步加载
+		std::span<const TextureLoader::AsyncTexture> sourceTextures,
 		ID3D11Texture2D* inputTex,
 		ID3D11Texture2D** outputTex,
 		RECT* outputRect = nullptr,
-		RECT* virtualOutputRect = nullptr
+		RECT* virtualOutputRect = nullptr,
+		// 将 32 位浮点格式的中间纹理降为 16 位，用于显存不足时
+		bool lowPrecisionTextures = false
+	);
+
+	// 根据 scale 属性或输出尺寸表达式计算效果的输出尺寸
+	static bool CalcOutputSize(
+		const EffectDesc& desc,
+		const EffectParams& params,
+		SIZE inputSize,
+		SIZE& outputSize
 	);
 
-	void Draw(UINT& idx, bool noUpdate = false);
+	// gpuTimer 为空时不记录各通道的 GPU 时间
+	void Draw(GPUTimer* gpuTimer, UINT& idx, bool noUpdate = false);
 
 	bool IsUseDynamic() const noexcept {
 		return _desc.isUseDynamic;
@@ -28,7 +46,23 @@ public:
 		return _desc;
 	}
 
+	struct TextureMemory {
+		std::string name;
+		// 单位为字节
+		UINT64 size;
+	};
+
+	// 此效果创建或载入的纹理，不包括 INPUT 和后缓冲区
+	const std::vector<TextureMemory>& GetTextureMemory() const noexcept {
+		return _textureMemory;
+	}
+
+	UINT64 GetTotalTextureMemory() const noexcept;
+
 private:
+	// 零拷贝时每帧检查输入纹理是否改变
+	void _UpdateInputSrv();
+
 	void _DrawPass(UINT i);
 
 	EffectDesc _desc;
@@ -41,8 +75,12 @@ private:
 
 	std::vector<EffectConstant32> _constants;
 	winrt::com_ptr<ID3D11Buffer> _constantBuffer;
+	// BUFFER 块，绑定到 b2 开始的槽
+	std::vector<winrt::com_ptr<ID3D11Buffer>> _buffers;
 
 	std::vector<winrt::com_ptr<ID3D11ComputeShader>> _shaders;
 
 	std::vector<std::pair<UINT, UINT>> _dispatches;
+
+	std::vector<TextureMemory> _textureMemory;
 };
@@ -0,0 +1,187 @@
+#include "pch.h"
+#include "FrameChangeDetector.h"
+#include "App.h"
+#include "DeviceResources.h"
+#include "Logger.h"
+
+
+// 每个线程组处理一个分块，每个线程处理 8x8 个像素
+// 签名为分块内每个像素的颜色和位置的哈希之和，忽略 alpha 通道
+// 使用两个独立的哈希函数得到两个 32 位的和，降低两个不同的帧签名相同的可能
+static constexpr const char* SIGNATURE_SHADER = R"(Texture2D<float4> frame : register(t0);
+RWBuffer<uint> signatures : register(u0);
+
+groupshared uint tileSignature[2];
+
+// PCG
+uint Hash1(uint v) {
+	uint state = v * 747796405u + 2891336453u;
+	uint word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+	return (word >> 22u) ^ word;
+}
+
+// MurmurHash3 的 fmix32
+uint Hash2(uint v) {
+	v ^= v >> 16u;
+	v *= 0x85ebca6bu;
+	v ^= v >> 13u;
+	v *= 0xc2b2ae35u;
+	return v ^ (v >> 16u);
+}
+
+[numthreads(8, 8, 1)]
+void main(uint3 tid : SV_GroupThreadID, uint3 gid : SV_GroupID, uint gi : SV_GroupIndex) {
+	if (gi < 2) {
+		tileSignature[gi] = 0;
+	}
+	GroupMemoryBarrierWithGroupSync();
+
+	uint2 frameSize;
+	frame.GetDimensions(frameSize.x, frameSize.y);
+
+	uint2 origin = (gid.xy << 6u) + (tid.xy << 3u);
+	uint2 signature = 0;
+	for (uint y = 0; y < 8; ++y) {
+		for (uint x = 0; x < 8; ++x) {
+			uint2 pos = origin + uint2(x, y);
+			if (pos.x < frameSize.x && pos.y < frameSize.y) {
+				uint3 c = uint3(round(frame[pos].rgb * 255.0f));
+				uint color = c.r | (c.g << 8) | (c.b << 16);
+				uint packedPos = pos.x | (pos.y << 16);
+				signature.x += Hash1(color ^ Hash1(packedPos));
+				signature.y += Hash2(color ^ Hash2(packedPos ^ 0x9e3779b9u));
+			}
+		}
+	}
+
+	InterlockedAdd(tileSignature[0], signature.x);
+	InterlockedAdd(tileSignature[1], signature.y);
+	GroupMemoryBarrierWithGroupSync();
+
+	if (gi < 2) {
+		signatures[(gid.y * ((frameSize.x + 63u) >> 6u) + gid.x) * 2 + gi] = tileSignature[gi];
+	}
+}
+)";
+
+
+bool FrameChangeDetector::Initialize(UINT frameWidth, UINT frameHeight) {
+	_tilesX = (frameWidth + TILE_SIZE - 1) / TILE_SIZE;
+	_tilesY = (frameHeight + TILE_SIZE - 1) / TILE_SIZE;
+	// 每个分块两个签名
+	const UINT signatureCount = _tilesX * _tilesY * 2;
+
+	DeviceResources& dr = App::Get().GetDeviceResources();
+	ID3D11Device* d3dDevice = dr.GetD3DDevice();
+
+	winrt::com_ptr<ID3DBlob> blob;
+	if (!dr.CompileShader(SIGNATURE_SHADER, "main", blob.put(), "FrameChangeDetector")) {
+		Logger::Get().Error("编译签名着色器失败");
+		return false;
+	}
+
+	HRESULT hr = d3dDevice->CreateComputeShader(blob->GetBufferPointer(), blob->GetBufferSize(), nullptr, _shader.put());
+	if (FAILED(hr)) {
+		Logger::Get().ComError("创建计算着色器失败", hr);
+		return false;
+	}
+
+	D3D11_BUFFER_DESC bd{};
+	bd.ByteWidth = signatureCount * 4;
+	bd.Usage = D3D11_USAGE_DEFAULT;
+	bd.BindFlags = D3D11_BIND_UNORDERED_ACCESS;
+	hr = d3dDevice->CreateBuffer(&bd, nullptr, _signatureBuffer.put());
+	if (FAILED(hr)) {
+		Logger::Get().ComError("CreateBuffer 失败", hr);
+		return false;
+	}
+
+	D3D11_UNORDERED_ACCESS_VIEW_DESC uavDesc{};
+	uavDesc.Format = DXGI_FORMAT_R32_UINT;
+	uavDesc.ViewDimension = D3D11_UAV_DIMENSION_BUFFER;
+	uavDesc.Buffer.NumElements = signatureCount;
+	hr = d3dDevice->CreateUnorderedAccessView(_signatureBuffer.get(), &uavDesc, _signatureUav.put());
+	if (FAILED(hr)) {
+		Logger::Get().ComError("CreateUnorderedAccessView 失败", hr);
+		return false;
+	}
+
+	bd.Usage = D3D11_USAGE_STAGING;
+	bd.BindFlags = 0;
+	bd.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+	for (winrt::com_ptr<ID3D11Buffer>& buffer : _readbackBuffers) {
+		hr = d3dDevice->CreateBuffer(&bd, nullptr, buffer.put());
+		if (FAILED(hr)) {
+			Logger::Get().ComError("CreateBuffer 失败", hr);
+			return false;
+		}
+	}
+
+	_signatures.resize(signatureCount);
+
+	return true;
+}
+
+void FrameChangeDetector::Submit(ID3D11Texture2D* frame) {
+	DeviceResources& dr = App::Get().GetDeviceResources();
+	ID3D11DeviceContext* d3dDC = dr.GetD3DDC();
+
+	ID3D11ShaderResourceView* srv = nullptr;
+	if (!dr.GetShaderResourceView(frame, &srv)) {
+		Logger::Get().Error("GetShaderResourceView 失败");
+		_hasPendingReadback = false;
+		return;
+	}
+
+	d3dDC->CSSetShader(_shader.get(), nullptr, 0);
+	d3dDC->CSSetShaderResources(0, 1, &srv);
+	ID3D11UnorderedAccessView* uav = _signatureUav.get();
+	d3dDC->CSSetUnorderedAccessViews(0, 1, &uav, nullptr);
+
+	d3dDC->Dispatch(_tilesX, _tilesY, 1);
+
+	// 解绑，之后 frame 会作为捕获的目标
+	srv = nullptr;
+	d3dDC->CSSetShaderResources(0, 1, &srv);
+	uav = nullptr;
+	d3dDC->CSSetUnorderedAccessViews(0, 1, &uav, nullptr);
+
+	d3dDC->CopyResource(_readbackBuffers[_nextReadbackIdx].get(), _signatureBuffer.get());
+	_nextReadbackIdx = (_nextReadbackIdx + 1) % (UINT)_readbackBuffers.size();
+	_hasPendingReadback = true;
+}
+
+bool FrameChangeDetector::IsLastFrameChanged() {
+	if (!_hasPendingReadback) {
+		_isSignaturesValid = false;
+		return true;
+	}
+	_hasPendingReadback = false;
+
+	// 最近一次提交的结果
+	UINT readbackIdx = (_nextReadbackIdx + (UINT)_readbackBuffers.size() - 1) % (UINT)_readbackBuffers.size();
+	ID3D11Buffer* readbackBuffer = _readbackBuffers[readbackIdx].get();
+
+	ID3D11DeviceContext* d3dDC = App::Get().GetDeviceResources().GetD3DDC();
+	D3D11_MAPPED_SUBRESOURCE ms;
+	HRESULT hr = d3dDC->Map(readbackBuffer, 0, D3D11_MAP_READ, D3D11_MAP_FLAG_DO_NOT_WAIT, &ms);
+	if (FAILED(hr)) {
+		if (hr != DXGI_ERROR_WAS_STILL_DRAWING) {
+			Logger::Get().ComError("Map 失败", hr);
+		}
+
+		// 不等待 GPU，视为已改变
+		_isSignaturesValid = false;
+		return true;
+	}
+
+	const size_t signaturesSize = _signatures.size() * 4;
+	const bool changed = !_isSignaturesValid || std::memcmp(_signatures.data(), ms.pData, signaturesSize) != 0;
+
+	std::memcpy(_signatures.data(), ms.pData, signaturesSize);
+	_isSignaturesValid = true;
+
+	d3dDC->Unmap(readbackBuffer, 0);
+
+	return changed;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "pch.h"
+
+
+// 在 GPU 上计算每个分块的签名并和上一次提交的帧比较，用于检测帧是否改变
+// 供总是能捕获到新帧的捕获方式（GDI、DwmSharedSurface）使用
+// 签名异步读回，结果比提交晚一帧，因此不会阻塞渲染
+class FrameChangeDetector {
+public:
+	FrameChangeDetector() = default;
+	FrameChangeDetector(const FrameChangeDetector&) = delete;
+	FrameChangeDetector(FrameChangeDetector&&) = delete;
+
+	bool Initialize(UINT frameWidth, UINT frameHeight);
+
+	// 计算 frame 的签名，结果在下一帧通过 IsLastFrameChanged 获取
+	void Submit(ID3D11Texture2D* frame);
+
+	// 上一次 Submit 的帧相对于再之前一次 Submit 的帧是否改变
+	// 结果不可用时视为已改变
+	bool IsLastFrameChanged();
+
+	static constexpr UINT TILE_SIZE = 64;
+
+private:
+	UINT _tilesX = 0;
+	UINT _tilesY = 0;
+
+	winrt::com_ptr<ID3D11ComputeShader> _shader;
+	winrt::com_ptr<ID3D11Buffer> _signatureBuffer;
+	winrt::com_ptr<ID3D11UnorderedAccessView> _signatureUav;
+
+	// 读回签名的环形缓冲区
+	std::array<winrt::com_ptr<ID3D11Buffer>, 2> _readbackBuffers;
+	UINT _nextReadbackIdx = 0;
+	bool _hasPendingReadback = false;
+
+	// 上一次读回的签名，每个分块两个
+	std::vector<UINT> _signatures;
+	bool _isSignaturesValid = false;
+};
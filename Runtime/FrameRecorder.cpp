@@ -0,0 +1,226 @@
+#include "pch.h"
+#include "FrameRecorder.h"
+#include "App.h"
+#include "DeviceResources.h"
+#include "Logger.h"
+#include "StrUtils.h"
+
+
+FrameRecorder::~FrameRecorder() {
+	if (!_hWriteThread) {
+		return;
+	}
+
+	// 读回尚未读回的帧
+	if (!_writeFailed.load(std::memory_order_relaxed)) {
+		_ReadBack(true);
+	}
+
+	{
+		std::scoped_lock lk(_cs);
+		_exiting = true;
+	}
+	WakeAllConditionVariable(&_cv);
+
+	// 写入线程退出前会写完队列中的帧
+	WaitForSingleObject(_hWriteThread, INFINITE);
+	CloseHandle(_hWriteThread);
+
+	Logger::Get().Info(fmt::format("已录制 {} 帧，丢弃 {} 帧", _frameCount.load(), _droppedFrames));
+}
+
+bool FrameRecorder::Initialize(const wchar_t* fileName, UINT width, UINT height, DXGI_FORMAT format) {
+	if (!FrameDumpHeader::IsFormatSupported(format)) {
+		Logger::Get().Error(fmt::format("不支持录制格式为 {} 的帧", (int)format));
+		return false;
+	}
+
+	_width = width;
+	_height = height;
+
+	for (winrt::com_ptr<ID3D11Texture2D>& tex : _stagingTextures) {
+		D3D11_TEXTURE2D_DESC desc{};
+		desc.Format = format;
+		desc.Width = width;
+		desc.Height = height;
+		desc.MipLevels = 1;
+		desc.ArraySize = 1;
+		desc.SampleDesc.Count = 1;
+		desc.Usage = D3D11_USAGE_STAGING;
+		desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+
+		HRESULT hr = App::Get().GetDeviceResources().GetD3DDevice()->CreateTexture2D(&desc, nullptr, tex.put());
+		if (FAILED(hr)) {
+			Logger::Get().ComError("创建 Staging Texture2D 失败", hr);
+			return false;
+		}
+	}
+
+	_hFile.reset(Utils::SafeHandle(CreateFile2(fileName, GENERIC_WRITE, 0, CREATE_ALWAYS, nullptr)));
+	if (!_hFile) {
+		Logger::Get().Win32Error(StrUtils::Concat("创建文件 ", StrUtils::UTF16ToUTF8(fileName), " 失败"));
+		return false;
+	}
+
+	FrameDumpHeader header{};
+	header.magic = FrameDumpHeader::MAGIC;
+	header.version = FrameDumpHeader::VERSION;
+	header.width = width;
+	header.height = height;
+	header.format = format;
+
+	DWORD written;
+	if (!WriteFile(_hFile.get(), &header, sizeof(header), &written, nullptr)) {
+		Logger::Get().Win32Error("写入文件头失败");
+		_hFile.reset();
+		return false;
+	}
+
+	InitializeConditionVariable(&_cv);
+
+	_hWriteThread = CreateThread(nullptr, 0, _WriteThreadProc, this, 0, nullptr);
+	if (!_hWriteThread) {
+		Logger::Get().Win32Error("创建写入线程失败");
+		_hFile.reset();
+		return false;
+	}
+
+	Logger::Get().Info(StrUtils::Concat("开始录制到 ", StrUtils::UTF16ToUTF8(fileName)));
+	return true;
+}
+
+void FrameRecorder::Record(ID3D11Texture2D* frame, const D3D11_BOX& box) {
+	if (!_hWriteThread) {
+		return;
+	}
+
+	if (_writeFailed.load(std::memory_order_relaxed)) {
+		// 写入线程已记录错误，停止录制
+		return;
+	}
+
+	_ReadBack(false);
+
+	if (_pendingCount == STAGING_COUNT) {
+		// GPU 落后太多，丢弃这一帧而不是等待
+		++_droppedFrames;
+		return;
+	}
+
+	const UINT idx = (_readIdx + _pendingCount) % STAGING_COUNT;
+	App::Get().GetDeviceResources().GetD3DDC()->CopySubresourceRegion(
+		_stagingTextures[idx].get(), 0, 0, 0, 0, frame, 0, &box);
+	++_pendingCount;
+}
+
+void FrameRecorder::_ReadBack(bool wait) {
+	ID3D11DeviceContext* d3dDC = App::Get().GetDeviceResources().GetD3DDC();
+	const size_t rowBytes = (size_t)_width * 4;
+
+	while (_pendingCount > 0) {
+		ID3D11Texture2D* tex = _stagingTextures[_readIdx].get();
+
+		D3D11_MAPPED_SUBRESOURCE ms;
+		HRESULT hr = d3dDC->Map(tex, 0, D3D11_MAP_READ, wait ? 0 : D3D11_MAP_FLAG_DO_NOT_WAIT, &ms);
+		if (hr == DXGI_ERROR_WAS_STILL_DRAWING) {
+			// 之后的帧也不会完成
+			return;
+		}
+
+		_readIdx = (_readIdx + 1) % STAGING_COUNT;
+		--_pendingCount;
+
+		if (FAILED(hr)) {
+			Logger::Get().ComError("Map 失败", hr);
+			++_droppedFrames;
+			continue;
+		}
+
+		std::vector<BYTE> buffer;
+		bool hasBuffer = true;
+		{
+			std::scoped_lock lk(_cs);
+
+			if (wait) {
+				while (_freeBuffers.empty() && _allocatedBuffers == MAX_QUEUED_FRAMES
+					&& !_writeFailed.load(std::memory_order_relaxed)) {
+					SleepConditionVariableCS(&_cv, _cs.get(), INFINITE);
+				}
+			}
+
+			if (!_freeBuffers.empty()) {
+				buffer = std::move(_freeBuffers.back());
+				_freeBuffers.pop_back();
+			} else if (_allocatedBuffers < MAX_QUEUED_FRAMES) {
+				++_allocatedBuffers;
+			} else {
+				// 写入跟不上
+				hasBuffer = false;
+			}
+		}
+
+		if (!hasBuffer || _writeFailed.load(std::memory_order_relaxed)) {
+			d3dDC->Unmap(tex, 0);
+			++_droppedFrames;
+			continue;
+		}
+
+		// 去除行尾的填充
+		buffer.resize(rowBytes * _height);
+		for (UINT y = 0; y < _height; ++y) {
+			std::memcpy(buffer.data() + y * rowBytes, (const BYTE*)ms.pData + (size_t)y * ms.RowPitch, rowBytes);
+		}
+
+		d3dDC->Unmap(tex, 0);
+
+		{
+			std::scoped_lock lk(_cs);
+			_writeQueue.push_back(std::move(buffer));
+		}
+		WakeAllConditionVariable(&_cv);
+	}
+}
+
+DWORD WINAPI FrameRecorder::_WriteThreadProc(LPVOID lpThreadParameter) {
+	FrameRecorder& that = *(FrameRecorder*)lpThreadParameter;
+
+	while (true) {
+		std::vector<BYTE> buffer;
+		{
+			std::scoped_lock lk(that._cs);
+
+			while (that._writeQueue.empty() && !that._exiting) {
+				SleepConditionVariableCS(&that._cv, that._cs.get(), INFINITE);
+			}
+
+			if (that._writeQueue.empty()) {
+				// 正在退出且队列已清空
+				break;
+			}
+
+			buffer = std::move(that._writeQueue.front());
+			that._writeQueue.pop_front();
+		}
+
+		DWORD written;
+		if (WriteFile(that._hFile.get(), buffer.data(), (DWORD)buffer.size(), &written, nullptr)) {
+			that._frameCount.fetch_add(1, std::memory_order_relaxed);
+		} else {
+			Logger::Get().Win32Error("WriteFile 失败");
+			that._writeFailed.store(true, std::memory_order_relaxed);
+		}
+
+		{
+			std::scoped_lock lk(that._cs);
+			that._freeBuffers.push_back(std::move(buffer));
+
+			if (that._writeFailed.load(std::memory_order_relaxed)) {
+				// 丢弃剩余的帧
+				that._writeQueue.clear();
+			}
+		}
+		WakeAllConditionVariable(&that._cv);
+	}
+
+	return 0;
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include "pch.h"
+#include "Utils.h"
+#include <array>
+#include <atomic>
+#include <deque>
+
+
+// 原始帧文件的文件头，之后是紧密排列的帧，每帧 width * height * 4 字节
+struct FrameDumpHeader {
+	UINT magic;
+	UINT version;
+	UINT width;
+	UINT height;
+	DXGI_FORMAT format;
+	UINT reserved[3];
+
+	// "MPFD"
+	static constexpr UINT MAGIC = 0x4446504D;
+	static constexpr UINT VERSION = 1;
+
+	// 只支持每像素 4 字节的格式
+	static bool IsFormatSupported(DXGI_FORMAT format) noexcept {
+		switch (format) {
+		case DXGI_FORMAT_R8G8B8A8_UNORM:
+		case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
+		case DXGI_FORMAT_B8G8R8A8_UNORM:
+		case DXGI_FORMAT_B8G8R8A8_UNORM_SRGB:
+		case DXGI_FORMAT_B8G8R8X8_UNORM:
+		case DXGI_FORMAT_B8G8R8X8_UNORM_SRGB:
+		case DXGI_FORMAT_R10G10B10A2_UNORM:
+			return true;
+		default:
+			return false;
+		}
+	}
+};
+
+
+// 将捕获到的帧录制为原始帧文件，供 ReplayFrameSource 回放
+// 主线程只将帧复制到 Staging 纹理，并以不等待 GPU 的方式读回，写入文件在后台线程进行
+// 读回或写入跟不上时丢弃帧，因此录制的帧数可能少于渲染的帧数
+class FrameRecorder {
+public:
+	FrameRecorder() = default;
+	FrameRecorder(const FrameRecorder&) = delete;
+	FrameRecorder(FrameRecorder&&) = delete;
+
+	~FrameRecorder();
+
+	// 只支持每像素 4 字节的格式，见 FrameDumpHeader::IsFormatSupported
+	bool Initialize(const wchar_t* fileName, UINT width, UINT height, DXGI_FORMAT format);
+
+	// 录制 frame 中 box 的区域
+	void Record(ID3D11Texture2D* frame, const D3D11_BOX& box);
+
+	UINT GetFrameCount() const noexcept {
+		return _frameCount.load(std::memory_order_relaxed);
+	}
+
+private:
+	// 按提交顺序读回已完成的帧并交给写入线程，wait 为 true 时等待 GPU 和写入线程
+	void _ReadBack(bool wait);
+
+	static DWORD WINAPI _WriteThreadProc(LPVOID lpThreadParameter);
+
+	static constexpr UINT STAGING_COUNT = 4;
+	// 等待写入的帧数上限，限制内存占用
+	static constexpr UINT MAX_QUEUED_FRAMES = 4;
+
+	UINT _width = 0;
+	UINT _height = 0;
+
+	std::array<winrt::com_ptr<ID3D11Texture2D>, STAGING_COUNT> _stagingTextures;
+	// 最早提交的尚未读回的 Staging 纹理
+	UINT _readIdx = 0;
+	UINT _pendingCount = 0;
+	// 只由主线程访问
+	UINT _droppedFrames = 0;
+
+	Utils::ScopedHandle _hFile;
+	HANDLE _hWriteThread = NULL;
+
+	// 保护以下成员
+	Utils::CSMutex _cs;
+	CONDITION_VARIABLE _cv{};
+	std::deque<std::vector<BYTE>> _writeQueue;
+	std::vector<std::vector<BYTE>> _freeBuffers;
+	UINT _allocatedBuffers = 0;
+	bool _exiting = false;
+
+	std::atomic<bool> _writeFailed = false;
+	std::atomic<UINT> _frameCount = 0;
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include "pch.h"
+#include "Utils.h"
 
 
 class FrameSourceBase {
@@ -32,8 +33,45 @@ public:
 		return _output.get();
 	}
 
+	// 支持零拷贝的捕获方式可以将捕获到的表面直接作为第一个效果的输入，省去一次全尺寸的复制
+	virtual bool IsZeroCopySupported() const noexcept {
+		return false;
+	}
+
+	// 须在初始化效果前调用。启用后 GetOutput 返回的纹理每帧可能不同，
+	// 且只有 GetOutputBox 中的区域是源窗口的内容
+	virtual bool EnableZeroCopy() {
+		return false;
+	}
+
+	bool IsZeroCopy() const noexcept {
+		return _isZeroCopy;
+	}
+
+	// 零拷贝时源窗口内容在 GetOutput() 中的位置
+	const D3D11_BOX& GetOutputBox() const noexcept {
+		return _outputBox;
+	}
+
+	// 零拷贝时 GetOutput() 的尺寸
+	SIZE GetOutputTextureSize() const noexcept {
+		return _outputTextureSize;
+	}
+
 	virtual const char* GetName() const noexcept = 0;
 
+	// 新帧到达时触发的事件，主线程可以在此之上等待而不必轮询
+	// 不支持的捕获方式返回 NULL
+	HANDLE GetNewFrameEvent() const noexcept {
+		return _newFrameEvent.get();
+	}
+
+	// 最新一帧到达的时间，单位为 QueryPerformanceCounter 的计数
+	// 0 表示捕获方式不提供此信息
+	INT64 GetFrameArrivalTime() const noexcept {
+		return _frameArrivalTime.load(std::memory_order_relaxed);
+	}
+
 protected:
 	virtual bool _HasRoundCornerInWin11() = 0;
 
@@ -54,6 +92,16 @@ protected:
 
 	winrt::com_ptr<ID3D11Texture2D> _output;
 
+	bool _isZeroCopy = false;
+	D3D11_BOX _outputBox{};
+	SIZE _outputTextureSize{};
+
+	// 自动重置的事件，由捕获线程在新帧到达后触发
+	Utils::ScopedHandle _newFrameEvent;
+
+	// 可能由捕获线程写入
+	std::atomic<INT64> _frameArrivalTime = 0;
+
 	bool _roundCornerDisabled = false;
 	bool _windowResizingDisabled = false;
 };
@@ -0,0 +1,133 @@
+#include "pch.h"
+#include "FrameStatistics.h"
+
+
+AtomicHistogram::AtomicHistogram(float bucketWidth, UINT bucketCount)
+	: _bucketWidth(bucketWidth), _bucketCount(bucketCount), _buckets(new std::atomic<UINT>[bucketCount]) {
+	Reset();
+}
+
+void AtomicHistogram::Add(float value) noexcept {
+	UINT idx = (UINT)std::clamp(value / _bucketWidth, 0.0f, float(_bucketCount - 1));
+	_buckets[idx].fetch_add(1, std::memory_order_relaxed);
+	_sum.fetch_add(UINT64(std::max(value, 0.0f) / _bucketWidth * 1000), std::memory_order_relaxed);
+
+	// 只有一个写入者，无需 CAS
+	if (value > _max.load(std::memory_order_relaxed)) {
+		_max.store(value, std::memory_order_relaxed);
+	}
+
+	// 最后增加计数，读取者看到的计数不会多于桶中的总数
+	_count.fetch_add(1, std::memory_order_release);
+}
+
+void AtomicHistogram::Reset() noexcept {
+	_count.store(0, std::memory_order_relaxed);
+	_sum.store(0, std::memory_order_relaxed);
+	_max.store(0, std::memory_order_relaxed);
+	for (UINT i = 0; i < _bucketCount; ++i) {
+		_buckets[i].store(0, std::memory_order_relaxed);
+	}
+}
+
+float AtomicHistogram::GetAverage() const noexcept {
+	UINT count = _count.load(std::memory_order_acquire);
+	if (count == 0) {
+		return 0.0f;
+	}
+
+	return float(_sum.load(std::memory_order_relaxed) / 1000.0 * _bucketWidth / count);
+}
+
+float AtomicHistogram::GetPercentile(float p) const noexcept {
+	UINT count = _count.load(std::memory_order_acquire);
+	if (count == 0) {
+		return 0.0f;
+	}
+
+	const UINT target = std::max(1U, (UINT)std::ceil(count * p));
+	UINT accum = 0;
+	for (UINT i = 0; i < _bucketCount; ++i) {
+		accum += _buckets[i].load(std::memory_order_relaxed);
+		if (accum >= target) {
+			// 取桶的中点，不超过最大值
+			return std::min((i + 0.5f) * _bucketWidth, GetMax());
+		}
+	}
+
+	return GetMax();
+}
+
+
+// 0~100ms，精度 0.1ms
+static constexpr float FRAME_TIME_BUCKET_WIDTH = 0.1f;
+static constexpr UINT FRAME_TIME_BUCKET_COUNT = 1000;
+// 0~20ms，精度 0.02ms
+static constexpr float PASS_TIME_BUCKET_WIDTH = 0.02f;
+static constexpr UINT PASS_TIME_BUCKET_COUNT = 1000;
+
+// 更新中位数的间隔帧数
+static constexpr UINT MEDIAN_UPDATE_INTERVAL = 30;
+
+FrameStatistics::FrameStatistics() : _frameTimes(FRAME_TIME_BUCKET_WIDTH, FRAME_TIME_BUCKET_COUNT) {}
+
+void FrameStatistics::OnFrame(float frameTime) noexcept {
+	// 中位数可用前不检测卡顿
+	if (_medianFrameTime > 0 && frameTime > _medianFrameTime * 2) {
+		_stutterCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	_frameTimes.Add(frameTime);
+
+	if (++_framesSinceMedianUpdate >= MEDIAN_UPDATE_INTERVAL) {
+		_framesSinceMedianUpdate = 0;
+		_medianFrameTime = _frameTimes.GetPercentile(0.5f);
+	}
+}
+
+void FrameStatistics::StartPasses(UINT passCount) {
+	_passTimes.resize(passCount);
+	for (std::unique_ptr<AtomicHistogram>& histogram : _passTimes) {
+		histogram.reset(new AtomicHistogram(PASS_TIME_BUCKET_WIDTH, PASS_TIME_BUCKET_COUNT));
+	}
+}
+
+void FrameStatistics::StopPasses() {
+	_passTimes.clear();
+}
+
+void FrameStatistics::OnPassTimings(std::span<const float> passTimings) noexcept {
+	if (passTimings.size() != _passTimes.size()) {
+		return;
+	}
+
+	for (size_t i = 0; i < passTimings.size(); ++i) {
+		// 跳过的通道时间为 0，不计入统计
+		if (passTimings[i] > 0.01f) {
+			_passTimes[i]->Add(passTimings[i]);
+		}
+	}
+}
+
+void FrameStatistics::Reset() noexcept {
+	_frameTimes.Reset();
+	for (std::unique_ptr<AtomicHistogram>& histogram : _passTimes) {
+		histogram->Reset();
+	}
+
+	_stutterCount.store(0, std::memory_order_relaxed);
+	_medianFrameTime = 0;
+	_framesSinceMedianUpdate = 0;
+}
+
+FrameStatistics::Summary FrameStatistics::GetSummary() const noexcept {
+	Summary result{};
+	result.frameCount = _frameTimes.GetCount();
+	result.stutterCount = GetStutterCount();
+	result.avgFrameTime = _frameTimes.GetAverage();
+	result.p50FrameTime = _frameTimes.GetPercentile(0.5f);
+	result.p95FrameTime = _frameTimes.GetPercentile(0.95f);
+	result.p99FrameTime = _frameTimes.GetPercentile(0.99f);
+	result.onePercentLowFPS = result.p99FrameTime > 0 ? 1000 / result.p99FrameTime : 0.0f;
+	return result;
+}
@@ -0,0 +1,112 @@
+#pragma once
+#include "pch.h"
+
+
+// 固定大小的直方图，由渲染线程写入，其他线程可以无锁读取
+// 超出范围的值计入最后一个桶
+class AtomicHistogram {
+public:
+	AtomicHistogram(float bucketWidth, UINT bucketCount);
+	AtomicHistogram(const AtomicHistogram&) = delete;
+	AtomicHistogram(AtomicHistogram&&) = delete;
+
+	void Add(float value) noexcept;
+
+	void Reset() noexcept;
+
+	UINT GetCount() const noexcept {
+		return _count.load(std::memory_order_relaxed);
+	}
+
+	float GetAverage() const noexcept;
+
+	float GetMax() const noexcept {
+		return _max.load(std::memory_order_relaxed);
+	}
+
+	// 根据直方图估算百分位数，p 在 0~1 之间。读取时可能有写入，结果是近似的
+	float GetPercentile(float p) const noexcept;
+
+	float GetBucketWidth() const noexcept {
+		return _bucketWidth;
+	}
+
+	UINT GetBucketCount() const noexcept {
+		return _bucketCount;
+	}
+
+	UINT GetBucket(UINT idx) const noexcept {
+		return _buckets[idx].load(std::memory_order_relaxed);
+	}
+
+private:
+	const float _bucketWidth;
+	const UINT _bucketCount;
+	std::unique_ptr<std::atomic<UINT>[]> _buckets;
+
+	std::atomic<UINT> _count = 0;
+	// 单位为 1/1000 个 _bucketWidth 的整数，避免使用浮点原子操作
+	std::atomic<UINT64> _sum = 0;
+	std::atomic<float> _max = 0;
+};
+
+
+// 帧时间和各通道 GPU 时间的分布以及卡顿次数
+// 平均帧率掩盖了卡顿，百分位数和卡顿计数才能反映实际的流畅度
+class FrameStatistics {
+public:
+	FrameStatistics();
+	FrameStatistics(const FrameStatistics&) = delete;
+	FrameStatistics(FrameStatistics&&) = delete;
+
+	// 每帧调用，frameTime 单位为 ms，不包括等待新帧的时间
+	void OnFrame(float frameTime) noexcept;
+
+	// 以下三个函数只能在渲染线程调用
+	void StartPasses(UINT passCount);
+
+	void StopPasses();
+
+	void OnPassTimings(std::span<const float> passTimings) noexcept;
+
+	void Reset() noexcept;
+
+	const AtomicHistogram& GetFrameTimes() const noexcept {
+		return _frameTimes;
+	}
+
+	// 只能在渲染线程调用，未统计 GPU 时间时为空
+	std::span<const std::unique_ptr<AtomicHistogram>> GetPassTimes() const noexcept {
+		return _passTimes;
+	}
+
+	// 帧时间超过中位数两倍的帧数
+	UINT GetStutterCount() const noexcept {
+		return _stutterCount.load(std::memory_order_relaxed);
+	}
+
+	// 布局是导出函数 GetFrameStatistics 的接口的一部分，不要修改
+	struct Summary {
+		UINT frameCount;
+		UINT stutterCount;
+		// 以下单位为 ms
+		float avgFrameTime;
+		float p50FrameTime;
+		float p95FrameTime;
+		float p99FrameTime;
+		// 1% low，即 p99 帧时间对应的帧率
+		float onePercentLowFPS;
+	};
+
+	Summary GetSummary() const noexcept;
+
+private:
+	AtomicHistogram _frameTimes;
+	std::vector<std::unique_ptr<AtomicHistogram>> _passTimes;
+
+	std::atomic<UINT> _stutterCount = 0;
+
+	// 中位数每隔一段时间更新一次
+	float _medianFrameTime = 0;
+	UINT _framesSinceMedianUpdate = 0;
+};
@@ -0,0 +1,251 @@
+#include "pch.h"
+#include "FrameTracer.h"
+#include "Logger.h"
+#include "StrUtils.h"
+
+
+// 二进制格式：
+// 文件头 | 名字表（每项为 UINT16 长度 + UTF-8 字符串）| 事件（_Event，每个 24 字节）
+struct TraceFileHeader {
+	UINT magic;
+	UINT version;
+	INT64 qpcFrequency;
+	INT64 startTime;
+	UINT nameCount;
+	UINT reserved;
+
+	// "MPTR"
+	static constexpr UINT MAGIC = 0x5254504D;
+	static constexpr UINT VERSION = 1;
+};
+
+static constexpr const char* CPU_PHASE_NAMES[] = {
+	"Config::OnBeginFrame",
+	"FrameSource::Update",
+	"CursorManager::OnBeginFrame",
+	"UpdateDynamicConstants",
+	"Draw",
+	"Overlay",
+	"Present"
+};
+static_assert(std::size(CPU_PHASE_NAMES) == (size_t)FrameTracer::CPUPhase::COUNT);
+
+// 缓冲区超过此比例时唤醒后台线程
+static constexpr UINT FLUSH_THRESHOLD = 4;
+// 后台线程的最长写入间隔
+static constexpr DWORD FLUSH_INTERVAL = 500;
+
+
+FrameTracer::~FrameTracer() {
+	if (!_hFlushThread) {
+		return;
+	}
+
+	_exiting.store(true);
+	SetEvent(_flushEvent.get());
+	WaitForSingleObject(_hFlushThread, INFINITE);
+	CloseHandle(_hFlushThread);
+
+	if (!_isBinary) {
+		_buffer = "\n]\n";
+		_WriteBuffer();
+	}
+
+	UINT64 dropped = _droppedEvents.load();
+	if (dropped > 0) {
+		Logger::Get().Warn(fmt::format("跟踪缓冲区已满，丢弃了 {} 个事件", dropped));
+	}
+
+	Logger::Get().Info(fmt::format("已记录 {} 个跟踪事件", _writePos.load()));
+}
+
+bool FrameTracer::Initialize(const wchar_t* fileName, std::vector<std::string>&& passNames) {
+	_names.reserve((size_t)CPUPhase::COUNT + passNames.size());
+	_names.assign(std::begin(CPU_PHASE_NAMES), std::end(CPU_PHASE_NAMES));
+	for (std::string& name : passNames) {
+		_names.emplace_back(std::move(name));
+	}
+
+	std::wstring_view fileNameView(fileName);
+	_isBinary = !(fileNameView.size() >= 5 && _wcsicmp(fileNameView.substr(fileNameView.size() - 5).data(), L".json") == 0);
+
+	_hFile.reset(Utils::SafeHandle(CreateFile2(fileName, GENERIC_WRITE, FILE_SHARE_READ, CREATE_ALWAYS, nullptr)));
+	if (!_hFile) {
+		Logger::Get().Win32Error(StrUtils::Concat("创建文件 ", StrUtils::UTF16ToUTF8(fileName), " 失败"));
+		return false;
+	}
+
+	LARGE_INTEGER t;
+	QueryPerformanceFrequency(&t);
+	_qpcFrequency = t.QuadPart;
+	QueryPerformanceCounter(&t);
+	_startTime = t.QuadPart;
+
+	if (!_WriteHeader()) {
+		Logger::Get().Error("写入跟踪文件头失败");
+		return false;
+	}
+
+	_ring.resize(RING_CAPACITY);
+
+	_flushEvent.reset(CreateEvent(nullptr, FALSE, FALSE, nullptr));
+	if (!_flushEvent) {
+		Logger::Get().Win32Error("CreateEvent 失败");
+		return false;
+	}
+
+	_hFlushThread = CreateThread(nullptr, 0, _FlushThreadProc, this, 0, nullptr);
+	if (!_hFlushThread) {
+		Logger::Get().Win32Error("CreateThread 失败");
+		return false;
+	}
+
+	Logger::Get().Info(StrUtils::Concat("开始记录跟踪到 ", StrUtils::UTF16ToUTF8(fileName)));
+	return true;
+}
+
+INT64 FrameTracer::AddCPUEvent(CPUPhase phase, UINT frameIdx, INT64 begin) noexcept {
+	if (!IsEnabled()) {
+		return 0;
+	}
+
+	INT64 now = Now();
+	_Push({ begin, now, frameIdx, (UINT16)phase, _Track::CPU });
+	return now;
+}
+
+void FrameTracer::AddGPUFrame(const GPUTimer::FrameGPUTimings& frame) noexcept {
+	if (!IsEnabled()) {
+		return;
+	}
+
+	INT64 t = std::max(frame.submitTime, _lastGPUEnd);
+	for (size_t i = 0; i < frame.passes.size(); ++i) {
+		INT64 end = t + INT64(frame.passes[i] * _qpcFrequency / 1000);
+		_Push({ t, end, frame.frameIdx, UINT16((size_t)CPUPhase::COUNT + i), _Track::GPU });
+		t = end;
+	}
+
+	_lastGPUEnd = t;
+}
+
+void FrameTracer::_Push(const _Event& event) noexcept {
+	const UINT64 writePos = _writePos.load(std::memory_order_relaxed);
+	const UINT64 used = writePos - _readPos.load(std::memory_order_acquire);
+	if (used >= RING_CAPACITY) {
+		_droppedEvents.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	_ring[writePos & (RING_CAPACITY - 1)] = event;
+	_writePos.store(writePos + 1, std::memory_order_release);
+
+	if (used + 1 == RING_CAPACITY / FLUSH_THRESHOLD) {
+		SetEvent(_flushEvent.get());
+	}
+}
+
+DWORD WINAPI FrameTracer::_FlushThreadProc(LPVOID lpThreadParameter) {
+	FrameTracer& that = *(FrameTracer*)lpThreadParameter;
+
+	while (true) {
+		WaitForSingleObject(that._flushEvent.get(), FLUSH_INTERVAL);
+
+		bool exiting = that._exiting.load();
+		if (!that._Flush()) {
+			// 之后缓冲区被填满，新的事件都将被丢弃
+			Logger::Get().Error("写入跟踪失败，停止记录");
+			return 1;
+		}
+
+		if (exiting) {
+			break;
+		}
+	}
+
+	return 0;
+}
+
+bool FrameTracer::_Flush() {
+	const UINT64 writePos = _writePos.load(std::memory_order_acquire);
+	UINT64 readPos = _readPos.load(std::memory_order_relaxed);
+
+	_buffer.clear();
+
+	for (; readPos < writePos; ++readPos) {
+		const _Event& event = _ring[readPos & (RING_CAPACITY - 1)];
+
+		if (_isBinary) {
+			_buffer.append((const char*)&event, sizeof(event));
+		} else {
+			const double toUS = 1e6 / _qpcFrequency;
+			_buffer.append(fmt::format(
+				",\n" R"({{"name":"{}","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f},"args":{{"frame":{}}}}})",
+				_names[event.nameIdx],
+				(UINT)event.track,
+				(event.begin - _startTime) * toUS,
+				(event.end - event.begin) * toUS,
+				event.frameIdx
+			));
+		}
+	}
+
+	_readPos.store(readPos, std::memory_order_release);
+
+	return _WriteBuffer();
+}
+
+bool FrameTracer::_WriteHeader() {
+	_buffer.clear();
+
+	if (_isBinary) {
+		static_assert(sizeof(_Event) == 24);
+
+		TraceFileHeader header{};
+		header.magic = TraceFileHeader::MAGIC;
+		header.version = TraceFileHeader::VERSION;
+		header.qpcFrequency = _qpcFrequency;
+		header.startTime = _startTime;
+		header.nameCount = (UINT)_names.size();
+		_buffer.append((const char*)&header, sizeof(header));
+
+		for (const std::string& name : _names) {
+			UINT16 len = (UINT16)name.size();
+			_buffer.append((const char*)&len, sizeof(len));
+			_buffer.append(name);
+		}
+	} else {
+		// 名字中可能含有需要转义的字符
+		for (std::string& name : _names) {
+			std::string escaped;
+			for (char c : name) {
+				if (c == '"' || c == '\\') {
+					escaped.push_back('\\');
+				}
+				escaped.push_back(c);
+			}
+			name = std::move(escaped);
+		}
+
+		// 省略结尾的 ] 也是合法的 Chrome Trace，因此异常退出时文件依然可用
+		_buffer = "[\n"
+			R"({"name":"thread_name","ph":"M","pid":1,"tid":1,"args":{"name":"CPU"}},)" "\n"
+			R"({"name":"thread_name","ph":"M","pid":1,"tid":2,"args":{"name":"GPU"}})";
+	}
+
+	return _WriteBuffer();
+}
+
+bool FrameTracer::_WriteBuffer() {
+	if (_buffer.empty()) {
+		return true;
+	}
+
+	DWORD written;
+	if (!WriteFile(_hFile.get(), _buffer.data(), (DWORD)_buffer.size(), &written, nullptr)) {
+		Logger::Get().Win32Error("WriteFile 失败");
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include "pch.h"
+#include "Utils.h"
+#include "GPUTimer.h"
+
+
+// 记录每帧 CPU 各阶段和 GPU 各通道的时间线，用于事后分析卡顿
+// 主线程将事件写入环形缓冲区，后台线程定期写入文件，主线程不进行 IO
+// 文件扩展名为 .json 时输出 Chrome Trace 格式（可在 chrome://tracing 或 Perfetto 中打开），否则输出紧凑的二进制格式
+class FrameTracer {
+public:
+	FrameTracer() = default;
+	FrameTracer(const FrameTracer&) = delete;
+	FrameTracer(FrameTracer&&) = delete;
+
+	~FrameTracer();
+
+	enum class CPUPhase : UINT16 {
+		Config,
+		Update,
+		Cursor,
+		DynamicConstants,
+		Draw,
+		Overlay,
+		Present,
+		COUNT
+	};
+
+	// passNames 为所有通道的名字，按执行顺序排列
+	bool Initialize(const wchar_t* fileName, std::vector<std::string>&& passNames);
+
+	bool IsEnabled() const noexcept {
+		return _hFlushThread != NULL;
+	}
+
+	// 未启用时返回 0
+	INT64 Now() const noexcept {
+		if (!IsEnabled()) {
+			return 0;
+		}
+
+		LARGE_INTEGER t;
+		QueryPerformanceCounter(&t);
+		return t.QuadPart;
+	}
+
+	// 记录从 begin 到现在的阶段，返回现在的时间以便连续记录下一个阶段
+	INT64 AddCPUEvent(CPUPhase phase, UINT frameIdx, INT64 begin) noexcept;
+
+	// GPU 时间戳和 CPU 时间没有统一的时钟，GPU 轨道以每帧开始提交的时间为起点对齐，只有时长是精确的
+	void AddGPUFrame(const GPUTimer::FrameGPUTimings& frame) noexcept;
+
+private:
+	enum class _Track : UINT8 {
+		CPU = 1,
+		GPU = 2
+	};
+
+	struct _Event {
+		INT64 begin;
+		INT64 end;
+		UINT frameIdx;
+		// CPU 阶段在前，之后是各通道
+		UINT16 nameIdx;
+		_Track track;
+		UINT8 reserved;
+	};
+
+	void _Push(const _Event& event) noexcept;
+
+	static DWORD WINAPI _FlushThreadProc(LPVOID lpThreadParameter);
+
+	// 在后台线程调用
+	bool _Flush();
+
+	bool _WriteHeader();
+
+	bool _WriteBuffer();
+
+	// 必须为 2 的幂
+	static constexpr UINT RING_CAPACITY = 1 << 16;
+	std::vector<_Event> _ring;
+	// 单生产者单消费者
+	std::atomic<UINT64> _writePos = 0;
+	std::atomic<UINT64> _readPos = 0;
+	// 缓冲区已满时丢弃的事件数
+	std::atomic<UINT64> _droppedEvents = 0;
+
+	std::vector<std::string> _names;
+	bool _isBinary = false;
+
+	INT64 _qpcFrequency = 1;
+	INT64 _startTime = 0;
+	// GPU 轨道上一个事件的结束时间
+	INT64 _lastGPUEnd = 0;
+
+	Utils::ScopedHandle _hFile;
+	Utils::ScopedHandle _flushEvent;
+	HANDLE _hFlushThread = NULL;
+	std::atomic<bool> _exiting = false;
+
+	// 只由后台线程访问
+	std::string _buffer;
+};
@@ -55,10 +55,13 @@ bool GDIFrameSource::Initialize() {
 		return false;
 	}
 
+	const UINT frameWidth = _frameRect.right - _frameRect.left;
+	const UINT frameHeight = _frameRect.bottom - _frameRect.top;
+
 	_output = App::Get().GetDeviceResources().CreateTexture2D(
 		DXGI_FORMAT_B8G8R8A8_UNORM,
-		_frameRect.right - _frameRect.left,
-		_frameRect.bottom - _frameRect.top,
+		frameWidth,
+		frameHeight,
 		D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET,
 		D3D11_USAGE_DEFAULT,
 		D3D11_RESOURCE_MISC_GDI_COMPATIBLE
@@ -74,6 +77,11 @@ bool GDIFrameSource::Initialize() {
 		return false;
 	}
 
+	if (!_changeDetector.Initialize(frameWidth, frameHeight)) {
+		Logger::Get().Error("初始化 FrameChangeDetector 失败");
+		return false;
+	}
+
 	Logger::Get().Info("GDIFrameSource 初始化完成");
 	return true;
 }
@@ -81,6 +89,11 @@ bool GDIFrameSource::Initialize() {
 FrameSourceBase::UpdateState GDIFrameSource::Update() {
 	HWND hwndSrc = App::Get().GetHwndSrc();
 
+	// 上一次捕获的帧和再之前的帧相同时，假定这一帧也没有改变。猜错时
+	// 下一次 Update 会得到上一次捕获的帧已改变的结果，并返回 NewFrame
+	const bool lastFrameUnchanged = _hasPendingFrame && !_changeDetector.IsLastFrameChanged();
+	_hasPendingFrame = false;
+
 	HDC hdcDest;
 	HRESULT hr = _dxgiSurface->GetDC(TRUE, &hdcDest);
 	if (FAILED(hr)) {
@@ -104,5 +117,9 @@ FrameSourceBase::UpdateState GDIFrameSource::Update() {
 	ReleaseDC(hwndSrc, hdcSrc);
 	_dxgiSurface->ReleaseDC(nullptr);
 
-	return UpdateState::NewFrame;
+	// 捕获的帧直接写入 _output，不增加延迟
+	_changeDetector.Submit(_output.get());
+	_hasPendingFrame = true;
+
+	return lastFrameUnchanged ? UpdateState::NoUpdate : UpdateState::NewFrame;
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "FrameSourceBase.h"
+#include "FrameChangeDetector.h"
 
 
 class GDIFrameSource : public FrameSourceBase {
@@ -28,4 +29,8 @@ protected:
 private:
 	RECT _frameRect{};
 	winrt::com_ptr<IDXGISurface1> _dxgiSurface;
+
+	// 检测帧是否改变，结果晚一帧
+	FrameChangeDetector _changeDetector;
+	bool _hasPendingFrame = false;
 };
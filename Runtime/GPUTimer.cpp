@@ -2,7 +2,6 @@
 #include "GPUTimer.h"
 #include "App.h"
 #include "DeviceResources.h"
-#include "Config.h"
 
 using namespace std::chrono_literals;
 
@@ -30,43 +29,78 @@ void GPUTimer::OnBeginFrame() {
 void GPUTimer::StartProfiling(std::chrono::microseconds updateInterval, UINT passCount) {
 	assert(passCount > 0);
 
-	_curQueryIdx = 0;
 	_updateProfilingTime = updateInterval;
 	_profilingCounter = {};
 
-	_queries[0].passes.resize(passCount);
-	if (App::Get().GetConfig().IsDisableLowLatency()) {
-		_queries[1].passes.resize(passCount);
+	auto d3dDevice = App::Get().GetDeviceResources().GetD3DDevice();
+	for (_QueryInfo& queryInfo : _queries) {
+		D3D11_QUERY_DESC desc{ D3D11_QUERY_TIMESTAMP_DISJOINT, 0 };
+		d3dDevice->CreateQuery(&desc, queryInfo.disjoint.put());
+
+		desc.Query = D3D11_QUERY_TIMESTAMP;
+		d3dDevice->CreateQuery(&desc, queryInfo.start.put());
+		queryInfo.passes.resize(passCount);
+		for (winrt::com_ptr<ID3D11Query>& query : queryInfo.passes) {
+			d3dDevice->CreateQuery(&desc, query.put());
+		}
+
+		queryInfo.pending = false;
 	}
+
+	for (FrameGPUTimings& frame : _retrievedFrames) {
+		frame.passes.resize(passCount);
+	}
+	_retrievedFrameCount = 0;
+
+	_curQueryIdx = 0;
+	_oldestQueryIdx = 0;
+	_isQueryingCurFrame = false;
+	_isProfiling = true;
+	_retrievedFramesInInterval = 0;
+
 	_passesTimings.resize(passCount);
 	_gpuTimings.passes.resize(passCount);
 	_firstProfilingFrame = true;
 }
 
 void GPUTimer::StopProfiling() {
-	_curQueryIdx = -1;
+	_isProfiling = false;
+	_isQueryingCurFrame = false;
 	_updateProfilingTime = {};
 	_profilingCounter = {};
 
 	_queries = {};
 	_passesTimings = {};
 	_gpuTimings = {};
+	_retrievedFrames = {};
+	_retrievedFrameCount = 0;
 }
 
 void GPUTimer::OnBeginEffects() {
-	if (_curQueryIdx < 0) {
+	if (!_isProfiling) {
 		return;
 	}
 
 	_UpdateGPUTimings();
 
+	// GPU 落后太多时缓冲区已满，跳过此帧
+	_isQueryingCurFrame = !_queries[_curQueryIdx].pending;
+	if (!_isQueryingCurFrame) {
+		return;
+	}
+
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	_queries[_curQueryIdx].frameIdx = _frameCount;
+	_queries[_curQueryIdx].submitTime = now.QuadPart;
+
 	auto d3dDC = App::Get().GetDeviceResources().GetD3DDC();
 	d3dDC->Begin(_queries[_curQueryIdx].disjoint.get());
 	d3dDC->End(_queries[_curQueryIdx].start.get());
 }
 
 void GPUTimer::OnEndPass(UINT idx) {
-	if (_curQueryIdx < 0) {
+	if (!_isQueryingCurFrame) {
 		return;
 	}
 
@@ -74,96 +108,127 @@ void GPUTimer::OnEndPass(UINT idx) {
 }
 
 void GPUTimer::OnEndEffects() {
-	if (_curQueryIdx < 0) {
+	if (!_isQueryingCurFrame) {
 		return;
 	}
 
 	App::Get().GetDeviceResources().GetD3DDC()->End(_queries[_curQueryIdx].disjoint.get());
+
+	_queries[_curQueryIdx].pending = true;
+	_curQueryIdx = (_curQueryIdx + 1) % QUERY_RING_SIZE;
+	_isQueryingCurFrame = false;
 }
 
+// 不刷新命令缓冲区也不等待，结果还不可用时返回 false
 template<typename T>
-static T GetQueryData(ID3D11DeviceContext3* d3dDC, ID3D11Query* query) {
-	T data{};
-	while (S_OK != d3dDC->GetData(query, &data, sizeof(data), 0)) {
-		Sleep(0);
-	}
-	return data;
+static bool TryGetQueryData(ID3D11DeviceContext3* d3dDC, ID3D11Query* query, T& data) {
+	return d3dDC->GetData(query, &data, sizeof(data), D3D11_ASYNC_GETDATA_DONOTFLUSH) == S_OK;
 }
 
-void GPUTimer::_UpdateGPUTimings() {
-	if (_curQueryIdx < 0) {
-		return;
+bool GPUTimer::_RetrieveQueryData(_QueryInfo& queryInfo) {
+	auto d3dDC = App::Get().GetDeviceResources().GetD3DDC();
+
+	// disjoint 查询最后结束，它可用时所有时间戳也已可用
+	D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjointData{};
+	if (!TryGetQueryData(d3dDC, queryInfo.disjoint.get(), disjointData)) {
+		return false;
 	}
 
-	if (App::Get().GetConfig().IsDisableLowLatency()) {
-		_curQueryIdx = 1 - _curQueryIdx;
+	UINT64 startTimestamp = 0;
+	if (!TryGetQueryData(d3dDC, queryInfo.start.get(), startTimestamp)) {
+		return false;
 	}
 
-	auto& curQueryInfo = _queries[_curQueryIdx];
+	// 先读取所有时间戳，以免只统计了部分通道
+	_timestamps.resize(queryInfo.passes.size());
+	for (size_t i = 0; i < queryInfo.passes.size(); ++i) {
+		if (!TryGetQueryData(d3dDC, queryInfo.passes[i].get(), _timestamps[i])) {
+			return false;
+		}
+	}
 
-	if (curQueryInfo.disjoint) {
-		auto d3dDC = App::Get().GetDeviceResources().GetD3DDC();
+	if (disjointData.Disjoint) {
+		// 查询的值不可靠
+		return true;
+	}
 
-		D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjointData = 
-			GetQueryData<D3D11_QUERY_DATA_TIMESTAMP_DISJOINT>(d3dDC, curQueryInfo.disjoint.get());
+	const float toMS = 1000.0f / disjointData.Frequency;
+	const UINT64 frameStartTimestamp = startTimestamp;
 
-		if (!disjointData.Disjoint) {
-			const float toMS = 1000.0f / disjointData.Frequency;
+	FrameGPUTimings& frame = _retrievedFrames[_retrievedFrameCount++];
+	frame.frameIdx = queryInfo.frameIdx;
+	frame.submitTime = queryInfo.submitTime;
 
-			UINT64 startTimestamp = GetQueryData<UINT64>(d3dDC, curQueryInfo.start.get());
+	for (size_t i = 0; i < _timestamps.size(); ++i) {
+		UINT64 timestamp = _timestamps[i];
 
-			for (size_t i = 0; i < curQueryInfo.passes.size(); ++i) {
-				UINT64 timestamp = GetQueryData<UINT64>(d3dDC, curQueryInfo.passes[i].get());
+		float t = (timestamp - startTimestamp) * toMS;
+		frame.passes[i] = t;
+		if (t > 0.01) {
+			_passesTimings[i].first += t;
+			++_passesTimings[i].second;
+		}
+		startTimestamp = timestamp;
+	}
+
+	frame.total = (startTimestamp - frameStartTimestamp) * toMS;
+	++_retrievedFramesInInterval;
 
-				float t = (timestamp - startTimestamp) * toMS;
-				if (t > 0.01) {
-					_passesTimings[i].first += t;
-					++_passesTimings[i].second;
-				}
-				startTimestamp = timestamp;
-			}
-		} else {
-			// 查询的值不可靠
+	if (_firstProfilingFrame) {
+		_firstProfilingFrame = false;
 
-#ifdef _DEBUG
-			// 依然执行查询，否则调试层将发出警告
-			GetQueryData<D3D11_QUERY_DATA_TIMESTAMP_DISJOINT>(d3dDC, curQueryInfo.disjoint.get());
-			for (auto& query : curQueryInfo.passes) {
-				GetQueryData<UINT64>(d3dDC, query.get());
-			}
-#endif // _DEBUG
+		// 取得第一帧的结果后立即更新一次
+		for (UINT i = 0; i < _passesTimings.size(); ++i) {
+			_gpuTimings.passes[i] = _passesTimings[i].first;
 		}
+	}
 
-		_profilingCounter += _elapsedTime;
+	return true;
+}
 
-		if (_firstProfilingFrame) {
-			_firstProfilingFrame = false;
+void GPUTimer::RetrievePendingFrames() {
+	if (!_isProfiling) {
+		return;
+	}
 
-			// 在第一帧更新一次
-			for (UINT i = 0; i < _passesTimings.size(); ++i) {
-				_gpuTimings.passes[i] = _passesTimings[i].first;
-			}
-		} else if (_profilingCounter >= _updateProfilingTime) {
-			// 更新渲染用时
-			for (UINT i = 0; i < _passesTimings.size(); ++i) {
-				_gpuTimings.passes[i] = _passesTimings[i].second == 0 ?
-					0.0f : _passesTimings[i].first / _passesTimings[i].second;
-			}
+	_RetrieveCompletedQueries();
+}
 
-			std::fill(_passesTimings.begin(), _passesTimings.end(), std::pair<float, UINT>());
+void GPUTimer::_RetrieveCompletedQueries() {
+	_retrievedFrameCount = 0;
 
-			_profilingCounter %= _updateProfilingTime;
+	// 按提交顺序检索所有已完成的查询
+	while (_queries[_oldestQueryIdx].pending) {
+		if (!_RetrieveQueryData(_queries[_oldestQueryIdx])) {
+			break;
 		}
-	} else {
-		auto d3dDevice = App::Get().GetDeviceResources().GetD3DDevice();
 
-		D3D11_QUERY_DESC desc{ D3D11_QUERY_TIMESTAMP_DISJOINT, 0 };
-		d3dDevice->CreateQuery(&desc, curQueryInfo.disjoint.put());
+		_queries[_oldestQueryIdx].pending = false;
+		_oldestQueryIdx = (_oldestQueryIdx + 1) % QUERY_RING_SIZE;
+	}
+}
 
-		desc.Query = D3D11_QUERY_TIMESTAMP;
-		d3dDevice->CreateQuery(&desc, curQueryInfo.start.put());
-		for (UINT j = 0; j < curQueryInfo.passes.size(); ++j) {
-			d3dDevice->CreateQuery(&desc, curQueryInfo.passes[j].put());
-		}
+void GPUTimer::_UpdateGPUTimings() {
+	_RetrieveCompletedQueries();
+
+	_profilingCounter += _elapsedTime;
+	// 此间隔内没有检索到结果时推迟更新
+	if (_profilingCounter < _updateProfilingTime || _retrievedFramesInInterval == 0) {
+		return;
+	}
+
+	// 更新渲染用时
+	for (UINT i = 0; i < _passesTimings.size(); ++i) {
+		_gpuTimings.passes[i] = _passesTimings[i].second == 0 ?
+			0.0f : _passesTimings[i].first / _passesTimings[i].second;
+	}
+
+	std::fill(_passesTimings.begin(), _passesTimings.end(), std::pair<float, UINT>());
+	_retrievedFramesInInterval = 0;
+
+	if (_updateProfilingTime.count() > 0) {
+		_profilingCounter %= _updateProfilingTime;
+	} else {
+		_profilingCounter = {};
 	}
 }
@@ -43,9 +43,43 @@ public:
 
 	void OnEndEffects();
 
+	struct FrameGPUTimings {
+		// 提交时的帧序号
+		UINT frameIdx = 0;
+		// 开始提交效果的时间，单位为 QueryPerformanceCounter 的计数
+		INT64 submitTime = 0;
+		// 所有通道的总用时，单位为 ms
+		float total = 0;
+		std::vector<float> passes;
+	};
+
+	// 本帧的 OnBeginEffects 中检索到的每一帧的 GPU 时间，按提交顺序排列
+	// 结果通常有两到四帧的延迟
+	std::span<const FrameGPUTimings> GetRetrievedFrames() const noexcept {
+		return { _retrievedFrames.data(), _retrievedFrameCount };
+	}
+
+	// 在帧之外检索已完成的查询，结果同样由 GetRetrievedFrames 取得
+	// 调用前应等待 GPU 完成，用于基准测试结束时取得最后几帧的结果
+	void RetrievePendingFrames();
+
 private:
 	void _UpdateGPUTimings();
 
+	void _RetrieveCompletedQueries();
+
+	struct _QueryInfo {
+		winrt::com_ptr<ID3D11Query> disjoint;
+		winrt::com_ptr<ID3D11Query> start;
+		std::vector<winrt::com_ptr<ID3D11Query>> passes;
+		UINT frameIdx = 0;
+		INT64 submitTime = 0;
+		// 已提交但还未取得结果
+		bool pending = false;
+	};
+
+	bool _RetrieveQueryData(_QueryInfo& queryInfo);
+
 	std::chrono::time_point<std::chrono::steady_clock> _lastTimePoint;
 
 	std::chrono::nanoseconds _elapsedTime{};
@@ -63,19 +97,26 @@ private:
 	std::chrono::nanoseconds _updateProfilingTime{};
 	std::chrono::nanoseconds _profilingCounter{};
 
-	struct _QueryInfo {
-		winrt::com_ptr<ID3D11Query> disjoint;
-		winrt::com_ptr<ID3D11Query> start;
-		std::vector<winrt::com_ptr<ID3D11Query>> passes;
-	};
-	// [(disjoint, [timestamp])]
-	// 允许额外的延迟时需保存两帧的数据
-	std::array<_QueryInfo, 2> _queries;
-	// -1：无需统计渲染时间
-	// 否则为当前帧在 _queries 中的位置
-	int _curQueryIdx = -1;
+	// 查询的环形缓冲区。结果通常在两到四帧后可用，检索时不等待 GPU，
+	// 因此统计渲染时间不会影响帧的节奏
+	static constexpr UINT QUERY_RING_SIZE = 6;
+	std::array<_QueryInfo, QUERY_RING_SIZE> _queries;
+	// 当前帧在 _queries 中的位置
+	UINT _curQueryIdx = 0;
+	// 最旧的未取得结果的查询
+	UINT _oldestQueryIdx = 0;
+	// 当前帧是否提交了查询。缓冲区已满时跳过此帧
+	bool _isQueryingCurFrame = false;
+	bool _isProfiling = false;
 
 	// 用于保存渲染时间
 	// (总计用时, 已统计帧数)
 	std::vector<std::pair<float, UINT>> _passesTimings;
+	// 当前更新间隔内检索到结果的帧数
+	UINT _retrievedFramesInInterval = 0;
+	// 检索查询结果时的临时存储
+	std::vector<UINT64> _timestamps;
+
+	std::array<FrameGPUTimings, QUERY_RING_SIZE> _retrievedFrames;
+	UINT _retrievedFrameCount = 0;
 };
@@ -144,7 +144,11 @@ bool GraphicsCaptureFrameSource::Initialize() {
 		return false;
 	}
 
-	InitializeConditionVariable(&_cv);
+	_newFrameEvent.reset(CreateEvent(nullptr, FALSE, FALSE, nullptr));
+	if (!_newFrameEvent) {
+		Logger::Get().Win32Error("CreateEvent 失败");
+		return false;
+	}
 
 	App::Get().SetErrorMsg(ErrorMessages::GENERIC);
 	Logger::Get().Info("GraphicsCaptureFrameSource 初始化完成");
@@ -152,21 +156,26 @@ bool GraphicsCaptureFrameSource::Initialize() {
 }
 
 FrameSourceBase::UpdateState GraphicsCaptureFrameSource::Update() {
-	// 每次睡眠 1 毫秒等待新帧到达，防止 CPU 占用过高
+	// 不在此处等待，主线程会在 _newFrameEvent 上阻塞直到新帧到达
 	BOOL update = FALSE;
 
 	{
 		std::scoped_lock lk(_cs);
-		if (!_newFrameArrived) {
-			SleepConditionVariableCS(&_cv, _cs.get(), 1);
-		}
-
 		if (_newFrameArrived) {
 			_newFrameArrived = false;
 			update = TRUE;
 		}
 	}
 
+	if (_retiredFrame) {
+		// 尽早归还 GPU 已不再读取的帧
+		if (App::Get().GetDeviceResources().GetD3DDC()->GetData(
+			_retiredQuery.get(), nullptr, 0, D3D11_ASYNC_GETDATA_DONOTFLUSH) == S_OK) {
+			_retiredFrame.Close();
+			_retiredFrame = nullptr;
+		}
+	}
+
 	if (update) {
 		winrt::Direct3D11CaptureFrame frame = _captureFramePool.TryGetNextFrame();
 		if (!frame) {
@@ -190,8 +199,27 @@ FrameSourceBase::UpdateState GraphicsCaptureFrameSource::Update() {
 			return UpdateState::Error;
 		}
 
-		App::Get().GetDeviceResources().GetD3DDC()
-			->CopySubresourceRegion(_output.get(), 0, 0, 0, 0, withFrame.get(), 0, &_frameBox);
+		if (_isZeroCopy) {
+			// 效果直接读取帧的表面。旧的帧要等 GPU 完成读取后才能归还给缓冲池，
+			// 否则捕获可能写入正在被读取的表面
+			ID3D11DeviceContext3* d3dDC = App::Get().GetDeviceResources().GetD3DDC();
+			if (_retiredFrame) {
+				// 查询在一帧或更早之前提交，通常已经完成
+				DeviceResources::WaitForQuery(d3dDC, _retiredQuery.get());
+				_retiredFrame.Close();
+			}
+
+			if (_curFrame) {
+				_retiredFrame = std::move(_curFrame);
+				// 此前读取它的通道都已提交
+				d3dDC->End(_retiredQuery.get());
+			}
+			_curFrame = std::move(frame);
+			_output = std::move(withFrame);
+		} else {
+			App::Get().GetDeviceResources().GetD3DDC()
+				->CopySubresourceRegion(_output.get(), 0, 0, 0, 0, withFrame.get(), 0, &_frameBox);
+		}
 
 		return UpdateState::NewFrame;
 	} else {
@@ -344,20 +372,62 @@ bool GraphicsCaptureFrameSource::_CaptureFromMonitor(IGraphicsCaptureItemInterop
 	return true;
 }
 
+bool GraphicsCaptureFrameSource::EnableZeroCopy() {
+	D3D11_QUERY_DESC queryDesc{ D3D11_QUERY_EVENT, 0 };
+	HRESULT hr = App::Get().GetDeviceResources().GetD3DDevice()->CreateQuery(&queryDesc, _retiredQuery.put());
+	if (FAILED(hr)) {
+		Logger::Get().ComError("CreateQuery 失败", hr);
+		return false;
+	}
+
+	// 当前帧被效果使用，上一帧可能仍在被 GPU 读取，需要第三个缓冲区接收新帧
+	try {
+		_captureFramePool.Recreate(
+			_wrappedD3DDevice,
+			winrt::DirectXPixelFormat::B8G8R8A8UIntNormalized,
+			3,
+			{ (int)_frameBox.right, (int)_frameBox.bottom }
+		);
+	} catch (const winrt::hresult_error& e) {
+		Logger::Get().Error(StrUtils::Concat("重新创建帧缓冲池失败：", StrUtils::UTF16ToUTF8(e.message())));
+		return false;
+	}
+
+	// 不再需要复制的目标
+	_output = nullptr;
+
+	_outputBox = _frameBox;
+	_outputTextureSize = { (LONG)_frameBox.right, (LONG)_frameBox.bottom };
+	_isZeroCopy = true;
+
+	Logger::Get().Info("已启用零拷贝");
+	return true;
+}
+
 void GraphicsCaptureFrameSource::_OnFrameArrived(winrt::Direct3D11CaptureFramePool const&, winrt::IInspectable const&) {
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	_frameArrivalTime.store(now.QuadPart, std::memory_order_relaxed);
+
 	// 更改标志，如果主线程正在等待，唤醒主线程
 	{
 		std::scoped_lock lk(_cs);
 		_newFrameArrived = true;
 	}
 
-	WakeConditionVariable(&_cv);
+	SetEvent(_newFrameEvent.get());
 }
 
 GraphicsCaptureFrameSource::~GraphicsCaptureFrameSource() {
 	if (_frameArrived) {
 		_frameArrived.revoke();
 	}
+	if (_retiredFrame) {
+		_retiredFrame.Close();
+	}
+	if (_curFrame) {
+		_curFrame.Close();
+	}
 	if (_captureSession) {
 		_captureSession.Close();
 	}
@@ -34,6 +34,12 @@ public:
 		return "Graphics Capture";
 	}
 
+	bool IsZeroCopySupported() const noexcept override {
+		return true;
+	}
+
+	bool EnableZeroCopy() override;
+
 protected:
 	bool _HasRoundCornerInWin11() override {
 		return true;
@@ -58,9 +64,13 @@ private:
 	winrt::GraphicsCaptureSession _captureSession{ nullptr };
 	winrt::IDirect3DDevice _wrappedD3DDevice{ nullptr };
 	winrt::Direct3D11CaptureFramePool::FrameArrived_revoker _frameArrived;
+	// 零拷贝时持有当前帧，直到下一帧到达
+	winrt::Direct3D11CaptureFrame _curFrame{ nullptr };
+	// 被替换的帧可能仍被已提交的通道读取，_retiredQuery 完成后才能归还给缓冲池
+	winrt::Direct3D11CaptureFrame _retiredFrame{ nullptr };
+	winrt::com_ptr<ID3D11Query> _retiredQuery;
 
 	// 用于线程同步
-	CONDITION_VARIABLE _cv{};
 	Utils::CSMutex _cs;
 	bool _newFrameArrived = false;
 };
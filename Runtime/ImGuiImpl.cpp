@@ -183,12 +183,9 @@ bool ImGuiImpl::Initialize() {
 	return true;
 }
 
-static void UpdateMousePos() {
-	ImGuiIO& io = ImGui::GetIO();
-
+static ImVec2 GetMousePos() {
 	if (App::Get().GetConfig().Is3DMode() && !App::Get().GetRenderer().IsUIVisiable()) {
-		io.MousePos = ImVec2(-FLT_MAX, -FLT_MAX);
-		return;
+		return ImVec2(-FLT_MAX, -FLT_MAX);
 	}
 
 	POINT pos;
@@ -199,8 +196,7 @@ static void UpdateMousePos() {
 		GetCursorPos(&pos);
 
 		if (WindowFromPoint(pos) != App::Get().GetHwndHost()) {
-			io.MousePos = ImVec2(-FLT_MAX, -FLT_MAX);
-			return;
+			return ImVec2(-FLT_MAX, -FLT_MAX);
 		}
 
 		const RECT& hostRect = App::Get().GetHostWndRect();
@@ -212,7 +208,7 @@ static void UpdateMousePos() {
 	pos.x -= outputRect.left;
 	pos.y -= outputRect.top;
 
-	io.MousePos = ImVec2((float)pos.x, (float)pos.y);
+	return ImVec2((float)pos.x, (float)pos.y);
 }
 
 void ImGuiImpl::NewFrame() {
@@ -224,7 +220,15 @@ void ImGuiImpl::NewFrame() {
 	io.DisplaySize = ImVec2((float)(outputRect.right - outputRect.left), (float)(outputRect.bottom - outputRect.top));
 
 	// Update OS mouse position
-	UpdateMousePos();
+	io.MousePos = GetMousePos();
+	std::copy(std::begin(io.MouseDown), std::end(io.MouseDown), _lastMouseDown.begin());
+
+	// 不是每帧都调用 NewFrame，使用实际经过的时间使动画速度正确
+	auto now = std::chrono::steady_clock::now();
+	if (_lastNewFrameTime != std::chrono::steady_clock::time_point{}) {
+		io.DeltaTime = std::max(std::chrono::duration<float>(now - _lastNewFrameTime).count(), 1e-4f);
+	}
+	_lastNewFrameTime = now;
 
 	// 不接受键盘输入
 	if (io.WantCaptureKeyboard) {
@@ -274,6 +278,24 @@ void ImGuiImpl::NewFrame() {
 	}
 }
 
+static_assert(sizeof(ImGuiIO::MouseDown) == 5 * sizeof(bool), "_lastMouseDown 的大小和 ImGuiIO::MouseDown 不同");
+
+bool ImGuiImpl::HasInputChanged() const {
+	const ImGuiIO& io = ImGui::GetIO();
+
+	// 滚轮数据在 NewFrame 中清零
+	if (io.MouseWheel != 0 || io.MouseWheelH != 0) {
+		return true;
+	}
+
+	if (!std::equal(_lastMouseDown.begin(), _lastMouseDown.end(), std::begin(io.MouseDown))) {
+		return true;
+	}
+
+	const ImVec2 pos = GetMousePos();
+	return pos.x != io.MousePos.x || pos.y != io.MousePos.y;
+}
+
 void ImGuiImpl::EndFrame() {
 	const RECT& outputRect = App::Get().GetRenderer().GetOutputRect();
 	ImGui::GetDrawData()->DisplayPos = ImVec2(float(-outputRect.left), float(-outputRect.top));
@@ -18,6 +18,10 @@ public:
 
 	void ClearStates();
 
+	// 自上次 NewFrame 以来是否有鼠标输入
+	// 没有输入且内容不变时可以跳过 NewFrame，由 EndFrame 重新绘制上一次的结果
+	bool HasInputChanged() const;
+
 	// 将提示窗口限制在屏幕内
 	static void Tooltip(const char* content, float maxWidth = -1.0f);
 private:
@@ -27,4 +31,7 @@ private:
 	HANDLE _hHookThread = NULL;
 	DWORD _hookThreadId = 0;
 	std::atomic<float> _wheelData = 0;
+
+	std::array<bool, 5> _lastMouseDown{};
+	std::chrono::steady_clock::time_point _lastNewFrameTime;
 };
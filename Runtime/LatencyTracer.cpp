@@ -0,0 +1,205 @@
+#include "pch.h"
+#include "LatencyTracer.h"
+#include "App.h"
+#include "DeviceResources.h"
+#include "Logger.h"
+#include "StrUtils.h"
+
+
+void LatencyTracer::Histogram::Add(float ms) noexcept {
+	UINT idx = (UINT)std::clamp(ms / BUCKET_WIDTH, 0.0f, float(BUCKET_COUNT - 1));
+	++buckets[idx];
+	++count;
+	sum += ms;
+	max = std::max(max, ms);
+}
+
+float LatencyTracer::Histogram::GetPercentile(float p) const noexcept {
+	if (count == 0) {
+		return 0.0f;
+	}
+
+	const UINT target = std::max(1U, (UINT)std::ceil(count * p));
+	UINT accum = 0;
+	for (UINT i = 0; i < BUCKET_COUNT; ++i) {
+		accum += buckets[i];
+		if (accum >= target) {
+			// 取桶的上界，不超过最大值
+			return std::min((i + 1) * BUCKET_WIDTH, max);
+		}
+	}
+
+	return max;
+}
+
+const char* LatencyTracer::GetStageName(Stage stage) noexcept {
+	switch (stage) {
+	case Stage::Capture:
+		return "Capture";
+	case Stage::Render:
+		return "Render";
+	case Stage::GPU:
+		return "GPU";
+	case Stage::Display:
+		return "Display";
+	case Stage::Total:
+		return "Total";
+	default:
+		return "";
+	}
+}
+
+void LatencyTracer::Start() {
+	if (_isStarted) {
+		return;
+	}
+
+	LARGE_INTEGER freq;
+	QueryPerformanceFrequency(&freq);
+	_qpcFrequency = freq.QuadPart;
+
+	Reset();
+	_isStarted = true;
+}
+
+void LatencyTracer::Stop() {
+	_isStarted = false;
+}
+
+void LatencyTracer::OnFrameUpdated(INT64 arrivalTime) noexcept {
+	if (!_isStarted) {
+		return;
+	}
+
+	_updateTime = Now();
+	// 同步捕获的方式取得帧即为到达
+	_arrivalTime = arrivalTime > 0 ? std::min(arrivalTime, _updateTime) : _updateTime;
+	_hasNewFrame = true;
+
+	_AddSample(Stage::Capture, _arrivalTime, _updateTime);
+}
+
+void LatencyTracer::OnEffectsSubmitted() noexcept {
+	if (!_isStarted || !_hasNewFrame) {
+		return;
+	}
+
+	_submitTime = Now();
+	_AddSample(Stage::Render, _updateTime, _submitTime);
+}
+
+void LatencyTracer::OnGPUTime(float ms) noexcept {
+	if (!_isStarted) {
+		return;
+	}
+
+	_histograms[(size_t)Stage::GPU].Add(ms);
+}
+
+void LatencyTracer::OnPresented() {
+	if (!_isStarted) {
+		return;
+	}
+
+	if (_hasNewFrame) {
+		_hasNewFrame = false;
+
+		UINT presentCount = 0;
+		HRESULT hr = App::Get().GetDeviceResources().GetSwapChain()->GetLastPresentCount(&presentCount);
+		if (SUCCEEDED(hr) && _isFrameStatisticsAvailable) {
+			_pendingPresents[_pendingPresentIdx] = { presentCount, _arrivalTime, _submitTime };
+			_pendingPresentIdx = (_pendingPresentIdx + 1) % (UINT)_pendingPresents.size();
+		} else {
+			// 无法得知显示的时间，以 Present 返回作为终点
+			_AddSample(Stage::Total, _arrivalTime, Now());
+		}
+	}
+
+	_ResolveDisplayTimes();
+}
+
+void LatencyTracer::Reset() noexcept {
+	_hasNewFrame = false;
+	_pendingPresents = {};
+	_pendingPresentIdx = 0;
+	_histograms = {};
+}
+
+bool LatencyTracer::Export(const wchar_t* fileName) const {
+	std::string csv = "bucket_ms";
+	for (size_t i = 0; i < (size_t)Stage::COUNT; ++i) {
+		csv.append(",");
+		csv.append(GetStageName((Stage)i));
+	}
+	csv.append("\n");
+
+	for (UINT i = 0; i < BUCKET_COUNT; ++i) {
+		csv.append(fmt::format("{:.1f}", i * BUCKET_WIDTH));
+		for (const Histogram& histogram : _histograms) {
+			csv.append(fmt::format(",{}", histogram.buckets[i]));
+		}
+		csv.append("\n");
+	}
+
+	// 附加汇总
+	static constexpr std::pair<const char*, float> SUMMARIES[] = { {"p50", 0.5f}, {"p95", 0.95f}, {"p99", 0.99f} };
+	csv.append("avg");
+	for (const Histogram& histogram : _histograms) {
+		csv.append(fmt::format(",{:.3f}", histogram.GetAverage()));
+	}
+	csv.append("\n");
+	for (const auto& [name, p] : SUMMARIES) {
+		csv.append(name);
+		for (const Histogram& histogram : _histograms) {
+			csv.append(fmt::format(",{:.3f}", histogram.GetPercentile(p)));
+		}
+		csv.append("\n");
+	}
+	csv.append("max");
+	for (const Histogram& histogram : _histograms) {
+		csv.append(fmt::format(",{:.3f}", histogram.max));
+	}
+	csv.append("\n");
+
+	if (!Utils::WriteFile(fileName, csv.data(), csv.size())) {
+		Logger::Get().Error(StrUtils::Concat("写入 ", StrUtils::UTF16ToUTF8(fileName), " 失败"));
+		return false;
+	}
+
+	Logger::Get().Info(StrUtils::Concat("已导出延迟统计到 ", StrUtils::UTF16ToUTF8(fileName)));
+	return true;
+}
+
+void LatencyTracer::_AddSample(Stage stage, INT64 begin, INT64 end) noexcept {
+	_histograms[(size_t)stage].Add(_ToMS(end - begin));
+}
+
+void LatencyTracer::_ResolveDisplayTimes() {
+	// 只有独占全屏或独立翻转时才有帧统计信息，窗口化时通常返回 DXGI_ERROR_FRAME_STATISTICS_DISJOINT
+	DXGI_FRAME_STATISTICS stats{};
+	HRESULT hr = App::Get().GetDeviceResources().GetSwapChain()->GetFrameStatistics(&stats);
+	if (FAILED(hr) || stats.SyncQPCTime.QuadPart == 0) {
+		if (_isFrameStatisticsAvailable) {
+			// 丢弃未得到显示时间的帧
+			_pendingPresents = {};
+			_isFrameStatisticsAvailable = false;
+		}
+		return;
+	}
+
+	_isFrameStatisticsAvailable = true;
+
+	for (_PendingPresent& pending : _pendingPresents) {
+		if (pending.presentCount == 0 || pending.presentCount > stats.PresentCount) {
+			continue;
+		}
+
+		if (pending.presentCount == stats.PresentCount) {
+			_AddSample(Stage::Display, pending.submitTime, stats.SyncQPCTime.QuadPart);
+			_AddSample(Stage::Total, pending.arrivalTime, stats.SyncQPCTime.QuadPart);
+		}
+
+		// 更早的帧已错过统计
+		pending.presentCount = 0;
+	}
+}
@@ -0,0 +1,113 @@
+#pragma once
+#include "pch.h"
+
+
+// 记录每帧从捕获到显示各阶段的延迟并统计为直方图
+// 所有时间点均使用 QueryPerformanceCounter 的计数
+class LatencyTracer {
+public:
+	enum class Stage {
+		// 捕获到的帧到达（或源窗口呈现）到 FrameSource::Update 取走该帧
+		Capture,
+		// Update 到效果提交完毕
+		Render,
+		// 效果在 GPU 上的执行时间，来自 GPUTimer，仅在统计渲染时间时可用
+		GPU,
+		// 提交完毕到画面显示，需要 DXGI 帧统计信息
+		Display,
+		// 捕获到显示。不支持帧统计信息时为捕获到 Present 返回
+		Total,
+		COUNT
+	};
+
+	static constexpr UINT BUCKET_COUNT = 128;
+	// 每个桶 0.5ms，超过 64ms 的计入最后一个桶
+	static constexpr float BUCKET_WIDTH = 0.5f;
+
+	struct Histogram {
+		std::array<UINT, BUCKET_COUNT> buckets{};
+		UINT count = 0;
+		double sum = 0;
+		float max = 0;
+
+		void Add(float ms) noexcept;
+
+		float GetAverage() const noexcept {
+			return count == 0 ? 0.0f : float(sum / count);
+		}
+
+		// 根据直方图估算百分位数，p 在 0~1 之间
+		float GetPercentile(float p) const noexcept;
+	};
+
+	static const char* GetStageName(Stage stage) noexcept;
+
+	static INT64 Now() noexcept {
+		LARGE_INTEGER t;
+		QueryPerformanceCounter(&t);
+		return t.QuadPart;
+	}
+
+	void Start();
+
+	void Stop();
+
+	bool IsStarted() const noexcept {
+		return _isStarted;
+	}
+
+	// 取得新帧后调用，arrivalTime 为 0 表示捕获方式不提供到达时间
+	void OnFrameUpdated(INT64 arrivalTime) noexcept;
+
+	void OnEffectsSubmitted() noexcept;
+
+	void OnGPUTime(float ms) noexcept;
+
+	// Present 返回后调用
+	void OnPresented();
+
+	const Histogram& GetHistogram(Stage stage) const noexcept {
+		return _histograms[(size_t)stage];
+	}
+
+	// 是否可以获得显示的时间
+	bool IsDisplayTimeAvailable() const noexcept {
+		return _isFrameStatisticsAvailable;
+	}
+
+	void Reset() noexcept;
+
+	// 导出为 CSV，每行一个桶
+	bool Export(const wchar_t* fileName) const;
+
+private:
+	float _ToMS(INT64 ticks) const noexcept {
+		return float(ticks * 1000.0 / _qpcFrequency);
+	}
+
+	void _AddSample(Stage stage, INT64 begin, INT64 end) noexcept;
+
+	void _ResolveDisplayTimes();
+
+	bool _isStarted = false;
+	INT64 _qpcFrequency = 1;
+
+	// 当前帧的时间点
+	INT64 _arrivalTime = 0;
+	INT64 _updateTime = 0;
+	INT64 _submitTime = 0;
+	bool _hasNewFrame = false;
+
+	// 等待得到显示时间的帧
+	struct _PendingPresent {
+		UINT presentCount;
+		INT64 arrivalTime;
+		INT64 submitTime;
+	};
+	std::array<_PendingPresent, 8> _pendingPresents{};
+	UINT _pendingPresentIdx = 0;
+
+	bool _isFrameStatisticsAvailable = false;
+
+	std::array<Histogram, (size_t)Stage::COUNT> _histograms;
+};
@@ -5,7 +5,10 @@
 #include <imgui.h>
 #include "ImGuiImpl.h"
 #include "Renderer.h"
+#include "EffectDrawer.h"
 #include "GPUTimer.h"
+#include "LatencyTracer.h"
+#include "FrameStatistics.h"
 #include "Logger.h"
 #include "Config.h"
 #include "StrUtils.h"
@@ -219,6 +222,13 @@ bool OverlayDrawer::Initialize() {
 	return true;
 }
 
+// 覆盖层打开时重新构建的间隔，图表以此频率更新已足够平滑
+static constexpr std::chrono::milliseconds UI_REBUILD_INTERVAL(100);
+// 输入后继续重新构建的帧数
+static constexpr UINT INPUT_SETTLE_FRAMES = 3;
+// 帧时间图表的采样数
+static constexpr UINT FRAME_TIME_SAMPLES = 180;
+
 void OverlayDrawer::Draw() {
 	bool isShowFPS = App::Get().GetConfig().IsShowFPS();
 
@@ -226,20 +236,68 @@ void OverlayDrawer::Draw() {
 		return;
 	}
 
-	_imguiImpl->NewFrame();
-	ImGui::PushFont(_fontUI);
+	if (_isUIVisiable) {
+		// 每帧都要采样，即使不重新构建
+		_RecordFrameTime();
+	}
+
+	// 构建覆盖层（NewFrame 和布局）的开销远大于绘制，内容不变时只重新绘制上一次的结果
+	if (_NeedsRebuild(isShowFPS)) {
+		_imguiImpl->NewFrame();
+		ImGui::PushFont(_fontUI);
+
+		if (isShowFPS) {
+			_DrawFPS();
+		}
+
+		if (_isUIVisiable) {
+			_DrawUI();
+		}
 
-	if (isShowFPS) {
-		_DrawFPS();
+		ImGui::PopFont();
+		ImGui::Render();
+
+		_isCacheDirty = false;
+		_lastRebuildTime = std::chrono::steady_clock::now();
+		_lastFPS = App::Get().GetRenderer().GetGPUTimer().GetFramesPerSecond();
 	}
-	
+
+	_imguiImpl->EndFrame();
+}
+
+bool OverlayDrawer::_NeedsRebuild(bool isShowFPS) {
+	if (_isCacheDirty || !ImGui::GetDrawData()) {
+		return true;
+	}
+
+	if (_imguiImpl->HasInputChanged()) {
+		_settleFrames = INPUT_SETTLE_FRAMES;
+		return true;
+	}
+
+	if (_settleFrames > 0) {
+		--_settleFrames;
+		return true;
+	}
+
 	if (_isUIVisiable) {
-		_DrawUI();
+		return std::chrono::steady_clock::now() - _lastRebuildTime >= UI_REBUILD_INTERVAL;
 	}
 
-	ImGui::PopFont();
-	ImGui::Render();
-	_imguiImpl->EndFrame();
+	// 只显示帧率时仅在帧率改变时重新构建，帧率每秒更新一次
+	return isShowFPS && _lastFPS != App::Get().GetRenderer().GetGPUTimer().GetFramesPerSecond();
+}
+
+void OverlayDrawer::_RecordFrameTime() {
+	if (_frameTimes.size() >= FRAME_TIME_SAMPLES) {
+		_frameTimes.erase(_frameTimes.begin(), _frameTimes.begin() + (_frameTimes.size() - FRAME_TIME_SAMPLES + 1));
+	} else if (_frameTimes.size() < FRAME_TIME_SAMPLES) {
+		_frameTimes.insert(_frameTimes.begin(), FRAME_TIME_SAMPLES - _frameTimes.size() - 1, 0);
+	}
+
+	const auto& gpuTimer = App::Get().GetRenderer().GetGPUTimer();
+	_frameTimes.push_back(std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(gpuTimer.GetElapsedTime()).count());
+	_validFrames = std::min(_validFrames + 1, FRAME_TIME_SAMPLES);
 }
 
 void OverlayDrawer::SetUIVisibility(bool value) {
@@ -247,6 +305,7 @@ void OverlayDrawer::SetUIVisibility(bool value) {
 		return;
 	}
 	_isUIVisiable = value;
+	_isCacheDirty = true;
 	
 	if (value) {
 		if (App::Get().GetConfig().Is3DMode()) {
@@ -686,16 +745,6 @@ void OverlayDrawer::_DrawUI() {
 
 	ImGui::Spacing();
 
-	static constexpr UINT nSamples = 180;
-
-	if (_frameTimes.size() >= nSamples) {
-		_frameTimes.erase(_frameTimes.begin(), _frameTimes.begin() + (_frameTimes.size() - nSamples + 1));
-	} else if (_frameTimes.size() < nSamples) {
-		_frameTimes.insert(_frameTimes.begin(), nSamples - _frameTimes.size() - 1, 0);
-	}
-	_frameTimes.push_back(std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(gpuTimer.GetElapsedTime()).count());
-	_validFrames = std::min(_validFrames + 1, nSamples);
-
 	// 帧率统计，支持在渲染时间和 FPS 间切换
 	if (ImGui::CollapsingHeader("Frame Statistics", ImGuiTreeNodeFlags_DefaultOpen)) {
 		static bool showFPS = true;
@@ -704,7 +753,7 @@ void OverlayDrawer::_DrawUI() {
 			float totalTime = 0;
 			float minTime = FLT_MAX;
 			float minTime2 = FLT_MAX;
-			for (UINT i = nSamples - _validFrames; i < nSamples; ++i) {
+			for (UINT i = FRAME_TIME_SAMPLES - _validFrames; i < FRAME_TIME_SAMPLES; ++i) {
 				totalTime += _frameTimes[i];
 
 				if (_frameTimes[i] <= minTime) {
@@ -732,7 +781,7 @@ void OverlayDrawer::_DrawUI() {
 			float totalTime = 0;
 			float maxTime = 0;
 			float maxTime2 = 0;
-			for (UINT i = nSamples - _validFrames; i < nSamples; ++i) {
+			for (UINT i = FRAME_TIME_SAMPLES - _validFrames; i < FRAME_TIME_SAMPLES; ++i) {
 				totalTime += _frameTimes[i];
 
 				if (_frameTimes[i] >= maxTime) {
@@ -760,6 +809,9 @@ void OverlayDrawer::_DrawUI() {
 		if (ImGui::Button(showFPS ? "Switch to timings" : "Switch to FPS")) {
 			showFPS = !showFPS;
 		}*/
+
+		ImGui::Spacing();
+		_DrawFramePercentiles();
 	}
 	
 	ImGui::Spacing();
@@ -980,9 +1032,249 @@ void OverlayDrawer::_DrawUI() {
 		ImGui::PopStyleVar();
 	}
 
+	ImGui::Spacing();
+	if (ImGui::CollapsingHeader("Pass Percentiles")) {
+		_DrawPassPercentiles();
+	}
+
+	ImGui::Spacing();
+	if (ImGui::CollapsingHeader("Latency")) {
+		_DrawLatency();
+	}
+
+	ImGui::Spacing();
+	if (ImGui::CollapsingHeader("Video Memory")) {
+		_DrawVideoMemory();
+	}
+
 	ImGui::End();
 }
 
+void OverlayDrawer::_DrawFramePercentiles() {
+	FrameStatistics& frameStatistics = App::Get().GetFrameStatistics();
+	const FrameStatistics::Summary summary = frameStatistics.GetSummary();
+
+	if (ImGui::BeginTable("percentiles", 2, ImGuiTableFlags_PadOuterX)) {
+		ImGui::TableSetupColumn("name", ImGuiTableColumnFlags_WidthStretch | ImGuiTableColumnFlags_NoResize | ImGuiTableColumnFlags_NoReorder);
+		ImGui::TableSetupColumn("value", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoResize | ImGuiTableColumnFlags_NoReorder);
+
+		const std::pair<const char*, std::string> rows[] = {
+			{ "1% low", fmt::format("{:.1f} FPS", summary.onePercentLowFPS) },
+			{ "p50", fmt::format("{:.1f} ms", summary.p50FrameTime) },
+			{ "p95", fmt::format("{:.1f} ms", summary.p95FrameTime) },
+			{ "p99", fmt::format("{:.1f} ms", summary.p99FrameTime) },
+			{ "Stutters (> 2x median)", std::to_string(summary.stutterCount) }
+		};
+
+		for (const auto& [name, value] : rows) {
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(name);
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(value.c_str());
+		}
+
+		ImGui::EndTable();
+	}
+
+	// 只绘制到 p99 的两倍，否则少数尖峰会压缩主要的分布
+	const AtomicHistogram& frameTimes = frameStatistics.GetFrameTimes();
+	const int bucketCount = std::clamp(
+		(int)std::ceil(summary.p99FrameTime * 2 / frameTimes.GetBucketWidth()), 16, (int)frameTimes.GetBucketCount());
+	ImGui::PlotHistogram("##frameTimes", [](void* data, int idx) {
+		return (float)((const AtomicHistogram*)data)->GetBucket(idx);
+	}, (void*)&frameTimes, bucketCount, 0,
+		fmt::format("0 ~ {:.1f} ms", bucketCount * frameTimes.GetBucketWidth()).c_str(),
+		0, FLT_MAX, ImVec2(250 * _dpiScale, 60 * _dpiScale));
+
+	if (ImGui::Button("Reset##frameStatistics")) {
+		frameStatistics.Reset();
+	}
+}
+
+void OverlayDrawer::_DrawPassPercentiles() {
+	Renderer& renderer = App::Get().GetRenderer();
+	const auto passTimes = App::Get().GetFrameStatistics().GetPassTimes();
+
+	if (!ImGui::BeginTable("passPercentiles", 3, ImGuiTableFlags_PadOuterX)) {
+		return;
+	}
+
+	ImGui::TableSetupColumn("Pass", ImGuiTableColumnFlags_WidthStretch);
+	ImGui::TableSetupColumn("p50", ImGuiTableColumnFlags_WidthFixed);
+	ImGui::TableSetupColumn("p99", ImGuiTableColumnFlags_WidthFixed);
+	ImGui::TableHeadersRow();
+
+	UINT idx = 0;
+	for (UINT i = 0, nEffect = renderer.GetEffectCount(); i < nEffect; ++i) {
+		const EffectDesc& desc = renderer.GetEffectDesc(i);
+
+		for (UINT j = 0; j < desc.passes.size(); ++j, ++idx) {
+			if (idx >= passTimes.size()) {
+				break;
+			}
+
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(desc.passes.size() == 1 ? desc.name.c_str()
+				: StrUtils::Concat(desc.name, "/", desc.passes[j].desc).c_str());
+
+			const AtomicHistogram& histogram = *passTimes[idx];
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(fmt::format("{:.3f} ms", histogram.GetPercentile(0.5f)).c_str());
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(fmt::format("{:.3f} ms", histogram.GetPercentile(0.99f)).c_str());
+		}
+	}
+
+	ImGui::EndTable();
+}
+
+void OverlayDrawer::_DrawLatency() {
+	LatencyTracer& tracer = App::Get().GetRenderer().GetLatencyTracer();
+
+	if (!tracer.IsDisplayTimeAvailable()) {
+		ImGui::PushTextWrapPos(400 * _dpiScale - ImGui::GetStyle().WindowPadding.x - ImGui::GetStyle().ScrollbarSize);
+		ImGui::TextUnformatted("Frame statistics unavailable, Total ends at Present.");
+		ImGui::PopTextWrapPos();
+	}
+
+	if (ImGui::BeginTable("latency", 4, ImGuiTableFlags_PadOuterX)) {
+		ImGui::TableSetupColumn("Stage", ImGuiTableColumnFlags_WidthStretch);
+		ImGui::TableSetupColumn("avg", ImGuiTableColumnFlags_WidthFixed);
+		ImGui::TableSetupColumn("p50", ImGuiTableColumnFlags_WidthFixed);
+		ImGui::TableSetupColumn("p99", ImGuiTableColumnFlags_WidthFixed);
+		ImGui::TableHeadersRow();
+
+		for (UINT i = 0; i < (UINT)LatencyTracer::Stage::COUNT; ++i) {
+			const LatencyTracer::Histogram& histogram = tracer.GetHistogram((LatencyTracer::Stage)i);
+
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(LatencyTracer::GetStageName((LatencyTracer::Stage)i));
+			if (histogram.count == 0) {
+				for (int j = 0; j < 3; ++j) {
+					ImGui::TableNextColumn();
+					ImGui::TextUnformatted("-");
+				}
+				continue;
+			}
+
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(fmt::format("{:.2f} ms", histogram.GetAverage()).c_str());
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(fmt::format("{:.1f} ms", histogram.GetPercentile(0.5f)).c_str());
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(fmt::format("{:.1f} ms", histogram.GetPercentile(0.99f)).c_str());
+		}
+
+		ImGui::EndTable();
+	}
+
+	static int selectedStage = (int)LatencyTracer::Stage::Total;
+	ImGui::SetNextItemWidth(120 * _dpiScale);
+	static std::array<const char*, (size_t)LatencyTracer::Stage::COUNT> stageNames = [] {
+		std::array<const char*, (size_t)LatencyTracer::Stage::COUNT> result;
+		for (size_t i = 0; i < result.size(); ++i) {
+			result[i] = LatencyTracer::GetStageName((LatencyTracer::Stage)i);
+		}
+		return result;
+	}();
+	ImGui::Combo("##stage", &selectedStage, stageNames.data(), (int)stageNames.size());
+
+	const LatencyTracer::Histogram& histogram = tracer.GetHistogram((LatencyTracer::Stage)selectedStage);
+
+	// 只绘制到最大值所在的桶
+	int bucketCount = std::clamp((int)std::ceil(histogram.max / LatencyTracer::BUCKET_WIDTH) + 1, 8, (int)LatencyTracer::BUCKET_COUNT);
+	ImGui::PlotHistogram("##histogram", [](void* data, int idx) {
+		return (float)(*(const std::array<UINT, LatencyTracer::BUCKET_COUNT>*)data)[idx];
+	}, (void*)&histogram.buckets, bucketCount, 0,
+		fmt::format("0 ~ {:.1f} ms", bucketCount * LatencyTracer::BUCKET_WIDTH).c_str(),
+		0, FLT_MAX, ImVec2(250 * _dpiScale, 60 * _dpiScale));
+
+	if (ImGui::Button("Reset")) {
+		tracer.Reset();
+	}
+	ImGui::SameLine();
+	if (ImGui::Button("Export")) {
+		static const wchar_t* EXPORT_DIR = L".\\logs";
+		if (!Utils::DirExists(EXPORT_DIR)) {
+			CreateDirectory(EXPORT_DIR, nullptr);
+		}
+
+		SYSTEMTIME st;
+		GetLocalTime(&st);
+		tracer.Export(fmt::format(L"{}\\latency_{:04}{:02}{:02}_{:02}{:02}{:02}.csv",
+			EXPORT_DIR, st.wYear, st.wMonth, st.wDay, st.wHour, st.wMinute, st.wSecond).c_str());
+	}
+}
+
+static std::string FormatBytes(UINT64 bytes) {
+	if (bytes >= 1024 * 1024) {
+		return fmt::format("{:.1f} MiB", bytes / (1024.0 * 1024.0));
+	} else {
+		return fmt::format("{:.1f} KiB", bytes / 1024.0);
+	}
+}
+
+void OverlayDrawer::_DrawVideoMemory() {
+	DXGI_QUERY_VIDEO_MEMORY_INFO info{};
+	if (App::Get().GetDeviceResources().QueryVideoMemoryInfo(info)) {
+		if (info.CurrentUsage > info.Budget) {
+			ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "Usage: %s / %s (over budget)",
+				FormatBytes(info.CurrentUsage).c_str(), FormatBytes(info.Budget).c_str());
+		} else {
+			ImGui::Text("Usage: %s / %s", FormatBytes(info.CurrentUsage).c_str(), FormatBytes(info.Budget).c_str());
+		}
+	}
+
+	if (!ImGui::BeginTable("videoMemory", 2, ImGuiTableFlags_PadOuterX)) {
+		return;
+	}
+
+	ImGui::TableSetupColumn("Effect", ImGuiTableColumnFlags_WidthStretch);
+	ImGui::TableSetupColumn("Textures", ImGuiTableColumnFlags_WidthFixed);
+	ImGui::TableHeadersRow();
+
+	Renderer& renderer = App::Get().GetRenderer();
+	UINT64 total = 0;
+	for (UINT i = 0, nEffect = renderer.GetEffectCount(); i < nEffect; ++i) {
+		const EffectDrawer& effect = renderer.GetEffectDrawer(i);
+		const UINT64 effectTotal = effect.GetTotalTextureMemory();
+		total += effectTotal;
+
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		// 展开显示每个纹理
+		const bool isOpen = ImGui::TreeNodeEx(fmt::format("{}##{}", effect.GetDesc().name, i).c_str(),
+			effect.GetTextureMemory().empty() ? ImGuiTreeNodeFlags_Leaf : 0);
+		ImGui::TableNextColumn();
+		ImGui::TextUnformatted(FormatBytes(effectTotal).c_str());
+
+		if (isOpen) {
+			for (const EffectDrawer::TextureMemory& texture : effect.GetTextureMemory()) {
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				ImGui::Indent();
+				ImGui::TextUnformatted(texture.name.c_str());
+				ImGui::Unindent();
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(FormatBytes(texture.size).c_str());
+			}
+
+			ImGui::TreePop();
+		}
+	}
+
+	ImGui::TableNextRow();
+	ImGui::TableNextColumn();
+	ImGui::TextUnformatted("Total");
+	ImGui::TableNextColumn();
+	ImGui::TextUnformatted(FormatBytes(total).c_str());
+
+	ImGui::EndTable();
+}
+
 void OverlayDrawer::_RetrieveHardwareInfo() {
 	DXGI_ADAPTER_DESC desc{};
 	HRESULT hr = App::Get().GetDeviceResources().GetGraphicsAdapter()->GetDesc(&desc);
@@ -24,10 +24,23 @@ public:
 	void SetUIVisibility(bool value);
 
 private:
+	// 是否需要重新构建覆盖层，否则重新绘制上一次的结果
+	bool _NeedsRebuild(bool isShowFPS);
+
+	void _RecordFrameTime();
+
 	void _DrawFPS();
 
 	void _DrawUI();
 
+	void _DrawFramePercentiles();
+
+	void _DrawPassPercentiles();
+
+	void _DrawLatency();
+
+	void _DrawVideoMemory();
+
 	void _RetrieveHardwareInfo();
 
 	float _dpiScale = 1.0f;
@@ -40,6 +53,13 @@ private:
 	std::deque<float> _frameTimes;
 	UINT _validFrames = 0;
 
+	// 缓存的绘制结果是否失效
+	bool _isCacheDirty = true;
+	// 输入后继续重新构建的帧数，ImGui 需要几帧才能稳定（如弹出菜单）
+	UINT _settleFrames = 0;
+	std::chrono::steady_clock::time_point _lastRebuildTime;
+	UINT _lastFPS = 0;
+
 	std::vector<UINT> _timelineColors;
 
 	struct {
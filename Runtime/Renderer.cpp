@@ -5,8 +5,12 @@
 #include "StrUtils.h"
 #include "EffectCompiler.h"
 #include "FrameSourceBase.h"
+#include "FrameRecorder.h"
 #include "DeviceResources.h"
 #include "GPUTimer.h"
+#include "LatencyTracer.h"
+#include "FrameTracer.h"
+#include "FrameStatistics.h"
 #include "EffectDrawer.h"
 #include "OverlayDrawer.h"
 #include "Logger.h"
@@ -39,8 +43,10 @@ Renderer::~Renderer() {
 
 bool Renderer::Initialize(const std::string& effectsJson) {
 	_gpuTimer.reset(new GPUTimer());
+	_latencyTracer.reset(new LatencyTracer());
+	_frameTracer.reset(new FrameTracer());
 	
-	if (!GetWindowRect(App::Get().GetHwndSrc(), &_srcWndRect)) {
+	if (!App::Get().IsHeadless() && !GetWindowRect(App::Get().GetHwndSrc(), &_srcWndRect)) {
 		Logger::Get().Win32Error("GetWindowRect 失败");
 		return false;
 	}
@@ -49,6 +55,21 @@ bool Renderer::Initialize(const std::string& effectsJson) {
 		Logger::Get().Error("_ResolveEffectsJson 失败");
 		return false;
 	}
+
+	if (!_InitFrameRecorder()) {
+		Logger::Get().Error("_InitFrameRecorder 失败");
+		return false;
+	}
+
+	if (!_InitFrameTracer()) {
+		Logger::Get().Error("_InitFrameTracer 失败");
+		return false;
+	}
+
+	// 基准测试始终统计 GPU 时间
+	if (App::Get().IsHeadless() && !_frameTracer->IsEnabled()) {
+		_StartProfiling();
+	}
 	
 	if (App::Get().GetConfig().IsShowFPS()) {
 		_overlayDrawer.reset(new OverlayDrawer());
@@ -79,7 +100,7 @@ bool Renderer::Initialize(const std::string& effectsJson) {
 
 
 void Renderer::Render() {
-	if (!_CheckSrcState()) {
+	if (!App::Get().IsHeadless() && !_CheckSrcState()) {
 		Logger::Get().Info("源窗口状态改变，退出全屏");
 		App::Get().Quit();
 		return;
@@ -90,23 +111,64 @@ void Renderer::Render() {
 	if (!_waitingForNextFrame) {
 		dr.BeginFrame();
 		_gpuTimer->OnBeginFrame();
+
+		// 第一帧没有帧时间。不计入上一帧等待新帧的时间，否则源窗口暂停更新会被统计为卡顿
+		if (_gpuTimer->GetFrameCount() > 1) {
+			App::Get().GetFrameStatistics().OnFrame(
+				std::chrono::duration<float, std::milli>(_gpuTimer->GetElapsedTime() - _idleTime).count());
+		}
+		_idleTime = {};
 	}
 
+	const UINT frameIdx = _gpuTimer->GetFrameCount();
+	INT64 traceTime = _frameTracer->Now();
+
 	// 首先处理配置改变产生的回调
 	App::Get().GetConfig().OnBeginFrame();
+	traceTime = _frameTracer->AddCPUEvent(FrameTracer::CPUPhase::Config, frameIdx, traceTime);
 
 	auto state = App::Get().GetFrameSource().Update();
-	_waitingForNextFrame = state == FrameSourceBase::UpdateState::Waiting
-		|| state == FrameSourceBase::UpdateState::Error;
-	if (_waitingForNextFrame) {
+	if (state == FrameSourceBase::UpdateState::Waiting || state == FrameSourceBase::UpdateState::Error) {
+		if (!_waitingForNextFrame) {
+			_waitingForNextFrame = true;
+			_waitStartTime = std::chrono::steady_clock::now();
+		}
 		return;
 	}
+
+	if (_waitingForNextFrame) {
+		_waitingForNextFrame = false;
+		_idleTime = std::chrono::steady_clock::now() - _waitStartTime;
+	}
+	traceTime = _frameTracer->AddCPUEvent(FrameTracer::CPUPhase::Update, frameIdx, traceTime);
+
+	if (state == FrameSourceBase::UpdateState::NewFrame) {
+		_latencyTracer->OnFrameUpdated(App::Get().GetFrameSource().GetFrameArrivalTime());
+	}
+
+	if (_frameRecorder && state == FrameSourceBase::UpdateState::NewFrame) {
+		FrameSourceBase& frameSource = App::Get().GetFrameSource();
+		ID3D11Texture2D* frame = frameSource.GetOutput();
+		if (frameSource.IsZeroCopy()) {
+			_frameRecorder->Record(frame, frameSource.GetOutputBox());
+		} else {
+			D3D11_TEXTURE2D_DESC desc;
+			frame->GetDesc(&desc);
+			_frameRecorder->Record(frame, { 0, 0, 0, desc.Width, desc.Height, 1 });
+		}
+	}
 	
-	App::Get().GetCursorManager().OnBeginFrame();
+	traceTime = _frameTracer->Now();
+	// 无窗口模式下不绘制光标
+	if (!App::Get().IsHeadless()) {
+		App::Get().GetCursorManager().OnBeginFrame();
+	}
+	traceTime = _frameTracer->AddCPUEvent(FrameTracer::CPUPhase::Cursor, frameIdx, traceTime);
 
 	if (!_UpdateDynamicConstants()) {
 		Logger::Get().Error("_UpdateDynamicConstants 失败");
 	}
+	traceTime = _frameTracer->AddCPUEvent(FrameTracer::CPUPhase::DynamicConstants, frameIdx, traceTime);
 
 	auto d3dDC = dr.GetD3DDC();
 
@@ -117,6 +179,8 @@ void Renderer::Render() {
 
 	_gpuTimer->OnBeginEffects();
 
+	_OnGPUFramesRetrieved();
+
 	UINT idx = 0;
 	if (state == FrameSourceBase::UpdateState::NoUpdate) {
 		// 此帧内容无变化
@@ -136,25 +200,52 @@ void Renderer::Render() {
 
 		if (i == _effects.size()) {
 			// 只渲染最后一个 Effect 的最后一个 pass
-			_effects.back()->Draw(idx, true);
+			_effects.back()->Draw(_gpuTimer.get(), idx, true);
 		} else {
 			for (; i < _effects.size(); ++i) {
-				_effects[i]->Draw(idx);
+				_effects[i]->Draw(_gpuTimer.get(), idx);
 			}
 		}
 	} else {
 		for (auto& effect : _effects) {
-			effect->Draw(idx);
+			effect->Draw(_gpuTimer.get(), idx);
 		}
 	}
 
 	_gpuTimer->OnEndEffects();
+	_latencyTracer->OnEffectsSubmitted();
+	traceTime = _frameTracer->AddCPUEvent(FrameTracer::CPUPhase::Draw, frameIdx, traceTime);
 
 	if (_overlayDrawer) {
 		_overlayDrawer->Draw();
+		traceTime = _frameTracer->AddCPUEvent(FrameTracer::CPUPhase::Overlay, frameIdx, traceTime);
 	}
 
 	dr.EndFrame();
+	_frameTracer->AddCPUEvent(FrameTracer::CPUPhase::Present, frameIdx, traceTime);
+	_latencyTracer->OnPresented();
+}
+
+void Renderer::FinishProfiling() {
+	App::Get().GetDeviceResources().WaitForGPU();
+	_gpuTimer->RetrievePendingFrames();
+	_OnGPUFramesRetrieved();
+}
+
+std::vector<std::string> Renderer::GetPassNames() const {
+	std::vector<std::string> passNames;
+	for (const auto& effect : _effects) {
+		const EffectDesc& desc = effect->GetDesc();
+		if (desc.passes.size() == 1) {
+			passNames.emplace_back(desc.name);
+		} else {
+			for (const EffectPassDesc& passDesc : desc.passes) {
+				passNames.emplace_back(StrUtils::Concat(desc.name, "/", passDesc.desc));
+			}
+		}
+	}
+
+	return passNames;
 }
 
 bool Renderer::IsUIVisiable() const noexcept {
@@ -165,7 +256,12 @@ void Renderer::SetUIVisibility(bool value) {
 	if (!value) {
 		if (_overlayDrawer && _overlayDrawer->IsUIVisiable()) {
 			_overlayDrawer->SetUIVisibility(false);
-			_gpuTimer->StopProfiling();
+			// 记录跟踪时始终统计 GPU 时间
+			if (!_frameTracer->IsEnabled()) {
+				_gpuTimer->StopProfiling();
+				App::Get().GetFrameStatistics().StopPasses();
+			}
+			_latencyTracer->Stop();
 		}
 		return;
 	}
@@ -181,13 +277,10 @@ void Renderer::SetUIVisibility(bool value) {
 	if (!_overlayDrawer->IsUIVisiable()) {
 		_overlayDrawer->SetUIVisibility(true);
 
-		UINT passCount = 0;
-		for (const auto& effect : _effects) {
-			passCount += (UINT)effect->GetDesc().passes.size();
+		if (!_frameTracer->IsEnabled()) {
+			_StartProfiling();
 		}
-
-		// StartProfiling 必须在 OnBeginFrame 之前调用
-		_gpuTimer->StartProfiling(std::chrono::milliseconds(500), passCount);
+		_latencyTracer->Start();
 	}
 }
 
@@ -283,7 +376,40 @@ bool Renderer::_CheckSrcState() {
 	return true;
 }
 
-bool Renderer::_ResolveEffectsJson(const std::string& effectsJson) {
+struct SeparableVariant {
+	std::string_view effect;
+	std::string_view variant;
+};
+
+// 有可分离版本的缩放效果。可分离的版本先水平再垂直缩放，结果和原效果只有舍入误差
+static constexpr SeparableVariant SEPARABLE_VARIANTS[] = {
+	{ "Lanczos", "Lanczos_Separable" },
+	{ "Bicubic", "Bicubic_Separable" }
+};
+
+// 放大倍数较小时中间纹理的读写抵消了节省的采样，因此只在两个方向都至少放大 2 倍时使用可分离的版本
+static constexpr LONG SEPARABLE_MIN_SCALE = 2;
+
+static const SeparableVariant* FindSeparableVariant(std::string_view effectName) {
+	auto it = std::find_if(std::begin(SEPARABLE_VARIANTS), std::end(SEPARABLE_VARIANTS), [&](const SeparableVariant& v) {
+		return v.effect == effectName;
+	});
+	return it == std::end(SEPARABLE_VARIANTS) ? nullptr : &*it;
+}
+
+bool Renderer::HasSeparableVariant(std::string_view effectName) {
+	return FindSeparableVariant(effectName);
+}
+
+bool Renderer::CompileEffects(
+	const std::string& effectsJson,
+	bool isOffline,
+	SIZE inputSize,
+	std::vector<EffectDesc>& effectDescs,
+	std::vector<EffectParams>& effectParams,
+	std::vector<std::vector<TextureLoader::AsyncTexture>>& sourceTextures,
+	float& compileTime
+) {
 	rapidjson::Document doc;
 	if (doc.Parse(effectsJson.c_str(), effectsJson.size()).HasParseError()) {
 		// 解析 json 失败
@@ -308,15 +434,42 @@ bool Renderer::_ResolveEffectsJson(const std::string& effectsJson) {
 
 	UINT effectCount = effectsArr.Size();
 	std::vector<const char*> effectNames(effectCount);
-	std::vector<EffectParams> effectParams(effectCount);
-	std::vector<EffectDesc> effectDescs(effectCount);
+	std::vector<UINT> effectFlags(effectCount);
+	// 是否等到输出尺寸确定后再选择编译原效果还是可分离的版本
+	std::vector<uint8_t> isDeferred(effectCount);
+	effectParams.assign(effectCount, {});
+	effectDescs.assign(effectCount, {});
+	sourceTextures.assign(effectCount, {});
 	std::atomic<bool> allSuccess = true;
 
+	// 第一个效果尝试直接读取捕获到的表面
+	const bool tryZeroCopy = !isOffline && App::Get().GetFrameSource().IsZeroCopySupported();
+	const bool selectVariants = inputSize.cx > 0 && inputSize.cy > 0;
+
+	const auto compileEffect = [&](UINT id, std::string_view effectName) {
+		bool success = true;
+		int duration = Utils::Measure([&]() {
+			success = !EffectCompiler::Compile(effectName, effectFlags[id], effectParams[id].params, effectDescs[id], &sourceTextures[id]);
+		});
+
+		if (success) {
+			Logger::Get().Info(fmt::format("编译 effects\\{}.hlsl 用时 {} 毫秒", effectName, duration / 1000.0f));
+		} else {
+			Logger::Get().Error(fmt::format("编译 effects\\{}.hlsl 失败", effectName));
+			allSuccess = false;
+		}
+	};
+
 	int duration = Utils::Measure([&]() {
 		Utils::RunParallel([&](UINT id) {
 			const auto& effectJson = effectsArr[id];
-			UINT effectFlag = (id == effectCount - 1) ? EFFECT_FLAG_LAST_EFFECT : 0;
+			// 离线处理时最后一个效果也输出到自己的纹理
+			UINT effectFlag = (!isOffline && id == effectCount - 1) ? EFFECT_FLAG_LAST_EFFECT : 0;
+			if (id == 0 && tryZeroCopy) {
+				effectFlag |= EFFECT_FLAG_INPUT_OFFSET;
+			}
 			EffectParams& params = effectParams[id];
+			bool allowSeparable = true;
 
 			if (!effectJson.IsObject()) {
 				Logger::Get().Error("解析 json 失败：根数组中存在非法成员");
@@ -367,6 +520,15 @@ bool Renderer::_ResolveEffectsJson(const std::string& effectsJson) {
 						effectFlag |= EFFECT_FLAG_FP16;
 					}
 					continue;
+				} else if (name == "separable") {
+					if (!prop.value.IsBool()) {
+						Logger::Get().Error(fmt::format("解析效果#{}（{}）失败：成员 separable 必须为 bool 类型", id, effectNames[id]));
+						allSuccess = false;
+						return;
+					}
+
+					allowSeparable = prop.value.GetBool();
+					continue;
 				} else if (name == "scale") {
 					auto scaleProp = effectJson.FindMember("scale");
 					if (scaleProp != effectJson.MemberEnd()) {
@@ -403,31 +565,139 @@ bool Renderer::_ResolveEffectsJson(const std::string& effectsJson) {
 				}
 			}
 
-			std::wstring fileName = (L"effects\\" + StrUtils::UTF8ToUTF16(effectNames[id]) + L".hlsl");
+			effectFlags[id] = effectFlag;
 
-			bool success = true;
-			int duration = Utils::Measure([&]() {
-				success = !EffectCompiler::Compile(effectNames[id], effectFlag, effectParams[id].params, effectDescs[id]);
-			});
+			if (selectVariants && allowSeparable && FindSeparableVariant(effectNames[id])) {
+				isDeferred[id] = 1;
+				return;
+			}
 
-			if (success) {
-				Logger::Get().Info(fmt::format("编译 {} 用时 {} 毫秒", StrUtils::UTF16ToUTF8(fileName), duration / 1000.0f));
+			compileEffect(id, effectNames[id]);
+		}, effectCount);
+
+		if (!allSuccess || std::find(isDeferred.begin(), isDeferred.end(), 1) == isDeferred.end()) {
+			return;
+		}
+
+		// 按顺序计算各效果的输入尺寸，据此选择原效果或可分离的版本，然后并行编译。
+		// 两者都不指定输出尺寸，因此编译前即可计算
+		std::vector<std::pair<UINT, std::string_view>> deferredEffects;
+		SIZE effectInputSize = inputSize;
+		bool isSizeKnown = true;
+		for (UINT i = 0; i < effectCount; ++i) {
+			SIZE outputSize{};
+
+			if (isDeferred[i]) {
+				isSizeKnown = isSizeKnown && EffectDrawer::CalcOutputSize({}, effectParams[i], effectInputSize, outputSize);
+
+				std::string_view effectName = effectNames[i];
+				if (isSizeKnown && outputSize.cx >= effectInputSize.cx * SEPARABLE_MIN_SCALE
+					&& outputSize.cy >= effectInputSize.cy * SEPARABLE_MIN_SCALE) {
+					effectName = FindSeparableVariant(effectName)->variant;
+					Logger::Get().Info(fmt::format("效果#{}（{}）从 {}x{} 缩放到 {}x{}，改用 {}", i, effectNames[i],
+						effectInputSize.cx, effectInputSize.cy, outputSize.cx, outputSize.cy, effectName));
+				}
+				deferredEffects.emplace_back(i, effectName);
 			} else {
-				Logger::Get().Error(StrUtils::Concat("编译 ", StrUtils::UTF16ToUTF8(fileName), " 失败"));
-				allSuccess = false;
+				isSizeKnown = isSizeKnown && EffectDrawer::CalcOutputSize(effectDescs[i], effectParams[i], effectInputSize, outputSize);
 			}
-		}, effectCount);
+
+			effectInputSize = outputSize;
+		}
+
+		Utils::RunParallel([&](UINT id) {
+			compileEffect(deferredEffects[id].first, deferredEffects[id].second);
+		}, (UINT)deferredEffects.size());
+	});
+
+	compileTime = duration / 1000.0f;
+
+	if (!allSuccess) {
+		return false;
+	}
+
+	if (effectCount > 1) {
+		Logger::Get().Info(fmt::format("编译着色器总计用时 {} 毫秒", duration / 1000.0f));
+	}
+
+	return true;
+}
+
+bool Renderer::_ResolveEffectsJson(const std::string& effectsJson) {
+	std::vector<EffectParams> effectParams;
+	std::vector<EffectDesc> effectDescs;
+	std::vector<std::vector<TextureLoader::AsyncTexture>> sourceTextures;
+
+	// 返回前必须等待所有加载完成
+	Utils::ScopeExit se([&sourceTextures]() {
+		TextureLoader::WaitAll(sourceTextures);
 	});
 
-	if (allSuccess) {
-		if (effectCount > 1) {
-			Logger::Get().Info(fmt::format("编译着色器总计用时 {} 毫秒", duration / 1000.0f));
+	// 尚未启用零拷贝，GetOutput 返回的纹理尺寸即为第一个效果的输入尺寸
+	SIZE inputSize{};
+	if (ID3D11Texture2D* frameSourceOutput = App::Get().GetFrameSource().GetOutput()) {
+		D3D11_TEXTURE2D_DESC desc;
+		frameSourceOutput->GetDesc(&desc);
+		inputSize = { (LONG)desc.Width, (LONG)desc.Height };
+	}
+
+	if (!CompileEffects(effectsJson, false, inputSize, effectDescs, effectParams, sourceTextures, _compileTime)) {
+		return false;
+	}
+
+	if (effectDescs[0].flags & EFFECT_FLAG_INPUT_OFFSET) {
+		FrameSourceBase& frameSource = App::Get().GetFrameSource();
+		if (!frameSource.EnableZeroCopy()) {
+			Logger::Get().Error("启用零拷贝失败");
+			return false;
 		}
-	} else {
+	}
+
+	if (!_InitEffectDrawers(effectDescs, effectParams, sourceTextures, false)) {
 		return false;
 	}
 
+	if (!_CheckVideoMemoryBudget()) {
+		// 将 32 位浮点的中间纹理降为 16 位后重新创建
+		const bool hasFloat32Textures = std::any_of(effectDescs.begin(), effectDescs.end(), [](const EffectDesc& desc) {
+			return std::any_of(desc.textures.begin(), desc.textures.end(), [](const EffectIntermediateTextureDesc& texDesc) {
+				return texDesc.source.empty() && (texDesc.format == EffectIntermediateTextureFormat::R32G32B32A32_FLOAT
+					|| texDesc.format == EffectIntermediateTextureFormat::R32G32_FLOAT
+					|| texDesc.format == EffectIntermediateTextureFormat::R32_FLOAT);
+			});
+		});
+
+		if (hasFloat32Textures) {
+			Logger::Get().Warn("显存超出预算，改用低精度的中间纹理");
+
+			_effects.clear();
+			// D3D11 延迟销毁对象，刷新使显存立即释放
+			App::Get().GetDeviceResources().GetD3DDC()->Flush();
+
+			if (!_InitEffectDrawers(effectDescs, effectParams, sourceTextures, true)) {
+				return false;
+			}
+
+			if (!_CheckVideoMemoryBudget()) {
+				Logger::Get().Warn("显存仍超出预算，可能因换页而卡顿");
+			}
+		} else {
+			Logger::Get().Warn("显存超出预算，可能因换页而卡顿");
+		}
+	}
+
+	return true;
+}
+
+bool Renderer::_InitEffectDrawers(
+	const std::vector<EffectDesc>& effectDescs,
+	const std::vector<EffectParams>& effectParams,
+	const std::vector<std::vector<TextureLoader::AsyncTexture>>& sourceTextures,
+	bool lowPrecisionTextures
+) {
+	// 零拷贝时为空
 	ID3D11Texture2D* effectInput = App::Get().GetFrameSource().GetOutput();
+	const UINT effectCount = (UINT)effectDescs.size();
 	_effects.resize(effectCount);
 
 	for (UINT i = 0; i < effectCount; ++i) {
@@ -435,11 +705,12 @@ bool Renderer::_ResolveEffectsJson(const std::string& effectsJson) {
 
 		_effects[i].reset(new EffectDrawer());
 		if (!_effects[i]->Initialize(
-			effectDescs[i], effectParams[i], effectInput, &effectInput,
+			effectDescs[i], effectParams[i], sourceTextures[i], effectInput, &effectInput,
 			isLastEffect ? &_outputRect : nullptr,
-			isLastEffect ? &_virtualOutputRect : nullptr
+			isLastEffect ? &_virtualOutputRect : nullptr,
+			lowPrecisionTextures
 		)) {
-			Logger::Get().Error(fmt::format("初始化效果#{} ({}) 失败", i, effectNames[i]));
+			Logger::Get().Error(fmt::format("初始化效果#{} ({}) 失败", i, effectDescs[i].name));
 			return false;
 		}
 	}
@@ -447,6 +718,99 @@ bool Renderer::_ResolveEffectsJson(const std::string& effectsJson) {
 	return true;
 }
 
+bool Renderer::_CheckVideoMemoryBudget() {
+	UINT64 effectsMemory = 0;
+	for (const auto& effect : _effects) {
+		effectsMemory += effect->GetTotalTextureMemory();
+	}
+
+	DXGI_QUERY_VIDEO_MEMORY_INFO info{};
+	if (!App::Get().GetDeviceResources().QueryVideoMemoryInfo(info)) {
+		// 无法检查时视为未超出
+		return true;
+	}
+
+	static constexpr double MIB = 1024.0 * 1024.0;
+	Logger::Get().Info(fmt::format("效果的纹理占用 {:.1f} MiB，显存用量 {:.1f} MiB，预算 {:.1f} MiB",
+		effectsMemory / MIB, info.CurrentUsage / MIB, info.Budget / MIB));
+
+	return info.CurrentUsage <= info.Budget;
+}
+
+void Renderer::_StartProfiling() {
+	UINT passCount = 0;
+	for (const auto& effect : _effects) {
+		passCount += (UINT)effect->GetDesc().passes.size();
+	}
+
+	// StartProfiling 必须在 OnBeginFrame 之前调用
+	_gpuTimer->StartProfiling(std::chrono::milliseconds(500), passCount);
+	App::Get().GetFrameStatistics().StartPasses(passCount);
+}
+
+void Renderer::_OnGPUFramesRetrieved() {
+	for (const GPUTimer::FrameGPUTimings& frame : _gpuTimer->GetRetrievedFrames()) {
+		_latencyTracer->OnGPUTime(frame.total);
+		_frameTracer->AddGPUFrame(frame);
+		App::Get().GetFrameStatistics().OnPassTimings(frame.passes);
+	}
+}
+
+bool Renderer::_InitFrameTracer() {
+	const std::wstring& traceFile = App::Get().GetTraceFile();
+	if (traceFile.empty()) {
+		return true;
+	}
+
+	if (!_frameTracer->Initialize(traceFile.c_str(), GetPassNames())) {
+		// 跟踪失败不影响缩放
+		Logger::Get().Error("初始化 FrameTracer 失败");
+		_frameTracer.reset(new FrameTracer());
+		return true;
+	}
+
+	_StartProfiling();
+	return true;
+}
+
+bool Renderer::_InitFrameRecorder() {
+	const std::wstring& recordPath = App::Get().GetReplayOptions().recordPath;
+	if (recordPath.empty()) {
+		return true;
+	}
+
+	FrameSourceBase& frameSource = App::Get().GetFrameSource();
+	if (std::string_view(frameSource.GetName()) == "Replay") {
+		Logger::Get().Info("回放时不录制");
+		return true;
+	}
+
+	UINT width, height;
+	DXGI_FORMAT format;
+	if (frameSource.IsZeroCopy()) {
+		const D3D11_BOX& box = frameSource.GetOutputBox();
+		width = box.right - box.left;
+		height = box.bottom - box.top;
+		// 零拷贝只用于 Graphics Capture，帧的格式固定
+		format = DXGI_FORMAT_B8G8R8A8_UNORM;
+	} else {
+		D3D11_TEXTURE2D_DESC desc;
+		frameSource.GetOutput()->GetDesc(&desc);
+		width = desc.Width;
+		height = desc.Height;
+		format = desc.Format;
+	}
+
+	_frameRecorder.reset(new FrameRecorder());
+	if (!_frameRecorder->Initialize(recordPath.c_str(), width, height, format)) {
+		// 录制失败不影响缩放
+		Logger::Get().Error("初始化 FrameRecorder 失败");
+		_frameRecorder.reset();
+	}
+
+	return true;
+}
+
 bool Renderer::_UpdateDynamicConstants() {
 	// cbuffer __CB1 : register(b0) {
 	//     int4 __cursorRect;
@@ -454,6 +818,8 @@ bool Renderer::_UpdateDynamicConstants() {
 	//     uint2 __cursorPos;
 	//     uint __cursorType;
 	//     uint __frameCount;
+	//     float2 __cursorAtlasOffset;
+	//     float4 __cursorAtlasClamp;
 	// };
 
 	CursorManager& cursorManager = App::Get().GetCursorManager();
@@ -461,9 +827,10 @@ bool Renderer::_UpdateDynamicConstants() {
 		const POINT* pos = cursorManager.GetCursorPos();
 		const CursorManager::CursorInfo* ci = cursorManager.GetCursorInfo();
 
-		ID3D11Texture2D* cursorTex;
+		ID3D11Texture2D* cursorTex = nullptr;
 		CursorManager::CursorType cursorType = CursorManager::CursorType::Color;
-		if (!cursorManager.GetCursorTexture(&cursorTex, cursorType)) {
+		RECT atlasRect{};
+		if (!cursorManager.GetCursorTexture(&cursorTex, cursorType, atlasRect)) {
 			Logger::Get().Error("GetCursorTexture 失败");
 		}
 		assert(pos && ci);
@@ -486,13 +853,32 @@ bool Renderer::_UpdateDynamicConstants() {
 		_dynamicConstants[2].intVal = _dynamicConstants[0].intVal + cursorSize.cx;
 		_dynamicConstants[3].intVal = _dynamicConstants[1].intVal + cursorSize.cy;
 
-		_dynamicConstants[4].floatVal = 1.0f / cursorSize.cx;
-		_dynamicConstants[5].floatVal = 1.0f / cursorSize.cy;
+		// 光标纹理位于图集中，将光标内的位置映射到图集的坐标
+		SIZE atlasSize{ 1, 1 };
+		if (cursorTex) {
+			D3D11_TEXTURE2D_DESC desc;
+			cursorTex->GetDesc(&desc);
+			atlasSize = { (LONG)desc.Width, (LONG)desc.Height };
+		}
+		const float atlasPtX = 1.0f / atlasSize.cx;
+		const float atlasPtY = 1.0f / atlasSize.cy;
+
+		_dynamicConstants[4].floatVal = (float)ci->size.cx / cursorSize.cx * atlasPtX;
+		_dynamicConstants[5].floatVal = (float)ci->size.cy / cursorSize.cy * atlasPtY;
 
 		_dynamicConstants[6].uintVal = pos->x;
 		_dynamicConstants[7].uintVal = pos->y;
 
 		_dynamicConstants[8].uintVal = (UINT)cursorType;
+
+		_dynamicConstants[10].floatVal = atlasRect.left * atlasPtX;
+		_dynamicConstants[11].floatVal = atlasRect.top * atlasPtY;
+
+		// 采样范围限制在光标之内，双线性插值时不会混入图集中相邻的光标
+		_dynamicConstants[12].floatVal = (atlasRect.left + 0.5f) * atlasPtX;
+		_dynamicConstants[13].floatVal = (atlasRect.top + 0.5f) * atlasPtY;
+		_dynamicConstants[14].floatVal = (atlasRect.right - 0.5f) * atlasPtX;
+		_dynamicConstants[15].floatVal = (atlasRect.bottom - 0.5f) * atlasPtY;
 	} else {
 		_dynamicConstants[0].intVal = INT_MAX;
 		_dynamicConstants[1].intVal = INT_MAX;
@@ -1,11 +1,15 @@
 #pragma once
 #include "pch.h"
 #include "EffectDesc.h"
+#include "TextureLoader.h"
 
 class EffectDrawer;
 class GPUTimer;
+class LatencyTracer;
+class FrameTracer;
 class OverlayDrawer;
 class CursorManager;
+class FrameRecorder;
 
 
 class Renderer {
@@ -24,6 +28,10 @@ public:
 		return *_gpuTimer;
 	}
 
+	LatencyTracer& GetLatencyTracer() {
+		return *_latencyTracer;
+	}
+
 	// 可能为空
 	OverlayDrawer* GetOverlayDrawer() {
 		return _overlayDrawer.get();
@@ -47,11 +55,67 @@ public:
 
 	const EffectDesc& GetEffectDesc(UINT idx) const noexcept;
 
+	const EffectDrawer& GetEffectDrawer(UINT idx) const noexcept {
+		return *_effects[idx];
+	}
+
+	// 所有通道的名字，按执行顺序排列
+	std::vector<std::string> GetPassNames() const;
+
+	// 编译所有效果的用时，单位为 ms
+	float GetCompileTime() const noexcept {
+		return _compileTime;
+	}
+
+	// 等待 GPU 完成所有已提交的帧并统计它们的 GPU 时间，用于基准测试
+	void FinishProfiling();
+
+	// 解析 effectsJson 并并行编译所有效果
+	// isOffline 为真时用于离线处理：不尝试零拷贝，最后一个效果也输出到自己的纹理而不是后缓冲区
+	// inputSize 为第一个效果的输入尺寸，用于选择是否使用缩放效果的可分离版本，为 0 时不使用
+	// sourceTextures 可能仍在加载，调用者销毁它们前必须等待加载完成
+	static bool CompileEffects(
+		const std::string& effectsJson,
+		bool isOffline,
+		SIZE inputSize,
+		std::vector<EffectDesc>& effectDescs,
+		std::vector<EffectParams>& effectParams,
+		std::vector<std::vector<TextureLoader::AsyncTexture>>& sourceTextures,
+		float& compileTime
+	);
+
+	// 某些缩放效果有可分离的版本，先水平再垂直缩放，放大倍数较大时开销更小。
+	// CompileEffects 根据输入尺寸自动选择，效果的 separable 成员为 false 时不使用
+	static bool HasSeparableVariant(std::string_view effectName);
+
+	// 上一次 Render 是否因为没有新帧而提前返回
+	bool IsWaitingForNextFrame() const noexcept {
+		return _waitingForNextFrame;
+	}
+
 private:
 	bool _CheckSrcState();
 
 	bool _ResolveEffectsJson(const std::string& effectsJson);
 
+	bool _InitEffectDrawers(
+		const std::vector<EffectDesc>& effectDescs,
+		const std::vector<EffectParams>& effectParams,
+		const std::vector<std::vector<TextureLoader::AsyncTexture>>& sourceTextures,
+		bool lowPrecisionTextures
+	);
+
+	// 超出本地显存预算时返回 false
+	bool _CheckVideoMemoryBudget();
+
+	bool _InitFrameRecorder();
+
+	bool _InitFrameTracer();
+
+	void _StartProfiling();
+
+	void _OnGPUFramesRetrieved();
+
 	bool _UpdateDynamicConstants();
 
 	RECT _srcWndRect{};
@@ -60,13 +124,23 @@ private:
 	RECT _virtualOutputRect{};
 
 	bool _waitingForNextFrame = false;
+	// 本帧等待新帧的时间，不计入帧时间
+	std::chrono::steady_clock::time_point _waitStartTime;
+	std::chrono::nanoseconds _idleTime{};
+	float _compileTime = 0;
 
 	std::vector<std::unique_ptr<EffectDrawer>> _effects;
-	std::array<EffectConstant32, 12> _dynamicConstants;
+	std::array<EffectConstant32, 16> _dynamicConstants;
 	winrt::com_ptr<ID3D11Buffer> _dynamicCB;
 
 	std::unique_ptr<OverlayDrawer> _overlayDrawer;
 	UINT _handlerID = 0;
 
 	std::unique_ptr<GPUTimer> _gpuTimer;
+	std::unique_ptr<LatencyTracer> _latencyTracer;
+	// 始终存在，未启用时不记录
+	std::unique_ptr<FrameTracer> _frameTracer;
+
+	// 未启用录制时为空
+	std::unique_ptr<FrameRecorder> _frameRecorder;
 };
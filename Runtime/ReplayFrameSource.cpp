@@ -0,0 +1,333 @@
+#include "pch.h"
+#include "ReplayFrameSource.h"
+#include "App.h"
+#include "DeviceResources.h"
+#include "TextureLoader.h"
+#include "FrameRecorder.h"
+#include "Logger.h"
+#include "StrUtils.h"
+
+
+ReplayFrameSource::~ReplayFrameSource() {
+	if (_dumpData) {
+		UnmapViewOfFile(_dumpData);
+	}
+}
+
+bool ReplayFrameSource::Initialize() {
+	if (!FrameSourceBase::Initialize()) {
+		Logger::Get().Error("初始化 FrameSourceBase 失败");
+		return false;
+	}
+
+	const App::ReplayOptions& options = App::Get().GetReplayOptions();
+	if (options.replayPath.empty()) {
+		if (options.syntheticFrameSize.cx <= 0 || options.syntheticFrameSize.cy <= 0) {
+			Logger::Get().Error("未指定回放路径");
+			return false;
+		}
+
+		if (!_CreateSyntheticFrame(options.syntheticFrameSize)) {
+			Logger::Get().Error("生成合成帧失败");
+			return false;
+		}
+	} else if (Utils::DirExists(options.replayPath.c_str())) {
+		if (!_LoadImageSequence(options.replayPath)) {
+			Logger::Get().Error("载入图像序列失败");
+			return false;
+		}
+	} else {
+		if (!_MapFrameDump(options.replayPath)) {
+			Logger::Get().Error("映射原始帧文件失败");
+			return false;
+		}
+	}
+
+	if (App::Get().GetHwndSrc()) {
+		// 源窗口仍用于确定光标的映射
+		if (!_UpdateSrcFrameRect()) {
+			Logger::Get().Error("_UpdateSrcFrameRect 失败");
+			return false;
+		}
+	} else {
+		// 无窗口模式
+		D3D11_TEXTURE2D_DESC desc;
+		_output->GetDesc(&desc);
+		_srcFrameRect = { 0, 0, (LONG)desc.Width, (LONG)desc.Height };
+	}
+
+	_frameRate = options.frameRate;
+	if (_frameRate > 0) {
+		// 周期性触发的计时器作为新帧事件
+		_newFrameEvent.reset(CreateWaitableTimerEx(nullptr, nullptr,
+			CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS));
+		if (!_newFrameEvent) {
+			// 旧版本系统不支持高精度计时器
+			_newFrameEvent.reset(CreateWaitableTimer(nullptr, FALSE, nullptr));
+			if (!_newFrameEvent) {
+				Logger::Get().Win32Error("创建计时器失败");
+				return false;
+			}
+		}
+
+		LONG period = std::max(1L, std::lroundf(1000 / _frameRate));
+		LARGE_INTEGER dueTime{};
+		dueTime.QuadPart = -10000LL * period;
+		if (!SetWaitableTimer(_newFrameEvent.get(), &dueTime, period, nullptr, nullptr, FALSE)) {
+			Logger::Get().Win32Error("SetWaitableTimer 失败");
+			return false;
+		}
+	}
+
+	Logger::Get().Info(fmt::format("ReplayFrameSource 初始化完成，共 {} 帧，帧率：{}",
+		_frameCount, _frameRate > 0 ? std::to_string(_frameRate) : "不限制"));
+	return true;
+}
+
+FrameSourceBase::UpdateState ReplayFrameSource::Update() {
+	auto now = std::chrono::steady_clock::now();
+
+	if (_frameRate > 0) {
+		if (_replayedFrames == 0) {
+			_startTime = now;
+		} else {
+			// 按固定帧率回放，落后时也不跳帧，保证每次回放的内容相同
+			auto due = _startTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+				std::chrono::duration<double>(_replayedFrames / _frameRate));
+			if (now < due) {
+				return UpdateState::Waiting;
+			}
+		}
+	}
+
+	if (!_frames.empty()) {
+		if (_isZeroCopy) {
+			_output = _frames[_curFrame];
+		} else {
+			App::Get().GetDeviceResources().GetD3DDC()->CopyResource(_output.get(), _frames[_curFrame].get());
+		}
+	} else {
+		App::Get().GetDeviceResources().GetD3DDC()->UpdateSubresource(_output.get(), 0, nullptr,
+			_dumpData + sizeof(FrameDumpHeader) + _frameBytes * _curFrame, _framePitch, 0);
+	}
+
+	_curFrame = (_curFrame + 1) % _frameCount;
+	++_replayedFrames;
+
+	return UpdateState::NewFrame;
+}
+
+bool ReplayFrameSource::EnableZeroCopy() {
+	if (_frames.empty()) {
+		return false;
+	}
+
+	D3D11_TEXTURE2D_DESC desc;
+	_frames[0]->GetDesc(&desc);
+
+	_output = nullptr;
+	_outputBox = { 0, 0, 0, desc.Width, desc.Height, 1 };
+	_outputTextureSize = { (LONG)desc.Width, (LONG)desc.Height };
+	_isZeroCopy = true;
+
+	Logger::Get().Info("已启用零拷贝");
+	return true;
+}
+
+bool ReplayFrameSource::_LoadImageSequence(const std::wstring& dir) {
+	static const std::wstring_view IMAGE_EXTS[] = { L"bmp", L"jpg", L"jpeg", L"png", L"tif", L"tiff", L"dds" };
+
+	std::vector<std::wstring> fileNames;
+
+	WIN32_FIND_DATA findData{};
+	HANDLE hFind = FindFirstFileEx(StrUtils::ConcatW(dir, L"\\*").c_str(),
+		FindExInfoBasic, &findData, FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+	if (hFind == INVALID_HANDLE_VALUE) {
+		Logger::Get().Win32Error("FindFirstFileEx 失败");
+		return false;
+	}
+
+	do {
+		if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+			continue;
+		}
+
+		std::wstring_view fileName(findData.cFileName);
+		size_t dotPos = fileName.find_last_of(L'.');
+		if (dotPos == std::wstring_view::npos) {
+			continue;
+		}
+
+		std::wstring ext(fileName.substr(dotPos + 1));
+		std::transform(ext.begin(), ext.end(), ext.begin(), [](wchar_t c) { return (wchar_t)std::towlower(c); });
+		if (std::find(std::begin(IMAGE_EXTS), std::end(IMAGE_EXTS), ext) != std::end(IMAGE_EXTS)) {
+			fileNames.emplace_back(fileName);
+		}
+	} while (FindNextFile(hFind, &findData));
+	FindClose(hFind);
+
+	if (fileNames.empty()) {
+		Logger::Get().Error("文件夹中没有图像");
+		return false;
+	}
+
+	std::sort(fileNames.begin(), fileNames.end());
+
+	D3D11_TEXTURE2D_DESC firstDesc{};
+	_frames.reserve(fileNames.size());
+	for (const std::wstring& fileName : fileNames) {
+		winrt::com_ptr<ID3D11Texture2D> frame = TextureLoader::Load(StrUtils::ConcatW(dir, L"\\", fileName).c_str());
+		if (!frame) {
+			Logger::Get().Error(StrUtils::Concat("加载 ", StrUtils::UTF16ToUTF8(fileName), " 失败"));
+			return false;
+		}
+
+		D3D11_TEXTURE2D_DESC desc;
+		frame->GetDesc(&desc);
+		if (_frames.empty()) {
+			firstDesc = desc;
+		} else if (desc.Width != firstDesc.Width || desc.Height != firstDesc.Height || desc.Format != firstDesc.Format) {
+			Logger::Get().Error(StrUtils::Concat(StrUtils::UTF16ToUTF8(fileName), " 的尺寸或格式和第一帧不同"));
+			return false;
+		}
+
+		_frames.emplace_back(std::move(frame));
+	}
+
+	_frameCount = (UINT)_frames.size();
+
+	_output = App::Get().GetDeviceResources().CreateTexture2D(
+		firstDesc.Format,
+		firstDesc.Width,
+		firstDesc.Height,
+		D3D11_BIND_SHADER_RESOURCE
+	);
+	if (!_output) {
+		Logger::Get().Error("创建纹理失败");
+		return false;
+	}
+
+	return true;
+}
+
+bool ReplayFrameSource::_MapFrameDump(const std::wstring& fileName) {
+	_hDumpFile.reset(Utils::SafeHandle(CreateFile2(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, nullptr)));
+	if (!_hDumpFile) {
+		Logger::Get().Win32Error(StrUtils::Concat("打开 ", StrUtils::UTF16ToUTF8(fileName), " 失败"));
+		return false;
+	}
+
+	LARGE_INTEGER fileSize{};
+	if (!GetFileSizeEx(_hDumpFile.get(), &fileSize)) {
+		Logger::Get().Win32Error("GetFileSizeEx 失败");
+		return false;
+	}
+
+	if ((UINT64)fileSize.QuadPart < sizeof(FrameDumpHeader)) {
+		Logger::Get().Error("原始帧文件过小");
+		return false;
+	}
+
+	_hDumpMapping.reset(CreateFileMapping(_hDumpFile.get(), nullptr, PAGE_READONLY, 0, 0, nullptr));
+	if (!_hDumpMapping) {
+		Logger::Get().Win32Error("CreateFileMapping 失败");
+		return false;
+	}
+
+	_dumpData = (const BYTE*)MapViewOfFile(_hDumpMapping.get(), FILE_MAP_READ, 0, 0, 0);
+	if (!_dumpData) {
+		Logger::Get().Win32Error("MapViewOfFile 失败");
+		return false;
+	}
+
+	const FrameDumpHeader& header = *(const FrameDumpHeader*)_dumpData;
+	if (header.magic != FrameDumpHeader::MAGIC || header.version != FrameDumpHeader::VERSION) {
+		Logger::Get().Error("原始帧文件的格式不正确");
+		return false;
+	}
+
+	// 文件头不可信，格式和尺寸都要检查
+	if (!FrameDumpHeader::IsFormatSupported(header.format)) {
+		Logger::Get().Error(fmt::format("不支持原始帧文件的格式 {}", (int)header.format));
+		return false;
+	}
+
+	if (header.width == 0 || header.height == 0
+		|| header.width > D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION
+		|| header.height > D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION) {
+		Logger::Get().Error("原始帧文件的尺寸非法");
+		return false;
+	}
+
+	// 尺寸已限制在 16384 以内，不会溢出
+	const size_t pitch = (size_t)header.width * 4;
+	_framePitch = (UINT)pitch;
+	_frameBytes = pitch * header.height;
+
+	const UINT64 dataBytes = (UINT64)fileSize.QuadPart - sizeof(FrameDumpHeader);
+	_frameCount = dataBytes < _frameBytes ? 0 : (UINT)std::min<UINT64>(dataBytes / _frameBytes, UINT_MAX);
+	if (_frameCount == 0) {
+		Logger::Get().Error("原始帧文件中没有帧");
+		return false;
+	}
+
+	_output = App::Get().GetDeviceResources().CreateTexture2D(
+		header.format,
+		header.width,
+		header.height,
+		D3D11_BIND_SHADER_RESOURCE
+	);
+	if (!_output) {
+		Logger::Get().Error("创建纹理失败");
+		return false;
+	}
+
+	return true;
+}
+
+bool ReplayFrameSource::_CreateSyntheticFrame(SIZE size) {
+	// 渐变叠加棋盘格，既有平滑区域也有锐利的边缘
+	std::vector<UINT> pixels((size_t)size.cx * size.cy);
+	for (LONG y = 0; y < size.cy; ++y) {
+		for (LONG x = 0; x < size.cx; ++x) {
+			UINT r = x * 255 / size.cx;
+			UINT g = y * 255 / size.cy;
+			UINT b = ((x / 16) + (y / 16)) % 2 ? 255 : 0;
+			pixels[(size_t)y * size.cx + x] = r | (g << 8) | (b << 16) | 0xFF000000;
+		}
+	}
+
+	D3D11_SUBRESOURCE_DATA initData{};
+	initData.pSysMem = pixels.data();
+	initData.SysMemPitch = size.cx * 4;
+
+	winrt::com_ptr<ID3D11Texture2D> frame = App::Get().GetDeviceResources().CreateTexture2D(
+		DXGI_FORMAT_R8G8B8A8_UNORM,
+		size.cx,
+		size.cy,
+		D3D11_BIND_SHADER_RESOURCE,
+		D3D11_USAGE_IMMUTABLE,
+		0,
+		&initData
+	);
+	if (!frame) {
+		Logger::Get().Error("创建纹理失败");
+		return false;
+	}
+
+	_frames.emplace_back(std::move(frame));
+	_frameCount = 1;
+
+	_output = App::Get().GetDeviceResources().CreateTexture2D(
+		DXGI_FORMAT_R8G8B8A8_UNORM,
+		size.cx,
+		size.cy,
+		D3D11_BIND_SHADER_RESOURCE
+	);
+	if (!_output) {
+		Logger::Get().Error("创建纹理失败");
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include "pch.h"
+#include "FrameSourceBase.h"
+#include "Utils.h"
+
+
+// 从磁盘回放帧，用于在没有实时画面的情况下得到可重复的性能数据
+// 支持两种来源：
+// 1. 文件夹，其中的图像（TextureLoader 支持的格式）按文件名排序后作为帧序列，启动时全部载入显存
+// 2. 由 FrameRecorder 录制的原始帧文件，使用内存映射按需读取
+// 没有回放路径时可以生成合成帧，用于基准测试
+class ReplayFrameSource : public FrameSourceBase {
+public:
+	ReplayFrameSource() {}
+	virtual ~ReplayFrameSource();
+
+	bool Initialize() override;
+
+	UpdateState Update() override;
+
+	bool IsScreenCapture() override {
+		return false;
+	}
+
+	const char* GetName() const noexcept override {
+		return "Replay";
+	}
+
+	// 图像序列可以直接作为效果的输入
+	bool IsZeroCopySupported() const noexcept override {
+		return !_frames.empty();
+	}
+
+	bool EnableZeroCopy() override;
+
+	UINT GetFrameCount() const noexcept {
+		return _frameCount;
+	}
+
+protected:
+	bool _HasRoundCornerInWin11() override {
+		return false;
+	}
+
+private:
+	bool _LoadImageSequence(const std::wstring& dir);
+
+	bool _MapFrameDump(const std::wstring& fileName);
+
+	bool _CreateSyntheticFrame(SIZE size);
+
+	// 0 表示不限制帧率
+	float _frameRate = 0;
+	std::chrono::steady_clock::time_point _startTime;
+
+	UINT _frameCount = 0;
+	UINT _curFrame = 0;
+	// 已回放的帧数，用于控制帧率
+	UINT64 _replayedFrames = 0;
+
+	// 图像序列
+	std::vector<winrt::com_ptr<ID3D11Texture2D>> _frames;
+
+	// 原始帧文件
+	Utils::ScopedHandle _hDumpFile;
+	Utils::ScopedHandle _hDumpMapping;
+	const BYTE* _dumpData = nullptr;
+	UINT _framePitch = 0;
+	size_t _frameBytes = 0;
+};
@@ -6,6 +6,7 @@
 #include "DDS.h"
 #include "DDSLoderHelpers.h"
 #include "Utils.h"
+#include "StrUtils.h"
 
 
 ///////////////////////////////////////////////////////////////////
@@ -243,9 +244,8 @@ HRESULT FillInitData(
         size_t h = height;
         size_t d = depth;
         for (size_t i = 0; i < mipCount; i++) {
-            HRESULT hr = GetSurfaceInfo(w, h, format, &NumBytes, &RowBytes, nullptr);
-            if (FAILED(hr))
-                return hr;
+            if (!GetSurfaceInfo(w, h, format, &NumBytes, &RowBytes, nullptr))
+                return E_INVALIDARG;
 
             if (NumBytes > UINT32_MAX || RowBytes > UINT32_MAX)
                 return HRESULT_FROM_WIN32(ERROR_ARITHMETIC_OVERFLOW);
@@ -508,9 +508,8 @@ HRESULT CreateTextureFromDDS(
         if (SUCCEEDED(hr)) {
             size_t numBytes = 0;
             size_t rowBytes = 0;
-            hr = GetSurfaceInfo(width, height, format, &numBytes, &rowBytes, nullptr);
-            if (FAILED(hr))
-                return hr;
+            if (!GetSurfaceInfo(width, height, format, &numBytes, &rowBytes, nullptr))
+                return E_INVALIDARG;
 
             if (numBytes > bitSize) {
                 (*textureView)->Release();
@@ -641,67 +640,28 @@ HRESULT CreateTextureFromDDS(
     return hr;
 }
 
-HRESULT CreateDDSTextureFromFileEx(
-	ID3D11Device* d3dDevice,
-	const wchar_t* fileName,
-	size_t maxsize,
-	D3D11_USAGE usage,
-	unsigned int bindFlags,
-	unsigned int cpuAccessFlags,
-	unsigned int miscFlags,
-	bool forceSRGB,
-	ID3D11Resource** texture,
-	ID3D11ShaderResourceView** textureView,
-	DDS_ALPHA_MODE* alphaMode) noexcept {
-	if (texture) {
-		*texture = nullptr;
-	}
-	if (textureView) {
-		*textureView = nullptr;
-	}
-	if (alphaMode) {
-		*alphaMode = DDS_ALPHA_MODE_UNKNOWN;
-	}
-
-	if (!d3dDevice || !fileName || (!texture && !textureView)) {
-		return E_INVALIDARG;
-	}
-
-	if (textureView && !(bindFlags & D3D11_BIND_SHADER_RESOURCE)) {
-		return E_INVALIDARG;
-	}
-
-	const DDS_HEADER* header = nullptr;
-	const uint8_t* bitData = nullptr;
-	size_t bitSize = 0;
-
-	std::unique_ptr<uint8_t[]> ddsData;
-	HRESULT hr = LoadTextureDataFromFile(fileName,
-		ddsData,
-		&header,
-		&bitData,
-		&bitSize
-	);
-	if (FAILED(hr)) {
-		return hr;
-	}
-
-	hr = CreateTextureFromDDS(d3dDevice, nullptr,
-		header, bitData, bitSize,
-		maxsize,
-		usage, bindFlags, cpuAccessFlags, miscFlags,
-		forceSRGB,
-		texture, textureView);
-
-	if (SUCCEEDED(hr)) {
-		if (alphaMode)
-			*alphaMode = GetAlphaMode(header);
-	}
-
-	return hr;
-}
-
-winrt::com_ptr<ID3D11Texture2D> LoadImg(const wchar_t* fileName) {
+// 解码后的纹理数据，不依赖 D3D 设备
+struct DecodedTexture {
+	// WIC 解码的像素
+	std::unique_ptr<uint8_t[]> data;
+	// 内存映射的 DDS 文件
+	MappedView ddsView;
+	// data 或 ddsView 的大小
+	size_t dataSize = 0;
+
+	// DDS 文件的头和像素数据，指向 ddsView 内部，直接用作子资源的初始数据。为空表示 WIC 解码的图像
+	const DDS_HEADER* ddsHeader = nullptr;
+	const uint8_t* ddsBits = nullptr;
+	size_t ddsBitsSize = 0;
+
+	// 以下只用于 WIC 解码的图像
+	DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+	UINT width = 0;
+	UINT height = 0;
+	UINT pitch = 0;
+};
+
+static std::shared_ptr<DecodedTexture> DecodeImg(const wchar_t* fileName) {
 	winrt::com_ptr<IWICImagingFactory2> factory = App::Get().GetWICImageFactory();
 	if (!factory) {
 		Logger::Get().Error("GetWICImageFactory 失败");
@@ -788,58 +748,113 @@ winrt::com_ptr<ID3D11Texture2D> LoadImg(const wchar_t* fileName) {
 		return nullptr;
 	}
 
-	UINT stride = width * (useFloatFormat ? 8 : 4);
-	UINT size = stride * height;
-	std::unique_ptr<BYTE[]> buf(new BYTE[size]);
+	std::shared_ptr<DecodedTexture> result = std::make_shared<DecodedTexture>();
+	result->format = useFloatFormat ? DXGI_FORMAT_R16G16B16A16_FLOAT : DXGI_FORMAT_R8G8B8A8_UNORM;
+	result->width = width;
+	result->height = height;
+	result->pitch = width * (useFloatFormat ? 8 : 4);
+	result->dataSize = (size_t)result->pitch * height;
+	result->data.reset(new uint8_t[result->dataSize]);
 
-	hr = formatConverter->CopyPixels(nullptr, stride, size, buf.get());
+	hr = formatConverter->CopyPixels(nullptr, result->pitch, (UINT)result->dataSize, result->data.get());
 	if (FAILED(hr)) {
 		Logger::Get().ComError("CopyPixels 失败", hr);
 		return nullptr;
 	}
 
-	D3D11_SUBRESOURCE_DATA initData{};
-	initData.pSysMem = buf.get();
-	initData.SysMemPitch = stride;
-
-	winrt::com_ptr<ID3D11Texture2D> result = App::Get().GetDeviceResources().CreateTexture2D(
-        useFloatFormat ? DXGI_FORMAT_R16G16B16A16_FLOAT : DXGI_FORMAT_R8G8B8A8_UNORM,
-        width,
-        height,
-        D3D11_BIND_SHADER_RESOURCE,
-        D3D11_USAGE_IMMUTABLE,
-        0,
-        &initData
-    );
-	if (!result) {
-		Logger::Get().Error("创建纹理失败");
+	return result;
+}
+
+static std::shared_ptr<DecodedTexture> DecodeDDS(const wchar_t* fileName) {
+	std::shared_ptr<DecodedTexture> result = std::make_shared<DecodedTexture>();
+
+	HRESULT hr = MapTextureDataFromFile(fileName,
+		result->ddsView,
+		&result->dataSize,
+		&result->ddsHeader,
+		&result->ddsBits,
+		&result->ddsBitsSize
+	);
+	if (FAILED(hr)) {
+		Logger::Get().ComError("读取 DDS 文件失败", hr);
 		return nullptr;
 	}
 
 	return result;
 }
 
-winrt::com_ptr<ID3D11Texture2D> LoadDDS(const wchar_t* fileName) {
-	winrt::com_ptr<ID3D11Resource> result;
+static std::shared_ptr<DecodedTexture> Decode(const wchar_t* fileName) {
+	std::wstring_view sv(fileName);
+	size_t npos = sv.find_last_of(L'.');
+	if (npos == std::wstring_view::npos) {
+		Logger::Get().Error("文件名无后缀名");
+		return nullptr;
+	}
+
+	std::wstring_view suffix = sv.substr(npos + 1);
+
+	static std::unordered_map<std::wstring_view, std::shared_ptr<DecodedTexture>(*)(const wchar_t*)> funcs = {
+		{L"bmp", DecodeImg},
+		{L"jpg", DecodeImg},
+		{L"jpeg", DecodeImg},
+		{L"png", DecodeImg},
+		{L"tif", DecodeImg},
+		{L"tiff", DecodeImg},
+		{L"dds", DecodeDDS}
+	};
+
+	auto it = funcs.find(suffix);
+	if (it == funcs.end()) {
+		Logger::Get().Error("不支持读取该格式");
+		return nullptr;
+	}
+
+	return it->second(fileName);
+}
+
+static winrt::com_ptr<ID3D11Texture2D> CreateTexture(const DecodedTexture& decoded) {
+	if (!decoded.ddsHeader) {
+		D3D11_SUBRESOURCE_DATA initData{};
+		initData.pSysMem = decoded.data.get();
+		initData.SysMemPitch = decoded.pitch;
+
+		winrt::com_ptr<ID3D11Texture2D> result = App::Get().GetDeviceResources().CreateTexture2D(
+			decoded.format,
+			decoded.width,
+			decoded.height,
+			D3D11_BIND_SHADER_RESOURCE,
+			D3D11_USAGE_IMMUTABLE,
+			0,
+			&initData
+		);
+		if (!result) {
+			Logger::Get().Error("创建纹理失败");
+			return nullptr;
+		}
+
+		return result;
+	}
 
-	DDS_ALPHA_MODE alphaMode = DDS_ALPHA_MODE_STRAIGHT;
-	HRESULT hr = CreateDDSTextureFromFileEx(
+	winrt::com_ptr<ID3D11Resource> result;
+	HRESULT hr = CreateTextureFromDDS(
 		App::Get().GetDeviceResources().GetD3DDevice(),
-		fileName,
+		nullptr,
+		decoded.ddsHeader,
+		decoded.ddsBits,
+		decoded.ddsBitsSize,
 		0,
-        D3D11_USAGE_IMMUTABLE,
+		D3D11_USAGE_IMMUTABLE,
 		D3D11_BIND_SHADER_RESOURCE,
 		0,
 		0,
 		false,
 		result.put(),
-		nullptr,
-		&alphaMode
+		nullptr
 	);
-    if (FAILED(hr)) {
-        Logger::Get().ComError("CreateDDSTextureFromFile 失败", hr);
-        return nullptr;
-    }
+	if (FAILED(hr)) {
+		Logger::Get().ComError("CreateTextureFromDDS 失败", hr);
+		return nullptr;
+	}
 
 	winrt::com_ptr<ID3D11Texture2D> tex = result.try_as<ID3D11Texture2D>();
 	if (!tex) {
@@ -851,30 +866,135 @@ winrt::com_ptr<ID3D11Texture2D> LoadDDS(const wchar_t* fileName) {
 }
 
 winrt::com_ptr<ID3D11Texture2D> TextureLoader::Load(const wchar_t* fileName) {
-	std::wstring_view sv(fileName);
-	size_t npos = sv.find_last_of(L'.');
-	if (npos == std::wstring_view::npos) {
-		Logger::Get().Error("文件名无后缀名");
+	std::shared_ptr<DecodedTexture> decoded = Decode(fileName);
+	if (!decoded) {
 		return nullptr;
 	}
 
-	std::wstring_view suffix = sv.substr(npos + 1);
-	
-	static std::unordered_map<std::wstring_view, winrt::com_ptr<ID3D11Texture2D>(*)(const wchar_t*)> funcs = {
-		{L"bmp", LoadImg},
-		{L"jpg", LoadImg},
-		{L"jpeg", LoadImg},
-		{L"png", LoadImg},
-		{L"tif", LoadImg},
-		{L"tiff", LoadImg},
-		{L"dds", LoadDDS}
-	};
+	return CreateTexture(*decoded);
+}
 
-	auto it = funcs.find(suffix);
-	if (it == funcs.end()) {
-		Logger::Get().Error("不支持读取该格式");
+std::wstring TextureLoader::GetFileKey(const wchar_t* fileName) {
+	WIN32_FILE_ATTRIBUTE_DATA attrs{};
+	if (!GetFileAttributesEx(fileName, GetFileExInfoStandard, &attrs)) {
+		Logger::Get().Win32Error(StrUtils::Concat("获取文件 ", StrUtils::UTF16ToUTF8(fileName), " 的属性失败"));
+		return {};
+	}
+
+	return fmt::format(L"{}|{}|{}",
+		fileName,
+		((UINT64)attrs.nFileSizeHigh << 32) | attrs.nFileSizeLow,
+		((UINT64)attrs.ftLastWriteTime.dwHighDateTime << 32) | attrs.ftLastWriteTime.dwLowDateTime
+	);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// 解码后数据的进程级缓存，重新创建设备（比如再次缩放）时不必再次读取和解码
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// 超过此大小时清理最久未使用的项
+static constexpr size_t MAX_DECODED_CACHE_SIZE = 64 * 1024 * 1024;
+
+static Utils::CSMutex decodedCacheCS;
+// fileKey -> (decoded, lastAccess)
+static std::unordered_map<std::wstring, std::pair<std::shared_ptr<const DecodedTexture>, UINT>> decodedCache;
+static size_t decodedCacheSize = 0;
+static UINT decodedCacheLastAccess = 0;
+
+static std::shared_ptr<const DecodedTexture> FindDecoded(const std::wstring& fileKey) {
+	std::scoped_lock lk(decodedCacheCS);
+
+	auto it = decodedCache.find(fileKey);
+	if (it == decodedCache.end()) {
 		return nullptr;
 	}
 
-	return it->second(fileName);
+	it->second.second = ++decodedCacheLastAccess;
+	return it->second.first;
+}
+
+static void AddDecoded(const std::wstring& fileKey, const std::shared_ptr<const DecodedTexture>& decoded) {
+	if (decoded->dataSize > MAX_DECODED_CACHE_SIZE / 4) {
+		// 不缓存过大的纹理
+		return;
+	}
+
+	if (decoded->ddsView) {
+		// DDS 文件无需解码，再次映射的开销很小。保留映射会阻止文件被修改
+		return;
+	}
+
+	std::scoped_lock lk(decodedCacheCS);
+
+	auto [it, inserted] = decodedCache.try_emplace(fileKey, decoded, ++decodedCacheLastAccess);
+	if (!inserted) {
+		return;
+	}
+	decodedCacheSize += decoded->dataSize;
+
+	while (decodedCacheSize > MAX_DECODED_CACHE_SIZE) {
+		auto oldest = std::min_element(decodedCache.begin(), decodedCache.end(), [](const auto& l, const auto& r) {
+			return l.second.second < r.second.second;
+		});
+
+		decodedCacheSize -= oldest->second.first->dataSize;
+		decodedCache.erase(oldest);
+	}
+}
+
+struct LoadTask {
+	std::wstring fileName;
+	std::wstring fileKey;
+	std::promise<winrt::com_ptr<ID3D11Texture2D>> promise;
+};
+
+static winrt::com_ptr<ID3D11Texture2D> LoadCached(const std::wstring& fileName, const std::wstring& fileKey) {
+	if (fileKey.empty()) {
+		return TextureLoader::Load(fileName.c_str());
+	}
+
+	std::shared_ptr<const DecodedTexture> decoded = FindDecoded(fileKey);
+	if (decoded) {
+		Logger::Get().Info(StrUtils::Concat("已从缓存中读取纹理 ", StrUtils::UTF16ToUTF8(fileName)));
+	} else {
+		std::shared_ptr<DecodedTexture> newDecoded = Decode(fileName.c_str());
+		if (!newDecoded) {
+			return nullptr;
+		}
+
+		decoded = newDecoded;
+		AddDecoded(fileKey, decoded);
+	}
+
+	return CreateTexture(*decoded);
+}
+
+static void CALLBACK LoadTaskCallback(PTP_CALLBACK_INSTANCE, PVOID context) {
+	std::unique_ptr<LoadTask> task((LoadTask*)context);
+	task->promise.set_value(LoadCached(task->fileName, task->fileKey));
+}
+
+TextureLoader::AsyncTexture TextureLoader::LoadAsync(std::wstring fileName, std::wstring fileKey) {
+	LoadTask* task = new LoadTask{ std::move(fileName), std::move(fileKey) };
+	AsyncTexture result = task->promise.get_future().share();
+
+	// D3D 设备的创建函数是线程安全的
+	if (!TrySubmitThreadpoolCallback(LoadTaskCallback, task, nullptr)) {
+		Logger::Get().Win32Error("TrySubmitThreadpoolCallback 失败，回退到同步加载");
+		LoadTaskCallback(nullptr, task);
+	}
+
+	return result;
+}
+
+void TextureLoader::WaitAll(const std::vector<std::vector<AsyncTexture>>& textures) {
+	for (const std::vector<AsyncTexture>& effectTextures : textures) {
+		for (const AsyncTexture& texture : effectTextures) {
+			if (texture.valid()) {
+				texture.wait();
+			}
+		}
+	}
 }
@@ -1,8 +1,22 @@
 #pragma once
 #include "pch.h"
+#include <future>
 
 
 class TextureLoader {
 public:
 	static winrt::com_ptr<ID3D11Texture2D> Load(const wchar_t* fileName);
+
+	// 加载失败时结果为空
+	using AsyncTexture = std::shared_future<winrt::com_ptr<ID3D11Texture2D>>;
+
+	// 在线程池中加载纹理，可以和着色器编译同时进行
+	// fileKey 不为空时解码后的数据将被缓存，同一进程中再次加载时无需读取文件
+	static AsyncTexture LoadAsync(std::wstring fileName, std::wstring fileKey = {});
+
+	// 等待所有加载完成。加载纹理时使用 D3D 设备，销毁相关对象前必须调用
+	static void WaitAll(const std::vector<std::vector<AsyncTexture>>& textures);
+
+	// 由路径、文件大小和修改时间组成，文件改变后缓存自动失效。失败时返回空
+	static std::wstring GetFileKey(const wchar_t* fileName);
 };
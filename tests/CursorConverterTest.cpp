@@ -0,0 +1,165 @@
+#include "pch.h"
+#include "CursorConverter.h"
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// 比较 CursorConverter 的标量、SSE2 和 AVX2 实现，三者的结果应逐字节相同
+// 像素数覆盖 0 到 70 以及较大的值，包括不是 4 或 8 的倍数的长度，以检查末尾的标量处理
+
+using ISA = CursorConverter::ISA;
+
+static int failures = 0;
+
+static const char* GetISAName(ISA isa) {
+	switch (isa) {
+	case ISA::Scalar:
+		return "Scalar";
+	case ISA::SSE2:
+		return "SSE2";
+	default:
+		return "AVX2";
+	}
+}
+
+static void Check(bool condition, const char* func, ISA isa, size_t pixelCount) {
+	if (!condition) {
+		++failures;
+		std::printf("失败：%s，%s，像素数 %zu\n", func, GetISAName(isa), pixelCount);
+	}
+}
+
+static std::vector<size_t> GetPixelCounts() {
+	std::vector<size_t> result;
+	for (size_t i = 0; i <= 70; ++i) {
+		result.push_back(i);
+	}
+	for (size_t i : { 255, 256, 257, 1023, 1024, 1029, 4096 + 7 }) {
+		result.push_back(i);
+	}
+	return result;
+}
+
+static std::vector<BYTE> RandomPixels(std::mt19937& rng, size_t pixelCount) {
+	std::uniform_int_distribution<int> dist(0, 255);
+	std::vector<BYTE> result(pixelCount * 4);
+	for (BYTE& b : result) {
+		b = (BYTE)dist(rng);
+	}
+	return result;
+}
+
+static void TestHasAlpha(std::mt19937& rng, std::span<const ISA> isas) {
+	for (size_t pixelCount : GetPixelCounts()) {
+		std::vector<BYTE> pixels = RandomPixels(rng, pixelCount);
+		for (size_t i = 0; i < pixelCount; ++i) {
+			pixels[i * 4 + 3] = 0;
+		}
+
+		for (ISA isa : isas) {
+			Check(!CursorConverter::HasAlpha(pixels.data(), pixelCount, isa), "HasAlpha", isa, pixelCount);
+		}
+
+		// 依次在每个位置放置唯一的非零 A 通道，覆盖向量部分和末尾
+		for (size_t pos = 0; pos < pixelCount; pos += pixelCount > 70 ? 61 : 1) {
+			pixels[pos * 4 + 3] = BYTE(1 + pos % 255);
+			for (ISA isa : isas) {
+				Check(CursorConverter::HasAlpha(pixels.data(), pixelCount, isa), "HasAlpha", isa, pixelCount);
+			}
+			pixels[pos * 4 + 3] = 0;
+		}
+	}
+}
+
+template <typename F>
+static void CompareWithScalar(
+	std::mt19937& rng,
+	std::span<const ISA> isas,
+	const char* func,
+	F&& convert
+) {
+	for (size_t pixelCount : GetPixelCounts()) {
+		const std::vector<BYTE> src = RandomPixels(rng, pixelCount);
+		const std::vector<BYTE> other = RandomPixels(rng, pixelCount);
+
+		std::vector<BYTE> expected = src;
+		convert(expected.data(), other.data(), pixelCount, ISA::Scalar);
+
+		for (ISA isa : isas) {
+			// 多分配一个像素，检查是否越界写入
+			std::vector<BYTE> actual = src;
+			actual.resize(actual.size() + 4, 0xCD);
+			convert(actual.data(), other.data(), pixelCount, isa);
+
+			bool tailIntact = std::all_of(actual.end() - 4, actual.end(), [](BYTE b) { return b == 0xCD; });
+			actual.resize(src.size());
+			Check(actual == expected && tailIntact, func, isa, pixelCount);
+		}
+	}
+}
+
+// 标量实现是参考，检查它和浮点计算一致
+static void TestConvertColorReference() {
+	std::vector<BYTE> pixels(256 * 256 * 4);
+	for (UINT a = 0; a < 256; ++a) {
+		for (UINT c = 0; c < 256; ++c) {
+			BYTE* p = &pixels[(a * 256 + c) * 4];
+			p[0] = (BYTE)c;
+			p[1] = (BYTE)(255 - c);
+			p[2] = (BYTE)(c ^ 0x5A);
+			p[3] = (BYTE)a;
+		}
+	}
+
+	CursorConverter::ConvertColor(pixels.data(), 256 * 256, ISA::Scalar);
+
+	for (UINT a = 0; a < 256; ++a) {
+		for (UINT c = 0; c < 256; ++c) {
+			const BYTE* p = &pixels[(a * 256 + c) * 4];
+			auto premultiply = [a](UINT v) {
+				return (BYTE)std::lround(v * a / 255.0);
+			};
+
+			bool correct = p[0] == premultiply(c ^ 0x5A) && p[1] == premultiply(255 - c)
+				&& p[2] == premultiply(c) && p[3] == 255 - a;
+			if (!correct) {
+				++failures;
+				std::printf("失败：ConvertColor 参考值，c=%u，a=%u\n", c, a);
+				return;
+			}
+		}
+	}
+}
+
+int main() {
+	std::vector<ISA> isas{ ISA::Scalar, ISA::SSE2 };
+	if (CursorConverter::GetBestISA() == ISA::AVX2) {
+		isas.push_back(ISA::AVX2);
+	} else {
+		std::printf("CPU 不支持 AVX2，跳过 AVX2 实现\n");
+	}
+
+	std::mt19937 rng(42);
+
+	TestConvertColorReference();
+	TestHasAlpha(rng, isas);
+
+	CompareWithScalar(rng, isas, "ConvertColor", [](BYTE* pixels, const BYTE*, size_t pixelCount, ISA isa) {
+		CursorConverter::ConvertColor(pixels, pixelCount, isa);
+	});
+	CompareWithScalar(rng, isas, "ConvertMaskedColor", [](BYTE* pixels, const BYTE* mask, size_t pixelCount, ISA isa) {
+		CursorConverter::ConvertMaskedColor(pixels, mask, pixelCount, isa);
+	});
+	CompareWithScalar(rng, isas, "ConvertMonochrome", [](BYTE* andPixels, const BYTE* xorPixels, size_t pixelCount, ISA isa) {
+		CursorConverter::ConvertMonochrome(andPixels, xorPixels, pixelCount, isa);
+	});
+
+	if (failures > 0) {
+		std::printf("%d 项检查失败\n", failures);
+		return 1;
+	}
+
+	std::printf("全部通过\n");
+	return 0;
+}
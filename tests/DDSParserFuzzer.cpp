@@ -0,0 +1,33 @@
+#include "DDSParser.h"
+#include <cstdlib>
+
+// ParseDDSData 的模糊测试入口，使用 Clang 和 -DMAGPIE_TESTS_FUZZ=ON 时构建为 libFuzzer 目标
+// DDSParserTest 也会在随机变异的输入上调用它
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+	const DDS_HEADER* header = nullptr;
+	const uint8_t* bitData = nullptr;
+	size_t bitSize = 0;
+	if (ParseDDSData(data, size, &header, &bitData, &bitSize) != DDSParseResult::Success) {
+		return 0;
+	}
+
+	const DDS_HEADER_DXT10* d3d10ext = nullptr;
+	if ((header->ddspf.flags & DDS_FOURCC) && MAKEFOURCC('D', 'X', '1', '0') == header->ddspf.fourCC) {
+		d3d10ext = reinterpret_cast<const DDS_HEADER_DXT10*>(header + 1);
+	}
+
+	uint64_t dataSize = 0;
+	if (GetDDSDataSize(header, d3d10ext, &dataSize) != DDSParseResult::Success || dataSize > bitSize
+		|| bitData < data || bitData + bitSize != data + size) {
+		std::abort();
+	}
+
+	// 读取声明的所有数据，越界时 AddressSanitizer 会报告
+	volatile uint8_t sum = 0;
+	for (uint64_t i = 0; i < dataSize; ++i) {
+		sum = sum + bitData[i];
+	}
+
+	return 0;
+}
@@ -0,0 +1,365 @@
+#include "DDSParser.h"
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <vector>
+
+// 检查 ParseDDSData 拒绝损坏的文件头和声明的尺寸超出数据的文件，并在随机变异的输入上运行模糊测试入口
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+static int failures = 0;
+
+static const char* GetResultName(DDSParseResult result) {
+	switch (result) {
+	case DDSParseResult::Success:
+		return "Success";
+	case DDSParseResult::InvalidArgument:
+		return "InvalidArgument";
+	case DDSParseResult::InvalidData:
+		return "InvalidData";
+	case DDSParseResult::NotSupported:
+		return "NotSupported";
+	default:
+		return "EndOfFile";
+	}
+}
+
+struct DDSDesc {
+	uint32_t width = 4;
+	uint32_t height = 4;
+	uint32_t depth = 0;
+	uint32_t mipCount = 1;
+	// DXGI_FORMAT_UNKNOWN 表示不使用 DX10 扩展头，像素格式为 32 位 RGBA
+	DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+	uint32_t resourceDimension = DDS_DIMENSION_TEXTURE2D;
+	uint32_t miscFlag = 0;
+	uint32_t arraySize = 1;
+	uint32_t flags = DDS_HEADER_FLAGS_TEXTURE;
+	uint32_t caps2 = 0;
+};
+
+// 生成文件头，之后跟随 dataSize 字节的数据
+static std::vector<uint8_t> MakeDDS(const DDSDesc& desc, size_t dataSize) {
+	DDS_HEADER header{};
+	header.size = sizeof(DDS_HEADER);
+	header.flags = desc.flags;
+	header.width = desc.width;
+	header.height = desc.height;
+	header.depth = desc.depth;
+	header.mipMapCount = desc.mipCount;
+	header.caps2 = desc.caps2;
+	header.ddspf.size = sizeof(DDS_PIXELFORMAT);
+
+	if (desc.format == DXGI_FORMAT_UNKNOWN) {
+		header.ddspf = DDSPF_A8B8G8R8;
+	} else {
+		header.ddspf = DDSPF_DX10;
+	}
+
+	const bool hasDX10Header = desc.format != DXGI_FORMAT_UNKNOWN;
+	const size_t headerSize = sizeof(uint32_t) + sizeof(DDS_HEADER) + (hasDX10Header ? sizeof(DDS_HEADER_DXT10) : 0);
+
+	std::vector<uint8_t> result(headerSize);
+	std::memcpy(result.data(), &DDS_MAGIC, sizeof(uint32_t));
+	std::memcpy(result.data() + sizeof(uint32_t), &header, sizeof(header));
+
+	if (hasDX10Header) {
+		DDS_HEADER_DXT10 ext{};
+		ext.dxgiFormat = desc.format;
+		ext.resourceDimension = desc.resourceDimension;
+		ext.miscFlag = desc.miscFlag;
+		ext.arraySize = desc.arraySize;
+
+		std::memcpy(result.data() + sizeof(uint32_t) + sizeof(DDS_HEADER), &ext, sizeof(ext));
+	}
+
+	result.resize(result.size() + dataSize, 0x5A);
+	return result;
+}
+
+static void Expect(const char* name, const std::vector<uint8_t>& dds, DDSParseResult expected) {
+	const DDS_HEADER* header = nullptr;
+	const uint8_t* bitData = nullptr;
+	size_t bitSize = 0;
+	DDSParseResult result = ParseDDSData(dds.data(), dds.size(), &header, &bitData, &bitSize);
+	if (result != expected) {
+		++failures;
+		std::printf("失败：%s，期望 %s，实际为 %s\n", name, GetResultName(expected), GetResultName(result));
+	}
+}
+
+// 数据恰好足够时成功，少一个字节时失败
+static void ExpectExactSize(const char* name, const DDSDesc& desc, size_t dataSize) {
+	Expect(name, MakeDDS(desc, dataSize), DDSParseResult::Success);
+	Expect(name, MakeDDS(desc, dataSize + 100), DDSParseResult::Success);
+	Expect(name, MakeDDS(desc, dataSize - 1), DDSParseResult::EndOfFile);
+}
+
+static void TestDataSize() {
+	{
+		DDSDesc desc;
+		ExpectExactSize("4x4 RGBA", desc, 4 * 4 * 4);
+	}
+	{
+		DDSDesc desc;
+		desc.width = 8;
+		desc.height = 8;
+		desc.mipCount = 4;
+		desc.flags |= DDS_HEADER_FLAGS_MIPMAP;
+		ExpectExactSize("8x8 RGBA，4 级 mipmap", desc, (64 + 16 + 4 + 1) * 4);
+	}
+	{
+		// 和 Lanczos_Separable_Weights.dds 相同的布局
+		DDSDesc desc;
+		desc.width = 2;
+		desc.height = 257;
+		desc.format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+		ExpectExactSize("2x257 R32G32B32A32_FLOAT", desc, 2 * 257 * 16);
+	}
+	{
+		DDSDesc desc;
+		desc.width = 5;
+		desc.height = 5;
+		desc.format = DXGI_FORMAT_BC1_UNORM;
+		ExpectExactSize("5x5 BC1", desc, 2 * 2 * 8);
+	}
+	{
+		DDSDesc desc;
+		desc.width = 16;
+		desc.height = 4;
+		desc.format = DXGI_FORMAT_R16G16B16A16_FLOAT;
+		desc.arraySize = 3;
+		ExpectExactSize("16x4 数组", desc, 3 * 16 * 4 * 8);
+	}
+	{
+		DDSDesc desc;
+		desc.format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		desc.miscFlag = DDS_RESOURCE_MISC_TEXTURECUBE;
+		ExpectExactSize("立方体贴图", desc, 6 * 4 * 4 * 4);
+	}
+	{
+		DDSDesc desc;
+		desc.caps2 = DDS_CUBEMAP_ALLFACES;
+		ExpectExactSize("旧格式的立方体贴图", desc, 6 * 4 * 4 * 4);
+	}
+	{
+		DDSDesc desc;
+		desc.depth = 4;
+		desc.mipCount = 2;
+		desc.flags |= DDS_HEADER_FLAGS_VOLUME | DDS_HEADER_FLAGS_MIPMAP;
+		desc.format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		desc.resourceDimension = DDS_DIMENSION_TEXTURE3D;
+		ExpectExactSize("4x4x4 体积纹理", desc, (64 + 8) * 4);
+	}
+	{
+		DDSDesc desc;
+		desc.width = 7;
+		desc.height = 1;
+		desc.format = DXGI_FORMAT_R8_UNORM;
+		desc.resourceDimension = DDS_DIMENSION_TEXTURE1D;
+		ExpectExactSize("1D 纹理", desc, 7);
+	}
+}
+
+static void TestInvalidHeaders() {
+	std::vector<uint8_t> valid = MakeDDS({}, 64);
+
+	Expect("空指针", {}, DDSParseResult::InvalidArgument);
+	Expect("只有 magic", std::vector<uint8_t>(valid.begin(), valid.begin() + 4), DDSParseResult::InvalidData);
+	Expect("只有文件头的一部分", std::vector<uint8_t>(valid.begin(), valid.begin() + 100), DDSParseResult::InvalidData);
+
+	{
+		std::vector<uint8_t> dds = valid;
+		dds[0] = 'X';
+		Expect("错误的 magic", dds, DDSParseResult::InvalidData);
+	}
+	{
+		std::vector<uint8_t> dds = valid;
+		dds[4] = 100;
+		Expect("错误的文件头大小", dds, DDSParseResult::InvalidData);
+	}
+	{
+		DDSDesc desc;
+		desc.format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		std::vector<uint8_t> dds = MakeDDS(desc, 0);
+		dds.resize(dds.size() - 1);
+		Expect("DX10 扩展头不完整", dds, DDSParseResult::InvalidData);
+	}
+
+	const auto expectDesc = [](const char* name, const DDSDesc& desc, DDSParseResult expected) {
+		// 数据足够大，只检查文件头
+		Expect(name, MakeDDS(desc, 4096), expected);
+	};
+
+	{
+		DDSDesc desc;
+		desc.width = 0;
+		expectDesc("宽度为 0", desc, DDSParseResult::InvalidData);
+	}
+	{
+		DDSDesc desc;
+		desc.width = 0xFFFFFFFF;
+		expectDesc("宽度过大", desc, DDSParseResult::NotSupported);
+	}
+	{
+		DDSDesc desc;
+		desc.height = DDS_MAX_DIMENSION + 1;
+		expectDesc("高度过大", desc, DDSParseResult::NotSupported);
+	}
+	{
+		DDSDesc desc;
+		desc.mipCount = 0xFFFFFFFF;
+		expectDesc("mipmap 过多", desc, DDSParseResult::NotSupported);
+	}
+	{
+		DDSDesc desc;
+		desc.format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		desc.arraySize = 0xFFFFFFFF;
+		expectDesc("数组过大", desc, DDSParseResult::NotSupported);
+	}
+	{
+		DDSDesc desc;
+		desc.format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		desc.arraySize = DDS_MAX_ARRAY_SIZE;
+		desc.miscFlag = DDS_RESOURCE_MISC_TEXTURECUBE;
+		expectDesc("立方体贴图数组过大", desc, DDSParseResult::NotSupported);
+	}
+	{
+		DDSDesc desc;
+		desc.format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		desc.arraySize = 0;
+		expectDesc("数组大小为 0", desc, DDSParseResult::InvalidData);
+	}
+	{
+		DDSDesc desc;
+		desc.format = (DXGI_FORMAT)200;
+		expectDesc("未知格式", desc, DDSParseResult::NotSupported);
+	}
+	{
+		DDSDesc desc;
+		desc.format = DXGI_FORMAT_P8;
+		expectDesc("视频格式", desc, DDSParseResult::NotSupported);
+	}
+	{
+		DDSDesc desc;
+		desc.format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		desc.resourceDimension = 1;
+		expectDesc("缓冲区", desc, DDSParseResult::NotSupported);
+	}
+	{
+		DDSDesc desc;
+		desc.format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		desc.resourceDimension = DDS_DIMENSION_TEXTURE3D;
+		desc.depth = 4;
+		expectDesc("体积纹理缺少标志", desc, DDSParseResult::InvalidData);
+	}
+	{
+		DDSDesc desc;
+		desc.depth = 0;
+		desc.flags |= DDS_HEADER_FLAGS_VOLUME;
+		expectDesc("深度为 0", desc, DDSParseResult::InvalidData);
+	}
+	{
+		DDSDesc desc;
+		desc.caps2 = DDS_CUBEMAP_POSITIVEX;
+		expectDesc("不完整的立方体贴图", desc, DDSParseResult::NotSupported);
+	}
+	{
+		DDSDesc desc;
+		desc.format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		desc.resourceDimension = DDS_DIMENSION_TEXTURE1D;
+		desc.flags |= DDS_HEIGHT;
+		expectDesc("1D 纹理的高度不为 1", desc, DDSParseResult::InvalidData);
+	}
+}
+
+// Effects 中的 DDS 文件应能被解析
+static void TestEffectFiles() {
+	std::ifstream file(MAGPIE_EFFECTS_DIR "/Lanczos_Separable_Weights.dds", std::ios::binary);
+	if (!file) {
+		++failures;
+		std::printf("失败：无法打开 Lanczos_Separable_Weights.dds\n");
+		return;
+	}
+
+	std::vector<uint8_t> dds{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+	Expect("Lanczos_Separable_Weights.dds", dds, DDSParseResult::Success);
+}
+
+// 在合法文件的基础上随机修改文件头中的字节和文件长度
+static void TestRandomMutations() {
+	std::vector<std::vector<uint8_t>> seeds;
+	{
+		DDSDesc desc;
+		desc.width = 8;
+		desc.height = 8;
+		desc.mipCount = 4;
+		seeds.push_back(MakeDDS(desc, 340));
+	}
+	{
+		DDSDesc desc;
+		desc.format = DXGI_FORMAT_BC3_UNORM;
+		desc.width = 12;
+		desc.height = 8;
+		desc.arraySize = 2;
+		seeds.push_back(MakeDDS(desc, 2 * 3 * 2 * 16));
+	}
+	{
+		DDSDesc desc;
+		desc.depth = 2;
+		desc.flags |= DDS_HEADER_FLAGS_VOLUME;
+		desc.format = DXGI_FORMAT_NV12;
+		desc.resourceDimension = DDS_DIMENSION_TEXTURE3D;
+		seeds.push_back(MakeDDS(desc, 64));
+	}
+
+	std::mt19937 rng(42);
+	for (int i = 0; i < 200000; ++i) {
+		std::vector<uint8_t> dds = seeds[i % seeds.size()];
+
+		const int mutations = std::uniform_int_distribution<int>(1, 4)(rng);
+		for (int j = 0; j < mutations; ++j) {
+			// 多数修改落在文件头中
+			const size_t limit = std::min<size_t>(dds.size(), sizeof(uint32_t) + sizeof(DDS_HEADER) + sizeof(DDS_HEADER_DXT10));
+			const size_t pos = std::uniform_int_distribution<size_t>(0, limit - 1)(rng);
+			switch (rng() % 3) {
+			case 0:
+				dds[pos] = (uint8_t)rng();
+				break;
+			case 1:
+				dds[pos] ^= uint8_t(1 << (rng() % 8));
+				break;
+			default:
+				dds.resize(std::uniform_int_distribution<size_t>(0, dds.size())(rng));
+				break;
+			}
+
+			if (dds.empty()) {
+				break;
+			}
+		}
+
+		// 复制到大小恰好的缓冲区，越界读取能被检测到
+		std::unique_ptr<uint8_t[]> data(new uint8_t[dds.size()]);
+		std::memcpy(data.get(), dds.data(), dds.size());
+		LLVMFuzzerTestOneInput(data.get(), dds.size());
+	}
+}
+
+int main() {
+	TestDataSize();
+	TestInvalidHeaders();
+	TestEffectFiles();
+	TestRandomMutations();
+
+	if (failures > 0) {
+		std::printf("%d 项检查失败\n", failures);
+		return 1;
+	}
+
+	std::printf("全部通过\n");
+	return 0;
+}
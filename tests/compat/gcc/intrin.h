@@ -0,0 +1,19 @@
+#pragma once
+
+// GCC 和 Clang 没有 <intrin.h>，在此模拟 Runtime 使用的 MSVC 内部函数
+
+#include <cpuid.h>
+
+// <cpuid.h> 中的 __cpuid 是参数不同的宏
+#undef __cpuid
+
+// 较新的 GCC 和 Clang 已在 <cpuid.h> 中提供 __cpuidex
+#if (!defined(__clang__) && __GNUC__ < 11) || (defined(__clang__) && __clang_major__ < 16)
+inline void __cpuidex(int cpuInfo[4], int function, int subfunction) {
+	__cpuid_count(function, subfunction, cpuInfo[0], cpuInfo[1], cpuInfo[2], cpuInfo[3]);
+}
+#endif
+
+inline void __cpuid(int cpuInfo[4], int function) {
+	__cpuidex(cpuInfo, function, 0);
+}
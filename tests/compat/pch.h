@@ -0,0 +1,20 @@
+#pragma once
+
+// 代替 Runtime/pch.h，只包含被测试的源文件需要的部分
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <algorithm>
+#include <utility>
+#include <span>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+using BYTE = uint8_t;
+using UINT = uint32_t;
+#endif
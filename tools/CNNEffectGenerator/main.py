@@ -0,0 +1,560 @@
+import argparse
+import json
+import os
+import struct
+import sys
+
+# 将简单的卷积网络描述和权重转换为 MagpieFX 效果
+# 仅依赖标准库，读取 .npz 格式的权重时需要 numpy
+
+
+# D3D11 中每个线程组最多 32KB 共享内存
+MAX_GROUPSHARED_BYTES = 32768
+# 常量缓冲区最多 4096 个 float4
+MAX_BUFFER_SIZE = 4096
+# 与 EffectCompiler 中的限制一致，b0 和 b1 已被占用
+MAX_BUFFER_COUNT = 12
+
+ACTIVATIONS = ("none", "relu", "crelu")
+
+
+class GeneratorError(Exception):
+	pass
+
+
+def div_round_up(a, b):
+	return (a + b - 1) // b
+
+
+def to_list(value):
+	# numpy 数组和嵌套列表统一转为嵌套列表
+	if hasattr(value, "tolist"):
+		return value.tolist()
+	return value
+
+
+def shape_of(value):
+	shape = []
+	while isinstance(value, list):
+		shape.append(len(value))
+		value = value[0] if value else None
+	return tuple(shape)
+
+
+class ConvLayer:
+	def __init__(self, index, in_channels, out_channels, activation, weight, bias):
+		self.index = index
+		self.in_channels = in_channels
+		self.out_channels = out_channels
+		self.activation = activation
+		# weight[out][in][ky][kx]，与 PyTorch 的布局相同
+		self.weight = weight
+		self.bias = bias
+		# 由 Generator 填充
+		self.in_tex_count = 0
+		self.out_tex_count = 0
+		self.input_activation = "none"
+		self.weights_name = ""
+		self.weights_offset = 0
+
+	def branch_count(self):
+		return 2 if self.input_activation == "crelu" else 1
+
+	def stride(self):
+		# 每个输出纹理的权重数量：偏置 + 输入纹理数 * 9 个采样点 * 分支数 * 4 行
+		return 1 + self.in_tex_count * 9 * self.branch_count() * 4
+
+	def weight_count(self):
+		return self.out_tex_count * self.stride()
+
+	def pack_weights(self):
+		# 按生成的着色器中的访问顺序排列，见 emit_conv
+		# 输入通道 i 的 CReLU 分支为 cat([relu(x), relu(-x)])，即 i 和 prevChannels + i
+		prev_channels = self.in_channels // self.branch_count()
+		result = []
+		for o in range(self.out_tex_count):
+			result.append([self.bias[o * 4 + c] if o * 4 + c < self.out_channels else 0.0 for c in range(4)])
+			for t in range(self.in_tex_count):
+				for ky in range(3):
+					for kx in range(3):
+						for b in range(self.branch_count()):
+							for r in range(4):
+								ci = t * 4 + r
+								row = [0.0] * 4
+								if ci < prev_channels:
+									ci += b * prev_channels
+									for c in range(4):
+										co = o * 4 + c
+										if co < self.out_channels:
+											row[c] = self.weight[co][ci][ky][kx]
+								result.append(row)
+		assert len(result) == self.weight_count()
+		return result
+
+
+class Network:
+	def __init__(self, desc, weights):
+		self.name = desc.get("name")
+		if not self.name or not self.name.replace("_", "").isalnum():
+			raise GeneratorError("name 必须由字母、数字和下划线组成")
+		self.comment = desc.get("comment", "")
+		self.convs = []
+		self.scale = 1
+		self.residual = False
+
+		layers = desc.get("layers")
+		if not layers:
+			raise GeneratorError("layers 不能为空")
+
+		channels = 3
+		activation = "none"
+		for i, layer in enumerate(layers):
+			kind = layer.get("type")
+			if kind == "conv3x3":
+				if self.scale != 1 or self.residual:
+					raise GeneratorError(f"第 {i} 层：卷积层必须位于 depth_to_space 和 add_input 之前")
+				out_channels = layer.get("out")
+				if not isinstance(out_channels, int) or out_channels <= 0:
+					raise GeneratorError(f"第 {i} 层：out 非法")
+				in_channels = layer.get("in", channels)
+				if in_channels != channels:
+					raise GeneratorError(f"第 {i} 层：输入通道数应为 {channels}，而不是 {in_channels}")
+				act = layer.get("activation", "none")
+				if act not in ACTIVATIONS:
+					raise GeneratorError(f"第 {i} 层：未知的激活函数 {act}")
+
+				weight, bias = self._get_weights(i, layer, weights)
+				if shape_of(weight) != (out_channels, in_channels, 3, 3):
+					raise GeneratorError(f"第 {i} 层：weight 的形状应为 {(out_channels, in_channels, 3, 3)}，实际为 {shape_of(weight)}")
+				if shape_of(bias) != (out_channels,):
+					raise GeneratorError(f"第 {i} 层：bias 的形状应为 {(out_channels,)}，实际为 {shape_of(bias)}")
+
+				conv = ConvLayer(len(self.convs), in_channels, out_channels, act, weight, bias)
+				conv.input_activation = activation
+				self.convs.append(conv)
+
+				activation = act
+				channels = out_channels * 2 if act == "crelu" else out_channels
+			elif kind == "depth_to_space":
+				if not self.convs or self.scale != 1 or self.residual:
+					raise GeneratorError(f"第 {i} 层：depth_to_space 只能出现一次且必须位于卷积层之后")
+				factor = layer.get("factor", 2)
+				if not isinstance(factor, int) or factor < 2 or factor > 4:
+					raise GeneratorError(f"第 {i} 层：factor 必须为 2 到 4 之间的整数")
+				if channels != 3 * factor * factor:
+					raise GeneratorError(f"第 {i} 层：depth_to_space 的输入通道数应为 {3 * factor * factor}，而不是 {channels}")
+				self.scale = factor
+			elif kind == "add_input":
+				if not self.convs or self.residual:
+					raise GeneratorError(f"第 {i} 层：add_input 只能出现一次且必须位于卷积层之后")
+				self.residual = True
+			else:
+				raise GeneratorError(f"第 {i} 层：未知的层类型 {kind}")
+
+		if not self.convs:
+			raise GeneratorError("网络中没有卷积层")
+		if self.convs[-1].activation != "none":
+			raise GeneratorError("最后一个卷积层不能有激活函数")
+		if self.scale == 1 and channels != 3:
+			raise GeneratorError(f"输出通道数应为 3，而不是 {channels}")
+
+		for conv in self.convs:
+			conv.in_tex_count = div_round_up(conv.in_channels // conv.branch_count(), 4)
+			conv.out_tex_count = div_round_up(conv.out_channels, 4)
+
+	@staticmethod
+	def _get_weights(i, layer, weights):
+		if weights is None:
+			weight, bias = layer.get("weight"), layer.get("bias")
+		else:
+			weight, bias = weights.get(f"{i}.weight"), weights.get(f"{i}.bias")
+		if weight is None or bias is None:
+			raise GeneratorError(f"第 {i} 层：缺少权重")
+		return to_list(weight), to_list(bias)
+
+
+def load_weights(path):
+	if path is None:
+		return None
+	if path.endswith(".npz"):
+		try:
+			import numpy
+		except ImportError:
+			raise GeneratorError("读取 .npz 需要 numpy")
+		with numpy.load(path) as npz:
+			return {key: npz[key].astype(numpy.float32).tolist() for key in npz.files}
+	with open(path, encoding="utf-8") as f:
+		return json.load(f)
+
+
+def format_float(value):
+	# 先转为 float32，保证内联和 BUFFER 两种方式的结果一致
+	value = struct.unpack("<f", struct.pack("<f", value))[0]
+	text = f"{value:.9g}"
+	if "e" not in text and "." not in text and "inf" not in text and "nan" not in text:
+		text += ".0"
+	return text
+
+
+class Pass:
+	def __init__(self, convs, is_last):
+		self.convs = convs
+		self.is_last = is_last
+		self.inputs = []
+		self.outputs = []
+
+
+class Generator:
+	def __init__(self, network, block_size, num_threads, fuse, inline_weights):
+		self.net = network
+		self.block_size = block_size
+		self.num_threads = num_threads
+		self.fuse = fuse
+		self.inline_weights = inline_weights
+		# (文件名, 数据)
+		self.buffers = []
+
+		# 中间层按 fuse 分组，最后一个卷积层单独作为最后一个通道
+		middle = network.convs[:-1]
+		self.passes = [Pass(middle[i:i + fuse], False) for i in range(0, len(middle), fuse)]
+		self.passes.append(Pass([network.convs[-1]], True))
+
+		# 中间纹理在两组之间交替使用
+		set_size = max([p.convs[-1].out_tex_count for p in self.passes[:-1]], default=0)
+		self.textures = []
+		prev = ["INPUT"]
+		for i, p in enumerate(self.passes):
+			p.inputs = prev
+			if not p.is_last:
+				base = (i % 2) * set_size
+				p.outputs = [f"tex{base + t + 1}" for t in range(p.convs[-1].out_tex_count)]
+				self.textures += [tex for tex in p.outputs if tex not in self.textures]
+				prev = p.outputs
+		self.textures.sort(key=lambda tex: int(tex[3:]))
+
+		for p in self.passes:
+			self._check_groupshared(p)
+
+		if not inline_weights and len(self.passes) > MAX_BUFFER_COUNT:
+			raise GeneratorError(f"通道数超过了 {MAX_BUFFER_COUNT}，请使用 --fuse 或 --inline-weights")
+		for i, p in enumerate(self.passes):
+			offset = 0
+			for conv in p.convs:
+				conv.weights_name = f"weights{i + 1}"
+				conv.weights_offset = offset
+				offset += conv.weight_count()
+			if not inline_weights and offset > MAX_BUFFER_SIZE:
+				raise GeneratorError(f"通道 {i + 1} 的权重数量 {offset} 超过了 {MAX_BUFFER_SIZE}，请使用 --inline-weights")
+
+	def _tile_size(self, p, stage):
+		# 第 stage 层的输入区块包含的边框宽度随融合的层数递减
+		return self.block_size + 2 * (len(p.convs) - stage)
+
+	def _check_groupshared(self, p):
+		size = 0
+		for s, conv in enumerate(p.convs):
+			size += conv.in_tex_count * self._tile_size(p, s) ** 2 * 16
+		if size > MAX_GROUPSHARED_BYTES:
+			raise GeneratorError(f"共享内存用量 {size} 字节超过了 {MAX_GROUPSHARED_BYTES}，请减小 --block-size 或 --fuse")
+
+	def generate(self, out_path):
+		name = self.net.name
+		lines = [f"// {name}"]
+		if self.net.comment:
+			lines.append(f"// {self.net.comment}")
+		lines.append("// 由 tools/CNNEffectGenerator 生成")
+		lines += [
+			"",
+			"//!MAGPIE EFFECT",
+			"//!VERSION 2",
+		]
+		if self.net.scale != 1:
+			lines += [
+				f"//!OUTPUT_WIDTH INPUT_WIDTH * {self.net.scale}",
+				f"//!OUTPUT_HEIGHT INPUT_HEIGHT * {self.net.scale}",
+			]
+		lines += [
+			"",
+			"",
+			"//!TEXTURE",
+			"Texture2D INPUT;",
+			"",
+			"//!SAMPLER",
+			"//!FILTER POINT",
+			"SamplerState sam;",
+			"",
+		]
+		if self.net.residual:
+			lines += [
+				"//!SAMPLER",
+				"//!FILTER LINEAR",
+				"SamplerState sam1;",
+				"",
+			]
+		for tex in self.textures:
+			lines += [
+				"//!TEXTURE",
+				"//!WIDTH INPUT_WIDTH",
+				"//!HEIGHT INPUT_HEIGHT",
+				"//!FORMAT R16G16B16A16_FLOAT",
+				f"Texture2D {tex};",
+				"",
+			]
+
+		base_name = os.path.splitext(os.path.basename(out_path))[0]
+		if not self.inline_weights:
+			for i, p in enumerate(self.passes):
+				data = []
+				for conv in p.convs:
+					data += conv.pack_weights()
+				file_name = f"{base_name}_Weights{i + 1}.bin"
+				self.buffers.append((file_name, data))
+				lines += [
+					"//!BUFFER",
+					f"//!SOURCE {file_name}",
+					f"float4 weights{i + 1}[{len(data)}];",
+					"",
+				]
+
+		lines.append("")
+		for i, p in enumerate(self.passes):
+			lines += self._emit_pass(i, p)
+
+		with open(out_path, "w", encoding="utf-8", newline="\n") as f:
+			f.write("\n".join(lines).rstrip("\n") + "\n")
+
+		out_dir = os.path.dirname(out_path)
+		for file_name, data in self.buffers:
+			with open(os.path.join(out_dir, file_name), "wb") as f:
+				for row in data:
+					f.write(struct.pack("<4f", *row))
+
+	@staticmethod
+	def _desc(conv):
+		return f"Conv-{conv.out_channels}x3x3x{conv.in_channels}"
+
+	def _emit_pass(self, i, p):
+		n = i + 1
+		descs = [self._desc(conv) for conv in p.convs]
+		if p.is_last and self.net.scale != 1:
+			descs.append("Depth-to-Space")
+		block_size = self.block_size * self.net.scale if p.is_last else self.block_size
+
+		lines = [
+			"",
+			f"//!PASS {n}",
+			f"//!DESC {', '.join(descs)}",
+			f"//!IN {', '.join(p.inputs)}",
+		]
+		if not p.is_last:
+			lines.append(f"//!OUT {', '.join(p.outputs)}")
+		lines += [
+			f"//!BLOCK_SIZE {block_size}",
+			f"//!NUM_THREADS {self.num_threads}",
+			"",
+		]
+
+		if self.inline_weights:
+			data = []
+			for conv in p.convs:
+				data += conv.pack_weights()
+			lines.append(f"static const float4 weights{n}[{len(data)}] = {{")
+			for row in data:
+				lines.append(f"\tfloat4({', '.join(format_float(v) for v in row)}),")
+			lines += ["};", ""]
+
+		# 区块在输入图像中的大小，最后一个通道的 MP_BLOCK_WIDTH 位于输出空间
+		tile_base = f"(MP_BLOCK_WIDTH / {self.net.scale})" if p.is_last and self.net.scale != 1 else "MP_BLOCK_WIDTH"
+		lines.append(f"#define TILE_SIZE {tile_base}")
+		for s, conv in enumerate(p.convs):
+			lines.append(f"#define SH_SIZE{s} (TILE_SIZE + {2 * (len(p.convs) - s)})")
+		lines.append("")
+		for s, conv in enumerate(p.convs):
+			lines.append(f"groupshared float4 sh{s}[{conv.in_tex_count}][SH_SIZE{s}][SH_SIZE{s}];")
+		lines += [
+			"",
+			f"void Pass{n}(uint2 blockStart, uint3 threadId) {{",
+			"\tconst float2 inputPt = GetInputPt();",
+			"\tconst uint2 inputSize = GetInputSize();",
+		]
+		if p.is_last and self.net.scale != 1:
+			lines.append(f"\tconst uint2 tileStart = blockStart / {self.net.scale};")
+		else:
+			lines.append("\tconst uint2 tileStart = blockStart;")
+
+		# 协作加载输入区块，越界部分由采样器钳位
+		fused = len(p.convs)
+		lines += [
+			"",
+			f"\t// 协作加载包含 {fused} 像素边框的区块，每个纹素只读取一次",
+			"\tfor (uint k = threadId.x; k < SH_SIZE0 * SH_SIZE0; k += MP_NUM_THREADS_X) {",
+			"\t\tconst uint2 shPos = uint2(k % SH_SIZE0, k / SH_SIZE0);",
+			f"\t\tconst float2 tpos = (int2(tileStart + shPos) - {fused} + 0.5f) * inputPt;",
+		]
+		for t, tex in enumerate(p.inputs):
+			lines.append(f"\t\tsh0[{t}][shPos.y][shPos.x] = {tex}.SampleLevel(sam, tpos, 0);")
+		lines += [
+			"\t}",
+			"",
+			"\tGroupMemoryBarrierWithGroupSync();",
+		]
+
+		for s, conv in enumerate(p.convs[:-1]):
+			# 中间层的结果写入下一层的输入区块。区块外的位置取钳位后的像素，和采样器的行为一致
+			border = fused - 1 - s
+			lines += [
+				"",
+				f"\tfor (uint k = threadId.x; k < SH_SIZE{s + 1} * SH_SIZE{s + 1}; k += MP_NUM_THREADS_X) {{",
+				f"\t\tconst uint2 dstPos = uint2(k % SH_SIZE{s + 1}, k / SH_SIZE{s + 1});",
+				f"\t\tconst int2 srcPos = clamp(int2(tileStart + dstPos) - {border}, 0, int2(inputSize) - 1);",
+				f"\t\tconst uint2 localPos = uint2(srcPos - int2(tileStart)) + {border};",
+				"",
+			]
+			lines += self._emit_conv(conv, f"sh{s}", "\t\t")
+			lines += [
+				"",
+				"\t\t[unroll]",
+				f"\t\tfor (uint i = 0; i < {conv.out_tex_count}; ++i) {{",
+				f"\t\t\tsh{s + 1}[i][dstPos.y][dstPos.x] = target[i];",
+				"\t\t}",
+				"\t}",
+				"",
+				"\tGroupMemoryBarrierWithGroupSync();",
+			]
+
+		conv = p.convs[-1]
+		lines += [
+			"",
+			"\tfor (uint k = threadId.x; k < TILE_SIZE * TILE_SIZE; k += MP_NUM_THREADS_X) {",
+			"\t\tconst uint2 localPos = uint2(k % TILE_SIZE, k / TILE_SIZE);",
+			"\t\tconst uint2 gxy = tileStart + localPos;",
+			"\t\tif (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {",
+			"\t\t\tcontinue;",
+			"\t\t}",
+			"",
+		]
+		lines += self._emit_conv(conv, f"sh{fused - 1}", "\t\t")
+		lines.append("")
+		if p.is_last:
+			lines += self._emit_output(conv)
+		else:
+			for t, tex in enumerate(p.outputs):
+				lines.append(f"\t\t{tex}[gxy] = target[{t}];")
+		lines += [
+			"\t}",
+			"}",
+		]
+		return lines
+
+	def _emit_conv(self, conv, src, indent):
+		# 计算 localPos 处的 3x3 卷积，src 中 localPos 对应卷积窗口的左上角
+		branches = conv.branch_count()
+		stride = conv.stride()
+		w = conv.weights_name
+		act = {
+			"none": ["src[i][y][x]"],
+			"relu": ["max(src[i][y][x], 0)"],
+			"crelu": ["max(src[i][y][x], 0)", "max(-src[i][y][x], 0)"],
+		}[conv.input_activation]
+
+		lines = [
+			f"{indent}// {self._desc(conv)}",
+			f"{indent}float4 src[{conv.in_tex_count}][3][3];",
+			f"{indent}[unroll]",
+			f"{indent}for (uint i = 0; i < {conv.in_tex_count}; ++i) {{",
+			f"{indent}\t[unroll]",
+			f"{indent}\tfor (uint y = 0; y < 3; ++y) {{",
+			f"{indent}\t\t[unroll]",
+			f"{indent}\t\tfor (uint x = 0; x < 3; ++x) {{",
+			f"{indent}\t\t\tsrc[i][y][x] = {src}[i][localPos.y + y][localPos.x + x];",
+			f"{indent}\t\t}}",
+			f"{indent}\t}}",
+			f"{indent}}}",
+			"",
+			f"{indent}float4 target[{conv.out_tex_count}];",
+			f"{indent}[unroll]",
+			f"{indent}for (uint o = 0; o < {conv.out_tex_count}; ++o) {{",
+			f"{indent}\tuint w = {conv.weights_offset} + o * {stride};",
+			f"{indent}\ttarget[o] = {w}[w++];",
+			f"{indent}\t[unroll]",
+			f"{indent}\tfor (uint i = 0; i < {conv.in_tex_count}; ++i) {{",
+			f"{indent}\t\t[unroll]",
+			f"{indent}\t\tfor (uint y = 0; y < 3; ++y) {{",
+			f"{indent}\t\t\t[unroll]",
+			f"{indent}\t\t\tfor (uint x = 0; x < 3; ++x) {{",
+		]
+		for b in range(branches):
+			lines += [
+				f"{indent}\t\t\t\ttarget[o] += mul({act[b]}, float4x4({w}[w], {w}[w + 1], {w}[w + 2], {w}[w + 3]));",
+				f"{indent}\t\t\t\tw += 4;",
+			]
+		lines += [
+			f"{indent}\t\t\t}}",
+			f"{indent}\t\t}}",
+			f"{indent}\t}}",
+			f"{indent}}}",
+		]
+		return lines
+
+	def _emit_output(self, conv):
+		# 按 PixelShuffle 的通道顺序输出，通道 c 在 (dx, dy) 处的值位于 c * r * r + dy * r + dx
+		r = self.net.scale
+		lines = []
+		if self.net.residual:
+			lines.append("\t\tconst float2 outputPt = GetOutputPt();")
+		for dy in range(r):
+			for dx in range(r):
+				comps = []
+				for c in range(3):
+					ch = c * r * r + dy * r + dx
+					comps.append(f"target[{ch // 4}].{'xyzw'[ch % 4]}")
+				value = f"float3({', '.join(comps)})"
+				if r == 1:
+					lines.append("\t\tconst uint2 outPos = gxy;")
+				else:
+					lines.append(f"\t\tconst uint2 outPos{dy}{dx} = gxy * {r} + uint2({dx}, {dy});")
+				pos = "outPos" if r == 1 else f"outPos{dy}{dx}"
+				if self.net.residual:
+					value += f" + INPUT.SampleLevel(sam1, ({pos} + 0.5f) * outputPt, 0).rgb"
+				lines += [
+					f"\t\tif (CheckViewport({pos})) {{",
+					f"\t\t\tWriteToOutput({pos}, {value});",
+					"\t\t}",
+				]
+		return lines
+
+
+def main():
+	parser = argparse.ArgumentParser(description="将卷积网络转换为 MagpieFX 效果")
+	parser.add_argument("model", help="网络描述文件（JSON）")
+	parser.add_argument("weights", nargs="?", help="权重文件（.npz 或 .json），省略时从网络描述中读取")
+	parser.add_argument("-o", "--output", required=True, help="输出的 .hlsl 文件")
+	parser.add_argument("--block-size", type=int, default=8, help="每个线程组处理的区块边长（输入空间）")
+	parser.add_argument("--num-threads", type=int, default=64, help="每个线程组的线程数")
+	parser.add_argument("--fuse", type=int, default=1, choices=(1, 2, 3), help="每个通道融合的中间卷积层数")
+	parser.add_argument("--inline-weights", action="store_true", help="将权重内联到着色器中而不是使用 BUFFER")
+	args = parser.parse_args()
+
+	if args.block_size < 4 or args.block_size > 32:
+		parser.error("--block-size 必须在 4 到 32 之间")
+	if args.num_threads < 1 or args.num_threads > 1024:
+		parser.error("--num-threads 必须在 1 到 1024 之间")
+
+	try:
+		with open(args.model, encoding="utf-8") as f:
+			desc = json.load(f)
+		network = Network(desc, load_weights(args.weights))
+		generator = Generator(network, args.block_size, args.num_threads, args.fuse, args.inline_weights)
+		generator.generate(args.output)
+	except (GeneratorError, OSError, ValueError) as e:
+		print(f"错误：{e}", file=sys.stderr)
+		return 1
+
+	print(f"已生成 {args.output}，共 {len(generator.passes)} 个通道")
+	for file_name, _ in generator.buffers:
+		print(f"已生成 {file_name}")
+	return 0
+
+
+if __name__ == "__main__":
+	sys.exit(main())
@@ -0,0 +1,307 @@
+import json
+import os
+import re
+import sys
+import tempfile
+import unittest
+
+import numpy as np
+
+import main
+
+# 测试 CNNEffectGenerator，需要 numpy
+# 1. 按生成的着色器的访问顺序模拟每个通道的区块、共享内存和打包的权重，和直接用 numpy 计算的卷积网络比较
+# 2. 将 testdata 中的网络生成的效果和已知输出逐字节比较。修改生成器后使用 --update 参数运行以重新生成
+
+TESTDATA_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "testdata")
+GOLDEN_NAME = "TestCNN_x2"
+# (输出文件名, block_size, num_threads, fuse, inline_weights)
+GOLDEN_VARIANTS = (
+	(f"{GOLDEN_NAME}.hlsl", 8, 64, 2, False),
+	(f"{GOLDEN_NAME}_Inline.hlsl", 8, 64, 1, True),
+)
+
+
+def activate(x, activation):
+	# x 的形状为 (C, H, W)
+	if activation == "relu":
+		return np.maximum(x, 0)
+	if activation == "crelu":
+		return np.concatenate([np.maximum(x, 0), np.maximum(-x, 0)])
+	return x
+
+
+def conv3x3(x, weight, bias):
+	# 和 PyTorch 的 Conv2d 相同，边缘使用钳位填充
+	_, h, w = x.shape
+	padded = np.pad(x, ((0, 0), (1, 1), (1, 1)), mode="edge")
+	result = np.broadcast_to(bias[:, None, None], (weight.shape[0], h, w)).copy()
+	for ky in range(3):
+		for kx in range(3):
+			result += np.einsum("oi,ihw->ohw", weight[:, :, ky, kx], padded[:, ky:ky + h, kx:kx + w])
+	return result
+
+
+def bilinear(x, scale):
+	# 和线性采样器相同，以纹素中心为基准插值，越界时钳位
+	c, h, w = x.shape
+	ys = np.clip((np.arange(h * scale) + 0.5) / scale - 0.5, 0, h - 1)
+	xs = np.clip((np.arange(w * scale) + 0.5) / scale - 0.5, 0, w - 1)
+	y0 = np.floor(ys).astype(int)
+	x0 = np.floor(xs).astype(int)
+	y1 = np.minimum(y0 + 1, h - 1)
+	x1 = np.minimum(x0 + 1, w - 1)
+	fy = (ys - y0)[None, :, None]
+	fx = (xs - x0)[None, None, :]
+	top = x[:, y0][:, :, x0] * (1 - fx) + x[:, y0][:, :, x1] * fx
+	bottom = x[:, y1][:, :, x0] * (1 - fx) + x[:, y1][:, :, x1] * fx
+	return top * (1 - fy) + bottom * fy
+
+
+def reference(network, image):
+	# 直接计算网络的输出，image 的形状为 (3, H, W)
+	x = image
+	for conv in network.convs:
+		x = conv3x3(x, np.array(conv.weight), np.array(conv.bias))
+		x = activate(x, conv.activation)
+	r = network.scale
+	if r != 1:
+		# PixelShuffle
+		c, h, w = x.shape
+		x = x.reshape(c // (r * r), r, r, h, w).transpose(0, 3, 1, 4, 2).reshape(c // (r * r), h * r, w * r)
+	if network.residual:
+		x = x + bilinear(image, r)
+	return x
+
+
+class ShaderEmulator:
+	# 按 Generator 生成的着色器模拟执行，权重取自生成的 .bin 文件或内联的数组
+
+	def __init__(self, generator, weights):
+		self.gen = generator
+		self.weights = weights
+
+	def _eval_conv(self, conv, window):
+		# window 的形状为 (in_tex_count, 3, 3, 4)，对应 _emit_conv 中的 src
+		data = self.weights[conv.weights_name]
+		branches = {
+			"none": [window],
+			"relu": [np.maximum(window, 0)],
+			"crelu": [np.maximum(window, 0), np.maximum(-window, 0)],
+		}[conv.input_activation]
+
+		target = []
+		for o in range(conv.out_tex_count):
+			w = conv.weights_offset + o * conv.stride()
+			t = data[w].copy()
+			w += 1
+			for i in range(conv.in_tex_count):
+				for y in range(3):
+					for x in range(3):
+						for branch in branches:
+							t += branch[i, y, x] @ data[w:w + 4]
+							w += 4
+			target.append(t)
+		return target
+
+	def run_pass(self, p, inputs, h, w):
+		# inputs 为各输入纹理，形状为 (H, W, 4)。返回输出纹理，最后一个通道返回所有 target
+		block = self.gen.block_size
+		fused = len(p.convs)
+		out_tex_count = p.convs[-1].out_tex_count
+		outputs = np.zeros((out_tex_count, h, w, 4))
+
+		for tile_y in range(0, h, block):
+			for tile_x in range(0, w, block):
+				# 协作加载包含 fused 像素边框的区块，越界部分由采样器钳位
+				size = block + 2 * fused
+				ys = np.clip(np.arange(size) + tile_y - fused, 0, h - 1)
+				xs = np.clip(np.arange(size) + tile_x - fused, 0, w - 1)
+				sh = np.stack([tex[ys][:, xs] for tex in inputs])
+
+				for s, conv in enumerate(p.convs[:-1]):
+					border = fused - 1 - s
+					size = block + 2 * (fused - 1 - s)
+					next_sh = np.zeros((conv.out_tex_count, size, size, 4))
+					for dy in range(size):
+						for dx in range(size):
+							src_y = min(max(tile_y + dy - border, 0), h - 1)
+							src_x = min(max(tile_x + dx - border, 0), w - 1)
+							ly = src_y - tile_y + border
+							lx = src_x - tile_x + border
+							target = self._eval_conv(conv, sh[:, ly:ly + 3, lx:lx + 3])
+							for i, t in enumerate(target):
+								next_sh[i, dy, dx] = t
+					sh = next_sh
+
+				for ly in range(block):
+					for lx in range(block):
+						gy = tile_y + ly
+						gx = tile_x + lx
+						if gy >= h or gx >= w:
+							continue
+						target = self._eval_conv(p.convs[-1], sh[:, ly:ly + 3, lx:lx + 3])
+						for i, t in enumerate(target):
+							outputs[i, gy, gx] = t
+		return outputs
+
+	def run(self, image):
+		# image 的形状为 (3, H, W)，返回 (3, H * scale, W * scale)
+		_, h, w = image.shape
+		textures = {"INPUT": np.concatenate([image.transpose(1, 2, 0), np.ones((h, w, 1))], axis=2)}
+		for p in self.gen.passes:
+			outputs = self.run_pass(p, [textures[tex] for tex in p.inputs], h, w)
+			if not p.is_last:
+				for i, tex in enumerate(p.outputs):
+					textures[tex] = outputs[i]
+
+		# 按 _emit_output 中的通道顺序输出
+		net = self.gen.net
+		r = net.scale
+		result = np.zeros((3, h * r, w * r))
+		for dy in range(r):
+			for dx in range(r):
+				for c in range(3):
+					ch = c * r * r + dy * r + dx
+					result[c, dy::r, dx::r] = outputs[ch // 4, :, :, ch % 4]
+		if net.residual:
+			result += bilinear(image, r)
+		return result
+
+
+def read_buffers(generator, out_dir):
+	weights = {}
+	for i, (file_name, _) in enumerate(generator.buffers):
+		data = np.fromfile(os.path.join(out_dir, file_name), dtype="<f4").astype(np.float64)
+		weights[f"weights{i + 1}"] = data.reshape(-1, 4)
+	return weights
+
+
+def read_inline_weights(hlsl):
+	# 解析 static const float4 weightsN[] 中内联的权重
+	weights = {}
+	for match in re.finditer(r"static const float4 (weights\d+)\[(\d+)\] = \{\n(.*?)\n\};", hlsl, re.S):
+		rows = re.findall(r"float4\(([^)]*)\)", match.group(3))
+		data = np.array([[float(v) for v in row.split(",")] for row in rows])
+		assert len(data) == int(match.group(2))
+		weights[match.group(1)] = data
+	return weights
+
+
+def random_network(rng, layers, name="Random"):
+	# layers 中的卷积层没有权重，使用随机权重填充
+	desc = {"name": name, "layers": []}
+	channels = 3
+	for layer in layers:
+		layer = dict(layer)
+		if layer["type"] == "conv3x3":
+			layer["weight"] = rng.uniform(-0.5, 0.5, (layer["out"], channels, 3, 3)).astype(np.float32).tolist()
+			layer["bias"] = rng.uniform(-0.1, 0.1, layer["out"]).astype(np.float32).tolist()
+			channels = layer["out"] * (2 if layer.get("activation") == "crelu" else 1)
+		desc["layers"].append(layer)
+	return main.Network(desc, None)
+
+
+def generate(generator, out_dir, file_name):
+	out_path = os.path.join(out_dir, file_name)
+	generator.generate(out_path)
+	with open(out_path, encoding="utf-8") as f:
+		return f.read()
+
+
+def load_golden_network():
+	with open(os.path.join(TESTDATA_DIR, f"{GOLDEN_NAME}.json"), encoding="utf-8") as f:
+		return main.Network(json.load(f), None)
+
+
+class PackingTest(unittest.TestCase):
+	# (layers, block_size, fuse, 输入尺寸)。尺寸不是区块大小的整数倍，以覆盖边缘的区块
+	CASES = (
+		# 通道数不是 4 的倍数，CReLU 后接 ReLU
+		([
+			{"type": "conv3x3", "out": 5, "activation": "crelu"},
+			{"type": "conv3x3", "out": 6, "activation": "relu"},
+			{"type": "conv3x3", "out": 12},
+			{"type": "depth_to_space", "factor": 2},
+			{"type": "add_input"},
+		], 4, 1, (9, 7)),
+		# 融合两层，区块内的中间结果需要钳位
+		([
+			{"type": "conv3x3", "out": 4, "activation": "crelu"},
+			{"type": "conv3x3", "out": 8, "activation": "crelu"},
+			{"type": "conv3x3", "out": 3, "activation": "relu"},
+			{"type": "conv3x3", "out": 27},
+			{"type": "depth_to_space", "factor": 3},
+		], 4, 2, (6, 5)),
+		# 融合三层，不缩放
+		([
+			{"type": "conv3x3", "out": 7, "activation": "relu"},
+			{"type": "conv3x3", "out": 4},
+			{"type": "conv3x3", "out": 8, "activation": "crelu"},
+			{"type": "conv3x3", "out": 3},
+			{"type": "add_input"},
+		], 5, 3, (11, 6)),
+	)
+
+	def test_against_numpy(self):
+		rng = np.random.default_rng(1)
+		for layers, block_size, fuse, (w, h) in self.CASES:
+			for inline_weights in (False, True):
+				with self.subTest(layers=len(layers), fuse=fuse, inline_weights=inline_weights):
+					network = random_network(rng, layers)
+					generator = main.Generator(network, block_size, 64, fuse, inline_weights)
+					with tempfile.TemporaryDirectory() as out_dir:
+						hlsl = generate(generator, out_dir, "Random.hlsl")
+						weights = read_inline_weights(hlsl) if inline_weights else read_buffers(generator, out_dir)
+
+					self.assertEqual(len(weights), len(generator.passes))
+					image = rng.uniform(0, 1, (3, h, w))
+					expected = reference(network, image)
+					actual = ShaderEmulator(generator, weights).run(image)
+					self.assertEqual(actual.shape, expected.shape)
+					# 权重以 float32 保存
+					np.testing.assert_allclose(actual, expected, rtol=0, atol=1e-5)
+
+	def test_golden_network(self):
+		# testdata 中的网络也需要和 numpy 的结果一致，否则已知输出没有意义
+		network = load_golden_network()
+		rng = np.random.default_rng(2)
+		image = rng.uniform(0, 1, (3, 10, 9))
+		expected = reference(network, image)
+		for _, block_size, num_threads, fuse, inline_weights in GOLDEN_VARIANTS:
+			generator = main.Generator(network, block_size, num_threads, fuse, inline_weights)
+			with tempfile.TemporaryDirectory() as out_dir:
+				hlsl = generate(generator, out_dir, "Golden.hlsl")
+				weights = read_inline_weights(hlsl) if inline_weights else read_buffers(generator, out_dir)
+			actual = ShaderEmulator(generator, weights).run(image)
+			np.testing.assert_allclose(actual, expected, rtol=0, atol=1e-5)
+
+
+class GoldenTest(unittest.TestCase):
+	def test_golden_output(self):
+		for file_name, block_size, num_threads, fuse, inline_weights in GOLDEN_VARIANTS:
+			with self.subTest(file_name=file_name):
+				generator = main.Generator(load_golden_network(), block_size, num_threads, fuse, inline_weights)
+				with tempfile.TemporaryDirectory() as out_dir:
+					generate(generator, out_dir, file_name)
+					outputs = [file_name] + [buffer_name for buffer_name, _ in generator.buffers]
+					for output in outputs:
+						with open(os.path.join(out_dir, output), "rb") as f:
+							actual = f.read()
+						with open(os.path.join(TESTDATA_DIR, output), "rb") as f:
+							expected = f.read()
+						self.assertEqual(actual, expected, f"{output} 和已知输出不同")
+
+
+def update_golden():
+	for file_name, block_size, num_threads, fuse, inline_weights in GOLDEN_VARIANTS:
+		generator = main.Generator(load_golden_network(), block_size, num_threads, fuse, inline_weights)
+		generator.generate(os.path.join(TESTDATA_DIR, file_name))
+		print(f"已生成 {file_name}")
+
+
+if __name__ == "__main__":
+	if "--update" in sys.argv:
+		update_golden()
+	else:
+		unittest.main()
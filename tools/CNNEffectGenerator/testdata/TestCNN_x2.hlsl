@@ -0,0 +1,243 @@
+// TestCNN_x2
+// CNNEffectGenerator 的测试网络
+// 由 tools/CNNEffectGenerator 生成
+
+//!MAGPIE EFFECT
+//!VERSION 2
+//!OUTPUT_WIDTH INPUT_WIDTH * 2
+//!OUTPUT_HEIGHT INPUT_HEIGHT * 2
+
+
+//!TEXTURE
+Texture2D INPUT;
+
+//!SAMPLER
+//!FILTER POINT
+SamplerState sam;
+
+//!SAMPLER
+//!FILTER LINEAR
+SamplerState sam1;
+
+//!TEXTURE
+//!WIDTH INPUT_WIDTH
+//!HEIGHT INPUT_HEIGHT
+//!FORMAT R16G16B16A16_FLOAT
+Texture2D tex1;
+
+//!TEXTURE
+//!WIDTH INPUT_WIDTH
+//!HEIGHT INPUT_HEIGHT
+//!FORMAT R16G16B16A16_FLOAT
+Texture2D tex2;
+
+//!BUFFER
+//!SOURCE TestCNN_x2_Weights1.bin
+float4 weights1[364];
+
+//!BUFFER
+//!SOURCE TestCNN_x2_Weights2.bin
+float4 weights2[219];
+
+
+
+//!PASS 1
+//!DESC Conv-5x3x3x3, Conv-6x3x3x10
+//!IN INPUT
+//!OUT tex1, tex2
+//!BLOCK_SIZE 8
+//!NUM_THREADS 64
+
+#define TILE_SIZE MP_BLOCK_WIDTH
+#define SH_SIZE0 (TILE_SIZE + 4)
+#define SH_SIZE1 (TILE_SIZE + 2)
+
+groupshared float4 sh0[1][SH_SIZE0][SH_SIZE0];
+groupshared float4 sh1[2][SH_SIZE1][SH_SIZE1];
+
+void Pass1(uint2 blockStart, uint3 threadId) {
+	const float2 inputPt = GetInputPt();
+	const uint2 inputSize = GetInputSize();
+	const uint2 tileStart = blockStart;
+
+	// 协作加载包含 2 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE0 * SH_SIZE0; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE0, k / SH_SIZE0);
+		const float2 tpos = (int2(tileStart + shPos) - 2 + 0.5f) * inputPt;
+		sh0[0][shPos.y][shPos.x] = INPUT.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	for (uint k = threadId.x; k < SH_SIZE1 * SH_SIZE1; k += MP_NUM_THREADS_X) {
+		const uint2 dstPos = uint2(k % SH_SIZE1, k / SH_SIZE1);
+		const int2 srcPos = clamp(int2(tileStart + dstPos) - 1, 0, int2(inputSize) - 1);
+		const uint2 localPos = uint2(srcPos - int2(tileStart)) + 1;
+
+		// Conv-5x3x3x3
+		float4 src[1][3][3];
+		[unroll]
+		for (uint i = 0; i < 1; ++i) {
+			[unroll]
+			for (uint y = 0; y < 3; ++y) {
+				[unroll]
+				for (uint x = 0; x < 3; ++x) {
+					src[i][y][x] = sh0[i][localPos.y + y][localPos.x + x];
+				}
+			}
+		}
+
+		float4 target[2];
+		[unroll]
+		for (uint o = 0; o < 2; ++o) {
+			uint w = 0 + o * 37;
+			target[o] = weights1[w++];
+			[unroll]
+			for (uint i = 0; i < 1; ++i) {
+				[unroll]
+				for (uint y = 0; y < 3; ++y) {
+					[unroll]
+					for (uint x = 0; x < 3; ++x) {
+						target[o] += mul(src[i][y][x], float4x4(weights1[w], weights1[w + 1], weights1[w + 2], weights1[w + 3]));
+						w += 4;
+					}
+				}
+			}
+		}
+
+		[unroll]
+		for (uint i = 0; i < 2; ++i) {
+			sh1[i][dstPos.y][dstPos.x] = target[i];
+		}
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	for (uint k = threadId.x; k < TILE_SIZE * TILE_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 localPos = uint2(k % TILE_SIZE, k / TILE_SIZE);
+		const uint2 gxy = tileStart + localPos;
+		if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
+			continue;
+		}
+
+		// Conv-6x3x3x10
+		float4 src[2][3][3];
+		[unroll]
+		for (uint i = 0; i < 2; ++i) {
+			[unroll]
+			for (uint y = 0; y < 3; ++y) {
+				[unroll]
+				for (uint x = 0; x < 3; ++x) {
+					src[i][y][x] = sh1[i][localPos.y + y][localPos.x + x];
+				}
+			}
+		}
+
+		float4 target[2];
+		[unroll]
+		for (uint o = 0; o < 2; ++o) {
+			uint w = 74 + o * 145;
+			target[o] = weights1[w++];
+			[unroll]
+			for (uint i = 0; i < 2; ++i) {
+				[unroll]
+				for (uint y = 0; y < 3; ++y) {
+					[unroll]
+					for (uint x = 0; x < 3; ++x) {
+						target[o] += mul(max(src[i][y][x], 0), float4x4(weights1[w], weights1[w + 1], weights1[w + 2], weights1[w + 3]));
+						w += 4;
+						target[o] += mul(max(-src[i][y][x], 0), float4x4(weights1[w], weights1[w + 1], weights1[w + 2], weights1[w + 3]));
+						w += 4;
+					}
+				}
+			}
+		}
+
+		tex1[gxy] = target[0];
+		tex2[gxy] = target[1];
+	}
+}
+
+//!PASS 2
+//!DESC Conv-12x3x3x6, Depth-to-Space
+//!IN tex1, tex2
+//!BLOCK_SIZE 16
+//!NUM_THREADS 64
+
+#define TILE_SIZE (MP_BLOCK_WIDTH / 2)
+#define SH_SIZE0 (TILE_SIZE + 2)
+
+groupshared float4 sh0[2][SH_SIZE0][SH_SIZE0];
+
+void Pass2(uint2 blockStart, uint3 threadId) {
+	const float2 inputPt = GetInputPt();
+	const uint2 inputSize = GetInputSize();
+	const uint2 tileStart = blockStart / 2;
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE0 * SH_SIZE0; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE0, k / SH_SIZE0);
+		const float2 tpos = (int2(tileStart + shPos) - 1 + 0.5f) * inputPt;
+		sh0[0][shPos.y][shPos.x] = tex1.SampleLevel(sam, tpos, 0);
+		sh0[1][shPos.y][shPos.x] = tex2.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	for (uint k = threadId.x; k < TILE_SIZE * TILE_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 localPos = uint2(k % TILE_SIZE, k / TILE_SIZE);
+		const uint2 gxy = tileStart + localPos;
+		if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
+			continue;
+		}
+
+		// Conv-12x3x3x6
+		float4 src[2][3][3];
+		[unroll]
+		for (uint i = 0; i < 2; ++i) {
+			[unroll]
+			for (uint y = 0; y < 3; ++y) {
+				[unroll]
+				for (uint x = 0; x < 3; ++x) {
+					src[i][y][x] = sh0[i][localPos.y + y][localPos.x + x];
+				}
+			}
+		}
+
+		float4 target[3];
+		[unroll]
+		for (uint o = 0; o < 3; ++o) {
+			uint w = 0 + o * 73;
+			target[o] = weights2[w++];
+			[unroll]
+			for (uint i = 0; i < 2; ++i) {
+				[unroll]
+				for (uint y = 0; y < 3; ++y) {
+					[unroll]
+					for (uint x = 0; x < 3; ++x) {
+						target[o] += mul(max(src[i][y][x], 0), float4x4(weights2[w], weights2[w + 1], weights2[w + 2], weights2[w + 3]));
+						w += 4;
+					}
+				}
+			}
+		}
+
+		const float2 outputPt = GetOutputPt();
+		const uint2 outPos00 = gxy * 2 + uint2(0, 0);
+		if (CheckViewport(outPos00)) {
+			WriteToOutput(outPos00, float3(target[0].x, target[1].x, target[2].x) + INPUT.SampleLevel(sam1, (outPos00 + 0.5f) * outputPt, 0).rgb);
+		}
+		const uint2 outPos01 = gxy * 2 + uint2(1, 0);
+		if (CheckViewport(outPos01)) {
+			WriteToOutput(outPos01, float3(target[0].y, target[1].y, target[2].y) + INPUT.SampleLevel(sam1, (outPos01 + 0.5f) * outputPt, 0).rgb);
+		}
+		const uint2 outPos10 = gxy * 2 + uint2(0, 1);
+		if (CheckViewport(outPos10)) {
+			WriteToOutput(outPos10, float3(target[0].z, target[1].z, target[2].z) + INPUT.SampleLevel(sam1, (outPos10 + 0.5f) * outputPt, 0).rgb);
+		}
+		const uint2 outPos11 = gxy * 2 + uint2(1, 1);
+		if (CheckViewport(outPos11)) {
+			WriteToOutput(outPos11, float3(target[0].w, target[1].w, target[2].w) + INPUT.SampleLevel(sam1, (outPos11 + 0.5f) * outputPt, 0).rgb);
+		}
+	}
+}
@@ -0,0 +1,863 @@
+// TestCNN_x2
+// CNNEffectGenerator 的测试网络
+// 由 tools/CNNEffectGenerator 生成
+
+//!MAGPIE EFFECT
+//!VERSION 2
+//!OUTPUT_WIDTH INPUT_WIDTH * 2
+//!OUTPUT_HEIGHT INPUT_HEIGHT * 2
+
+
+//!TEXTURE
+Texture2D INPUT;
+
+//!SAMPLER
+//!FILTER POINT
+SamplerState sam;
+
+//!SAMPLER
+//!FILTER LINEAR
+SamplerState sam1;
+
+//!TEXTURE
+//!WIDTH INPUT_WIDTH
+//!HEIGHT INPUT_HEIGHT
+//!FORMAT R16G16B16A16_FLOAT
+Texture2D tex1;
+
+//!TEXTURE
+//!WIDTH INPUT_WIDTH
+//!HEIGHT INPUT_HEIGHT
+//!FORMAT R16G16B16A16_FLOAT
+Texture2D tex2;
+
+//!TEXTURE
+//!WIDTH INPUT_WIDTH
+//!HEIGHT INPUT_HEIGHT
+//!FORMAT R16G16B16A16_FLOAT
+Texture2D tex3;
+
+//!TEXTURE
+//!WIDTH INPUT_WIDTH
+//!HEIGHT INPUT_HEIGHT
+//!FORMAT R16G16B16A16_FLOAT
+Texture2D tex4;
+
+
+
+//!PASS 1
+//!DESC Conv-5x3x3x3
+//!IN INPUT
+//!OUT tex1, tex2
+//!BLOCK_SIZE 8
+//!NUM_THREADS 64
+
+static const float4 weights1[74] = {
+	float4(0.0825000033, -0.0775000006, 0.0149999997, 0.107500002),
+	float4(-0.0324999988, -0.0599999987, -0.0874999985, -0.115000002),
+	float4(0.0425000004, 0.0149999997, -0.0125000002, -0.0399999991),
+	float4(0.1175, 0.0900000036, 0.0625, 0.0350000001),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0599999987, 0.0324999988, 0.00499999989, -0.0225000009),
+	float4(-0.1175, 0.107500002, 0.0799999982, 0.0524999984),
+	float4(-0.0425000004, -0.0700000003, -0.0974999964, -0.125),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.100000001, 0.125, 0.0974999964, 0.0700000003),
+	float4(-0.0250000004, -0.0524999984, -0.0799999982, -0.107500002),
+	float4(0.0500000007, 0.0225000009, -0.00499999989, -0.0324999988),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.00749999983, -0.0350000001, -0.0625, -0.0900000036),
+	float4(0.0675000027, 0.0399999991, 0.0125000002, -0.0149999997),
+	float4(-0.109999999, 0.115000002, 0.0874999985, 0.0599999987),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0850000009, 0.057500001, 0.0299999993, 0.00249999994),
+	float4(-0.0925000012, -0.119999997, 0.104999997, 0.0775000006),
+	float4(-0.0175000001, -0.0450000018, -0.0724999979, -0.100000001),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.075000003, -0.102499999, 0.122500002, 0.0949999988),
+	float4(0.0, -0.0274999999, -0.0549999997, -0.0825000033),
+	float4(0.075000003, 0.0474999994, 0.0199999996, -0.00749999983),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0175000001, -0.00999999978, -0.0375000015, -0.0649999976),
+	float4(0.0925000012, 0.0649999976, 0.0375000015, 0.00999999978),
+	float4(-0.0850000009, -0.112499997, 0.112499997, 0.0850000009),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.109999999, 0.0825000033, 0.0549999997, 0.0274999999),
+	float4(-0.0675000027, -0.0949999988, -0.122500002, 0.102499999),
+	float4(0.00749999983, -0.0199999996, -0.0474999994, -0.075000003),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0500000007, -0.0775000006, -0.104999997, 0.119999997),
+	float4(0.0250000004, -0.00249999994, -0.0299999993, -0.057500001),
+	float4(0.100000001, 0.0724999979, 0.0450000018, 0.0175000001),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0524999984, 0.0, 0.0, 0.0),
+	float4(0.109999999, 0.0, 0.0, 0.0),
+	float4(-0.0675000027, 0.0, 0.0, 0.0),
+	float4(0.00749999983, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0500000007, 0.0, 0.0, 0.0),
+	float4(0.0250000004, 0.0, 0.0, 0.0),
+	float4(0.100000001, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0425000004, 0.0, 0.0, 0.0),
+	float4(0.1175, 0.0, 0.0, 0.0),
+	float4(-0.0599999987, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.1175, 0.0, 0.0, 0.0),
+	float4(-0.0425000004, 0.0, 0.0, 0.0),
+	float4(0.0324999988, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0250000004, 0.0, 0.0, 0.0),
+	float4(0.0500000007, 0.0, 0.0, 0.0),
+	float4(0.125, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0675000027, 0.0, 0.0, 0.0),
+	float4(-0.109999999, 0.0, 0.0, 0.0),
+	float4(-0.0350000001, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0925000012, 0.0, 0.0, 0.0),
+	float4(-0.0175000001, 0.0, 0.0, 0.0),
+	float4(0.057500001, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.075000003, 0.0, 0.0, 0.0),
+	float4(-0.102499999, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0925000012, 0.0, 0.0, 0.0),
+	float4(-0.0850000009, 0.0, 0.0, 0.0),
+	float4(-0.00999999978, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+};
+
+#define TILE_SIZE MP_BLOCK_WIDTH
+#define SH_SIZE0 (TILE_SIZE + 2)
+
+groupshared float4 sh0[1][SH_SIZE0][SH_SIZE0];
+
+void Pass1(uint2 blockStart, uint3 threadId) {
+	const float2 inputPt = GetInputPt();
+	const uint2 inputSize = GetInputSize();
+	const uint2 tileStart = blockStart;
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE0 * SH_SIZE0; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE0, k / SH_SIZE0);
+		const float2 tpos = (int2(tileStart + shPos) - 1 + 0.5f) * inputPt;
+		sh0[0][shPos.y][shPos.x] = INPUT.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	for (uint k = threadId.x; k < TILE_SIZE * TILE_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 localPos = uint2(k % TILE_SIZE, k / TILE_SIZE);
+		const uint2 gxy = tileStart + localPos;
+		if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
+			continue;
+		}
+
+		// Conv-5x3x3x3
+		float4 src[1][3][3];
+		[unroll]
+		for (uint i = 0; i < 1; ++i) {
+			[unroll]
+			for (uint y = 0; y < 3; ++y) {
+				[unroll]
+				for (uint x = 0; x < 3; ++x) {
+					src[i][y][x] = sh0[i][localPos.y + y][localPos.x + x];
+				}
+			}
+		}
+
+		float4 target[2];
+		[unroll]
+		for (uint o = 0; o < 2; ++o) {
+			uint w = 0 + o * 37;
+			target[o] = weights1[w++];
+			[unroll]
+			for (uint i = 0; i < 1; ++i) {
+				[unroll]
+				for (uint y = 0; y < 3; ++y) {
+					[unroll]
+					for (uint x = 0; x < 3; ++x) {
+						target[o] += mul(src[i][y][x], float4x4(weights1[w], weights1[w + 1], weights1[w + 2], weights1[w + 3]));
+						w += 4;
+					}
+				}
+			}
+		}
+
+		tex1[gxy] = target[0];
+		tex2[gxy] = target[1];
+	}
+}
+
+//!PASS 2
+//!DESC Conv-6x3x3x10
+//!IN tex1, tex2
+//!OUT tex3, tex4
+//!BLOCK_SIZE 8
+//!NUM_THREADS 64
+
+static const float4 weights2[290] = {
+	float4(-0.00499999989, 0.0874999985, -0.0724999979, 0.0199999996),
+	float4(0.0399999991, 0.0324999988, 0.0250000004, 0.0175000001),
+	float4(0.115000002, 0.107500002, 0.100000001, 0.0925000012),
+	float4(-0.0625, -0.0700000003, -0.0775000006, -0.0850000009),
+	float4(0.0125000002, 0.00499999989, -0.00249999994, -0.00999999978),
+	float4(-0.0900000036, -0.0974999964, -0.104999997, -0.112499997),
+	float4(-0.0149999997, -0.0225000009, -0.0299999993, -0.0375000015),
+	float4(0.0599999987, 0.0524999984, 0.0450000018, 0.0375000015),
+	float4(-0.1175, -0.125, 0.119999997, 0.112499997),
+	float4(-0.119999997, 0.125, 0.1175, 0.109999999),
+	float4(-0.0450000018, -0.0524999984, -0.0599999987, -0.0675000027),
+	float4(0.0299999993, 0.0225000009, 0.0149999997, 0.00749999983),
+	float4(0.104999997, 0.0974999964, 0.0900000036, 0.0825000033),
+	float4(0.00249999994, -0.00499999989, -0.0125000002, -0.0199999996),
+	float4(0.0775000006, 0.0700000003, 0.0625, 0.0549999997),
+	float4(-0.100000001, -0.107500002, -0.115000002, -0.122500002),
+	float4(-0.0250000004, -0.0324999988, -0.0399999991, -0.0474999994),
+	float4(-0.0274999999, -0.0350000001, -0.0425000004, -0.0500000007),
+	float4(0.0474999994, 0.0399999991, 0.0324999988, 0.0250000004),
+	float4(0.122500002, 0.115000002, 0.107500002, 0.100000001),
+	float4(-0.0549999997, -0.0625, -0.0700000003, -0.0775000006),
+	float4(0.0949999988, 0.0874999985, 0.0799999982, 0.0724999979),
+	float4(-0.0825000033, -0.0900000036, -0.0974999964, -0.104999997),
+	float4(-0.00749999983, -0.0149999997, -0.0225000009, -0.0299999993),
+	float4(0.0675000027, 0.0599999987, 0.0524999984, 0.0450000018),
+	float4(0.0649999976, 0.057500001, 0.0500000007, 0.0425000004),
+	float4(-0.112499997, -0.119999997, 0.125, 0.1175),
+	float4(-0.0375000015, -0.0450000018, -0.0524999984, -0.0599999987),
+	float4(0.0375000015, 0.0299999993, 0.0225000009, 0.0149999997),
+	float4(-0.0649999976, -0.0724999979, -0.0799999982, -0.0874999985),
+	float4(0.00999999978, 0.00249999994, -0.00499999989, -0.0125000002),
+	float4(0.0850000009, 0.0775000006, 0.0700000003, 0.0625),
+	float4(-0.0925000012, -0.100000001, -0.107500002, -0.115000002),
+	float4(-0.0949999988, -0.102499999, -0.109999999, -0.1175),
+	float4(-0.0199999996, -0.0274999999, -0.0350000001, -0.0425000004),
+	float4(0.0549999997, 0.0474999994, 0.0399999991, 0.0324999988),
+	float4(-0.122500002, 0.122500002, 0.115000002, 0.107500002),
+	float4(0.0274999999, 0.0199999996, 0.0125000002, 0.00499999989),
+	float4(0.102499999, 0.0949999988, 0.0874999985, 0.0799999982),
+	float4(-0.075000003, -0.0825000033, -0.0900000036, -0.0974999964),
+	float4(0.0, -0.00749999983, -0.0149999997, -0.0225000009),
+	float4(-0.00249999994, -0.00999999978, -0.0175000001, -0.0250000004),
+	float4(0.0724999979, 0.0649999976, 0.057500001, 0.0500000007),
+	float4(-0.104999997, -0.112499997, -0.119999997, 0.125),
+	float4(-0.0299999993, -0.0375000015, -0.0450000018, -0.0524999984),
+	float4(0.119999997, 0.112499997, 0.104999997, 0.0974999964),
+	float4(-0.057500001, -0.0649999976, -0.0724999979, -0.0799999982),
+	float4(0.0175000001, 0.00999999978, 0.00249999994, -0.00499999989),
+	float4(0.0925000012, 0.0850000009, 0.0775000006, 0.0700000003),
+	float4(0.0900000036, 0.0825000033, 0.075000003, 0.0675000027),
+	float4(-0.0874999985, -0.0949999988, -0.102499999, -0.109999999),
+	float4(-0.0125000002, -0.0199999996, -0.0274999999, -0.0350000001),
+	float4(0.0625, 0.0549999997, 0.0474999994, 0.0399999991),
+	float4(-0.0399999991, -0.0474999994, -0.0549999997, -0.0625),
+	float4(0.0350000001, 0.0274999999, 0.0199999996, 0.0125000002),
+	float4(0.109999999, 0.102499999, 0.0949999988, 0.0874999985),
+	float4(-0.0675000027, -0.075000003, -0.0825000033, -0.0900000036),
+	float4(-0.0700000003, -0.0775000006, -0.0850000009, -0.0925000012),
+	float4(0.00499999989, -0.00249999994, -0.00999999978, -0.0175000001),
+	float4(0.0799999982, 0.0724999979, 0.0649999976, 0.057500001),
+	float4(-0.0974999964, -0.104999997, -0.112499997, -0.119999997),
+	float4(0.0524999984, 0.0450000018, 0.0375000015, 0.0299999993),
+	float4(-0.125, 0.119999997, 0.112499997, 0.104999997),
+	float4(-0.0500000007, -0.057500001, -0.0649999976, -0.0724999979),
+	float4(0.0250000004, 0.0175000001, 0.00999999978, 0.00249999994),
+	float4(0.0225000009, 0.0149999997, 0.00749999983, 0.0),
+	float4(0.0974999964, 0.0900000036, 0.0825000033, 0.075000003),
+	float4(-0.0799999982, -0.0874999985, -0.0949999988, -0.102499999),
+	float4(-0.00499999989, -0.0125000002, -0.0199999996, -0.0274999999),
+	float4(-0.107500002, -0.115000002, -0.122500002, 0.122500002),
+	float4(-0.0324999988, -0.0399999991, -0.0474999994, -0.0549999997),
+	float4(0.0425000004, 0.0350000001, 0.0274999999, 0.0199999996),
+	float4(0.1175, 0.109999999, 0.102499999, 0.0949999988),
+	float4(0.0874999985, 0.0799999982, 0.0724999979, 0.0649999976),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0425000004, -0.0500000007, -0.057500001, -0.0649999976),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0724999979, -0.0799999982, -0.0874999985, -0.0949999988),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0500000007, 0.0425000004, 0.0350000001, 0.0274999999),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0199999996, 0.0125000002, 0.00499999989, -0.00249999994),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.109999999, -0.1175, -0.125, 0.119999997),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.112499997, 0.104999997, 0.0974999964, 0.0900000036),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0175000001, -0.0250000004, -0.0324999988, -0.0399999991),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0474999994, -0.0549999997, -0.0625, -0.0700000003),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.075000003, 0.0675000027, 0.0599999987, 0.0524999984),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0450000018, 0.0375000015, 0.0299999993, 0.0225000009),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0850000009, -0.0925000012, -0.100000001, -0.107500002),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.115000002, -0.122500002, 0.122500002, 0.115000002),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.00749999983, 0.0, -0.00749999983, -0.0149999997),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0225000009, -0.0299999993, -0.0375000015, -0.0450000018),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.100000001, 0.0925000012, 0.0850000009, 0.0775000006),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0700000003, 0.0625, 0.0549999997, 0.0474999994),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0599999987, -0.0675000027, -0.075000003, -0.0825000033),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.112499997, -0.0474999994, 0.0, 0.0),
+	float4(0.00999999978, 0.00249999994, 0.0, 0.0),
+	float4(0.0850000009, 0.0775000006, 0.0, 0.0),
+	float4(-0.0925000012, -0.100000001, 0.0, 0.0),
+	float4(-0.0175000001, -0.0250000004, 0.0, 0.0),
+	float4(-0.119999997, 0.125, 0.0, 0.0),
+	float4(-0.0450000018, -0.0524999984, 0.0, 0.0),
+	float4(0.0299999993, 0.0225000009, 0.0, 0.0),
+	float4(0.104999997, 0.0974999964, 0.0, 0.0),
+	float4(0.102499999, 0.0949999988, 0.0, 0.0),
+	float4(-0.075000003, -0.0825000033, 0.0, 0.0),
+	float4(0.0, -0.00749999983, 0.0, 0.0),
+	float4(0.075000003, 0.0675000027, 0.0, 0.0),
+	float4(-0.0274999999, -0.0350000001, 0.0, 0.0),
+	float4(0.0474999994, 0.0399999991, 0.0, 0.0),
+	float4(0.122500002, 0.115000002, 0.0, 0.0),
+	float4(-0.0549999997, -0.0625, 0.0, 0.0),
+	float4(-0.057500001, -0.0649999976, 0.0, 0.0),
+	float4(0.0175000001, 0.00999999978, 0.0, 0.0),
+	float4(0.0925000012, 0.0850000009, 0.0, 0.0),
+	float4(-0.0850000009, -0.0925000012, 0.0, 0.0),
+	float4(0.0649999976, 0.057500001, 0.0, 0.0),
+	float4(-0.112499997, -0.119999997, 0.0, 0.0),
+	float4(-0.0375000015, -0.0450000018, 0.0, 0.0),
+	float4(0.0375000015, 0.0299999993, 0.0, 0.0),
+	float4(0.0350000001, 0.0274999999, 0.0, 0.0),
+	float4(0.109999999, 0.102499999, 0.0, 0.0),
+	float4(-0.0675000027, -0.075000003, 0.0, 0.0),
+	float4(0.00749999983, 0.0, 0.0, 0.0),
+	float4(-0.0949999988, -0.102499999, 0.0, 0.0),
+	float4(-0.0199999996, -0.0274999999, 0.0, 0.0),
+	float4(0.0549999997, 0.0474999994, 0.0, 0.0),
+	float4(-0.122500002, 0.122500002, 0.0, 0.0),
+	float4(-0.125, 0.119999997, 0.0, 0.0),
+	float4(-0.0500000007, -0.057500001, 0.0, 0.0),
+	float4(0.0250000004, 0.0175000001, 0.0, 0.0),
+	float4(0.100000001, 0.0925000012, 0.0, 0.0),
+	float4(-0.00249999994, -0.00999999978, 0.0, 0.0),
+	float4(0.0724999979, 0.0649999976, 0.0, 0.0),
+	float4(-0.104999997, -0.112499997, 0.0, 0.0),
+	float4(-0.0299999993, -0.0375000015, 0.0, 0.0),
+	float4(-0.0324999988, -0.0399999991, 0.0, 0.0),
+	float4(0.0425000004, 0.0350000001, 0.0, 0.0),
+	float4(0.1175, 0.109999999, 0.0, 0.0),
+	float4(-0.0599999987, -0.0675000027, 0.0, 0.0),
+	float4(0.0900000036, 0.0825000033, 0.0, 0.0),
+	float4(-0.0874999985, -0.0949999988, 0.0, 0.0),
+	float4(-0.0125000002, -0.0199999996, 0.0, 0.0),
+	float4(0.0625, 0.0549999997, 0.0, 0.0),
+	float4(0.0599999987, 0.0524999984, 0.0, 0.0),
+	float4(-0.1175, -0.125, 0.0, 0.0),
+	float4(-0.0425000004, -0.0500000007, 0.0, 0.0),
+	float4(0.0324999988, 0.0250000004, 0.0, 0.0),
+	float4(-0.0700000003, -0.0775000006, 0.0, 0.0),
+	float4(0.00499999989, -0.00249999994, 0.0, 0.0),
+	float4(0.0799999982, 0.0724999979, 0.0, 0.0),
+	float4(-0.0974999964, -0.104999997, 0.0, 0.0),
+	float4(-0.100000001, -0.107500002, 0.0, 0.0),
+	float4(-0.0250000004, -0.0324999988, 0.0, 0.0),
+	float4(0.0500000007, 0.0425000004, 0.0, 0.0),
+	float4(0.125, 0.1175, 0.0, 0.0),
+	float4(0.0225000009, 0.0149999997, 0.0, 0.0),
+	float4(0.0974999964, 0.0900000036, 0.0, 0.0),
+	float4(-0.0799999982, -0.0874999985, 0.0, 0.0),
+	float4(-0.00499999989, -0.0125000002, 0.0, 0.0),
+	float4(-0.00749999983, -0.0149999997, 0.0, 0.0),
+	float4(0.0675000027, 0.0599999987, 0.0, 0.0),
+	float4(-0.109999999, -0.1175, 0.0, 0.0),
+	float4(-0.0350000001, -0.0425000004, 0.0, 0.0),
+	float4(0.115000002, 0.107500002, 0.0, 0.0),
+	float4(-0.0625, -0.0700000003, 0.0, 0.0),
+	float4(0.0125000002, 0.00499999989, 0.0, 0.0),
+	float4(0.0874999985, 0.0799999982, 0.0, 0.0),
+	float4(0.057500001, 0.0500000007, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0724999979, -0.0799999982, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.102499999, -0.109999999, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0199999996, 0.0125000002, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.00999999978, -0.0175000001, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.112499997, 0.104999997, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0825000033, 0.075000003, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0474999994, -0.0549999997, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0775000006, -0.0850000009, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0450000018, 0.0375000015, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0149999997, 0.00749999983, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.115000002, -0.122500002, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.107500002, 0.100000001, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0225000009, -0.0299999993, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0524999984, -0.0599999987, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0700000003, 0.0625, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0399999991, 0.0324999988, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0900000036, -0.0974999964, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+};
+
+#define TILE_SIZE MP_BLOCK_WIDTH
+#define SH_SIZE0 (TILE_SIZE + 2)
+
+groupshared float4 sh0[2][SH_SIZE0][SH_SIZE0];
+
+void Pass2(uint2 blockStart, uint3 threadId) {
+	const float2 inputPt = GetInputPt();
+	const uint2 inputSize = GetInputSize();
+	const uint2 tileStart = blockStart;
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE0 * SH_SIZE0; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE0, k / SH_SIZE0);
+		const float2 tpos = (int2(tileStart + shPos) - 1 + 0.5f) * inputPt;
+		sh0[0][shPos.y][shPos.x] = tex1.SampleLevel(sam, tpos, 0);
+		sh0[1][shPos.y][shPos.x] = tex2.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	for (uint k = threadId.x; k < TILE_SIZE * TILE_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 localPos = uint2(k % TILE_SIZE, k / TILE_SIZE);
+		const uint2 gxy = tileStart + localPos;
+		if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
+			continue;
+		}
+
+		// Conv-6x3x3x10
+		float4 src[2][3][3];
+		[unroll]
+		for (uint i = 0; i < 2; ++i) {
+			[unroll]
+			for (uint y = 0; y < 3; ++y) {
+				[unroll]
+				for (uint x = 0; x < 3; ++x) {
+					src[i][y][x] = sh0[i][localPos.y + y][localPos.x + x];
+				}
+			}
+		}
+
+		float4 target[2];
+		[unroll]
+		for (uint o = 0; o < 2; ++o) {
+			uint w = 0 + o * 145;
+			target[o] = weights2[w++];
+			[unroll]
+			for (uint i = 0; i < 2; ++i) {
+				[unroll]
+				for (uint y = 0; y < 3; ++y) {
+					[unroll]
+					for (uint x = 0; x < 3; ++x) {
+						target[o] += mul(max(src[i][y][x], 0), float4x4(weights2[w], weights2[w + 1], weights2[w + 2], weights2[w + 3]));
+						w += 4;
+						target[o] += mul(max(-src[i][y][x], 0), float4x4(weights2[w], weights2[w + 1], weights2[w + 2], weights2[w + 3]));
+						w += 4;
+					}
+				}
+			}
+		}
+
+		tex3[gxy] = target[0];
+		tex4[gxy] = target[1];
+	}
+}
+
+//!PASS 3
+//!DESC Conv-12x3x3x6, Depth-to-Space
+//!IN tex3, tex4
+//!BLOCK_SIZE 16
+//!NUM_THREADS 64
+
+static const float4 weights3[219] = {
+	float4(-0.109999999, -0.0175000001, 0.075000003, -0.0850000009),
+	float4(0.0450000018, -0.00999999978, -0.0649999976, -0.119999997),
+	float4(0.119999997, 0.0649999976, 0.00999999978, -0.0450000018),
+	float4(-0.057500001, -0.112499997, 0.0850000009, 0.0299999993),
+	float4(0.0175000001, -0.0375000015, -0.0925000012, 0.104999997),
+	float4(-0.115000002, 0.0825000033, 0.0274999999, -0.0274999999),
+	float4(-0.0399999991, -0.0949999988, 0.102499999, 0.0474999994),
+	float4(0.0350000001, -0.0199999996, -0.075000003, 0.122500002),
+	float4(0.109999999, 0.0549999997, 0.0, -0.0549999997),
+	float4(-0.0225000009, -0.0775000006, 0.119999997, 0.0649999976),
+	float4(0.0524999984, -0.00249999994, -0.057500001, -0.112499997),
+	float4(-0.125, 0.0724999979, 0.0175000001, -0.0375000015),
+	float4(-0.0500000007, -0.104999997, 0.0925000012, 0.0375000015),
+	float4(0.0700000003, 0.0149999997, -0.0399999991, -0.0949999988),
+	float4(-0.107500002, 0.0900000036, 0.0350000001, -0.0199999996),
+	float4(-0.0324999988, -0.0874999985, 0.109999999, 0.0549999997),
+	float4(0.0425000004, -0.0125000002, -0.0675000027, -0.122500002),
+	float4(-0.0900000036, 0.107500002, 0.0524999984, -0.00249999994),
+	float4(-0.0149999997, -0.0700000003, -0.125, 0.0724999979),
+	float4(0.0599999987, 0.00499999989, -0.0500000007, -0.104999997),
+	float4(-0.1175, 0.0799999982, 0.0250000004, -0.0299999993),
+	float4(0.00249999994, -0.0524999984, -0.107500002, 0.0900000036),
+	float4(0.0775000006, 0.0225000009, -0.0324999988, -0.0874999985),
+	float4(-0.100000001, 0.0974999964, 0.0425000004, -0.0125000002),
+	float4(-0.0250000004, -0.0799999982, 0.1175, 0.0625),
+	float4(0.0949999988, 0.0399999991, -0.0149999997, -0.0700000003),
+	float4(-0.0825000033, 0.115000002, 0.0599999987, 0.00499999989),
+	float4(-0.00749999983, -0.0625, -0.1175, 0.0799999982),
+	float4(0.0675000027, 0.0125000002, -0.0425000004, -0.0974999964),
+	float4(-0.0649999976, -0.119999997, 0.0775000006, 0.0225000009),
+	float4(0.00999999978, -0.0450000018, -0.100000001, 0.0974999964),
+	float4(0.0850000009, 0.0299999993, -0.0250000004, -0.0799999982),
+	float4(-0.0925000012, 0.104999997, 0.0500000007, -0.00499999989),
+	float4(0.0274999999, -0.0274999999, -0.0825000033, 0.115000002),
+	float4(0.102499999, 0.0474999994, -0.00749999983, -0.0625),
+	float4(-0.075000003, 0.122500002, 0.0675000027, 0.0125000002),
+	float4(0.0, -0.0549999997, -0.109999999, 0.0874999985),
+	float4(0.0925000012, 0.0375000015, -0.0175000001, -0.0724999979),
+	float4(-0.0850000009, 0.112499997, 0.057500001, 0.00249999994),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0675000027, -0.122500002, 0.075000003, 0.0199999996),
+	float4(0.00749999983, -0.0474999994, -0.102499999, 0.0949999988),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0250000004, -0.0299999993, -0.0850000009, 0.112499997),
+	float4(0.100000001, 0.0450000018, -0.00999999978, -0.0649999976),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.1175, 0.0625, 0.00749999983, -0.0474999994),
+	float4(-0.0599999987, -0.115000002, 0.0825000033, 0.0274999999),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0425000004, -0.0974999964, 0.100000001, 0.0450000018),
+	float4(0.0324999988, -0.0225000009, -0.0775000006, 0.119999997),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0500000007, -0.00499999989, -0.0599999987, -0.115000002),
+	float4(0.125, 0.0700000003, 0.0149999997, -0.0399999991),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.109999999, 0.0874999985, 0.0324999988, -0.0225000009),
+	float4(-0.0350000001, -0.0900000036, 0.107500002, 0.0524999984),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0175000001, -0.0724999979, 0.125, 0.0700000003),
+	float4(0.057500001, 0.00249999994, -0.0524999984, -0.107500002),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.075000003, 0.0199999996, -0.0350000001, -0.0900000036),
+	float4(-0.102499999, 0.0949999988, 0.0399999991, -0.0149999997),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.00749999983, 0.100000001, -0.0599999987, 0.0324999988),
+	float4(0.0775000006, 0.0225000009, -0.0324999988, -0.0874999985),
+	float4(-0.100000001, 0.0974999964, 0.0425000004, -0.0125000002),
+	float4(-0.0250000004, -0.0799999982, 0.1175, 0.0625),
+	float4(0.0500000007, -0.00499999989, -0.0599999987, -0.115000002),
+	float4(-0.0825000033, 0.115000002, 0.0599999987, 0.00499999989),
+	float4(-0.00749999983, -0.0625, -0.1175, 0.0799999982),
+	float4(0.0675000027, 0.0125000002, -0.0425000004, -0.0974999964),
+	float4(-0.109999999, 0.0874999985, 0.0324999988, -0.0225000009),
+	float4(0.00999999978, -0.0450000018, -0.100000001, 0.0974999964),
+	float4(0.0850000009, 0.0299999993, -0.0250000004, -0.0799999982),
+	float4(-0.0925000012, 0.104999997, 0.0500000007, -0.00499999989),
+	float4(-0.0175000001, -0.0724999979, 0.125, 0.0700000003),
+	float4(0.102499999, 0.0474999994, -0.00749999983, -0.0625),
+	float4(-0.075000003, 0.122500002, 0.0675000027, 0.0125000002),
+	float4(0.0, -0.0549999997, -0.109999999, 0.0874999985),
+	float4(0.075000003, 0.0199999996, -0.0350000001, -0.0900000036),
+	float4(-0.057500001, -0.112499997, 0.0850000009, 0.0299999993),
+	float4(0.0175000001, -0.0375000015, -0.0925000012, 0.104999997),
+	float4(0.0925000012, 0.0375000015, -0.0175000001, -0.0724999979),
+	float4(-0.0850000009, 0.112499997, 0.057500001, 0.00249999994),
+	float4(0.0350000001, -0.0199999996, -0.075000003, 0.122500002),
+	float4(0.109999999, 0.0549999997, 0.0, -0.0549999997),
+	float4(-0.0675000027, -0.122500002, 0.075000003, 0.0199999996),
+	float4(0.00749999983, -0.0474999994, -0.102499999, 0.0949999988),
+	float4(-0.125, 0.0724999979, 0.0175000001, -0.0375000015),
+	float4(-0.0500000007, -0.104999997, 0.0925000012, 0.0375000015),
+	float4(0.0250000004, -0.0299999993, -0.0850000009, 0.112499997),
+	float4(0.100000001, 0.0450000018, -0.00999999978, -0.0649999976),
+	float4(-0.0324999988, -0.0874999985, 0.109999999, 0.0549999997),
+	float4(0.0425000004, -0.0125000002, -0.0675000027, -0.122500002),
+	float4(0.1175, 0.0625, 0.00749999983, -0.0474999994),
+	float4(-0.0599999987, -0.115000002, 0.0825000033, 0.0274999999),
+	float4(0.0599999987, 0.00499999989, -0.0500000007, -0.104999997),
+	float4(-0.1175, 0.0799999982, 0.0250000004, -0.0299999993),
+	float4(-0.0425000004, -0.0974999964, 0.100000001, 0.0450000018),
+	float4(0.0324999988, -0.0225000009, -0.0775000006, 0.119999997),
+	float4(0.125, 0.0700000003, 0.0149999997, -0.0399999991),
+	float4(-0.0524999984, -0.107500002, 0.0900000036, 0.0350000001),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0350000001, -0.0900000036, 0.107500002, 0.0524999984),
+	float4(0.0399999991, -0.0149999997, -0.0700000003, -0.125),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.057500001, 0.00249999994, -0.0524999984, -0.107500002),
+	float4(-0.119999997, 0.0775000006, 0.0225000009, -0.0324999988),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.102499999, 0.0949999988, 0.0399999991, -0.0149999997),
+	float4(-0.0274999999, -0.0825000033, 0.115000002, 0.0599999987),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.00999999978, -0.0649999976, -0.119999997, 0.0775000006),
+	float4(0.0649999976, 0.00999999978, -0.0450000018, -0.100000001),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0825000033, 0.0274999999, -0.0274999999, -0.0825000033),
+	float4(-0.0949999988, 0.102499999, 0.0474999994, -0.00749999983),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0775000006, 0.119999997, 0.0649999976, 0.00999999978),
+	float4(-0.00249999994, -0.057500001, -0.112499997, 0.0850000009),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0149999997, -0.0399999991, -0.0949999988, 0.102499999),
+	float4(0.0900000036, 0.0350000001, -0.0199999996, -0.075000003),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.107500002, 0.0524999984, -0.00249999994, -0.057500001),
+	float4(-0.0700000003, -0.125, 0.0724999979, 0.0175000001),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.125, -0.0350000001, 0.057500001, -0.102499999),
+	float4(0.109999999, 0.0549999997, 0.0, -0.0549999997),
+	float4(-0.0675000027, -0.122500002, 0.075000003, 0.0199999996),
+	float4(0.00749999983, -0.0474999994, -0.102499999, 0.0949999988),
+	float4(0.0825000033, 0.0274999999, -0.0274999999, -0.0825000033),
+	float4(-0.0500000007, -0.104999997, 0.0925000012, 0.0375000015),
+	float4(0.0250000004, -0.0299999993, -0.0850000009, 0.112499997),
+	float4(0.100000001, 0.0450000018, -0.00999999978, -0.0649999976),
+	float4(-0.0775000006, 0.119999997, 0.0649999976, 0.00999999978),
+	float4(0.0425000004, -0.0125000002, -0.0675000027, -0.122500002),
+	float4(0.1175, 0.0625, 0.00749999983, -0.0474999994),
+	float4(-0.0599999987, -0.115000002, 0.0825000033, 0.0274999999),
+	float4(0.0149999997, -0.0399999991, -0.0949999988, 0.102499999),
+	float4(-0.1175, 0.0799999982, 0.0250000004, -0.0299999993),
+	float4(-0.0425000004, -0.0974999964, 0.100000001, 0.0450000018),
+	float4(0.0324999988, -0.0225000009, -0.0775000006, 0.119999997),
+	float4(0.107500002, 0.0524999984, -0.00249999994, -0.057500001),
+	float4(-0.0250000004, -0.0799999982, 0.1175, 0.0625),
+	float4(0.0500000007, -0.00499999989, -0.0599999987, -0.115000002),
+	float4(0.125, 0.0700000003, 0.0149999997, -0.0399999991),
+	float4(-0.0524999984, -0.107500002, 0.0900000036, 0.0350000001),
+	float4(0.0675000027, 0.0125000002, -0.0425000004, -0.0974999964),
+	float4(-0.109999999, 0.0874999985, 0.0324999988, -0.0225000009),
+	float4(-0.0350000001, -0.0900000036, 0.107500002, 0.0524999984),
+	float4(0.0399999991, -0.0149999997, -0.0700000003, -0.125),
+	float4(-0.0925000012, 0.104999997, 0.0500000007, -0.00499999989),
+	float4(-0.0175000001, -0.0724999979, 0.125, 0.0700000003),
+	float4(0.057500001, 0.00249999994, -0.0524999984, -0.107500002),
+	float4(-0.119999997, 0.0775000006, 0.0225000009, -0.0324999988),
+	float4(0.0, -0.0549999997, -0.109999999, 0.0874999985),
+	float4(0.075000003, 0.0199999996, -0.0350000001, -0.0900000036),
+	float4(-0.102499999, 0.0949999988, 0.0399999991, -0.0149999997),
+	float4(-0.0274999999, -0.0825000033, 0.115000002, 0.0599999987),
+	float4(0.0925000012, 0.0375000015, -0.0175000001, -0.0724999979),
+	float4(-0.0850000009, 0.112499997, 0.057500001, 0.00249999994),
+	float4(-0.00999999978, -0.0649999976, -0.119999997, 0.0775000006),
+	float4(0.0649999976, 0.00999999978, -0.0450000018, -0.100000001),
+	float4(-0.0949999988, 0.102499999, 0.0474999994, -0.00749999983),
+	float4(-0.0199999996, -0.075000003, 0.122500002, 0.0675000027),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.00249999994, -0.057500001, -0.112499997, 0.0850000009),
+	float4(0.0724999979, 0.0175000001, -0.0375000015, -0.0925000012),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0900000036, 0.0350000001, -0.0199999996, -0.075000003),
+	float4(-0.0874999985, 0.109999999, 0.0549999997, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0700000003, -0.125, 0.0724999979, 0.0175000001),
+	float4(0.00499999989, -0.0500000007, -0.104999997, 0.0925000012),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0225000009, -0.0324999988, -0.0874999985, 0.109999999),
+	float4(0.0974999964, 0.0425000004, -0.0125000002, -0.0675000027),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.115000002, 0.0599999987, 0.00499999989, -0.0500000007),
+	float4(-0.0625, -0.1175, 0.0799999982, 0.0250000004),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.0450000018, -0.100000001, 0.0974999964, 0.0425000004),
+	float4(0.0299999993, -0.0250000004, -0.0799999982, 0.1175),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0474999994, -0.00749999983, -0.0625, -0.1175),
+	float4(0.122500002, 0.0675000027, 0.0125000002, -0.0425000004),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(-0.112499997, 0.0850000009, 0.0299999993, -0.0250000004),
+	float4(-0.0375000015, -0.0925000012, 0.104999997, 0.0500000007),
+	float4(0.0, 0.0, 0.0, 0.0),
+	float4(0.0, 0.0, 0.0, 0.0),
+};
+
+#define TILE_SIZE (MP_BLOCK_WIDTH / 2)
+#define SH_SIZE0 (TILE_SIZE + 2)
+
+groupshared float4 sh0[2][SH_SIZE0][SH_SIZE0];
+
+void Pass3(uint2 blockStart, uint3 threadId) {
+	const float2 inputPt = GetInputPt();
+	const uint2 inputSize = GetInputSize();
+	const uint2 tileStart = blockStart / 2;
+
+	// 协作加载包含 1 像素边框的区块，每个纹素只读取一次
+	for (uint k = threadId.x; k < SH_SIZE0 * SH_SIZE0; k += MP_NUM_THREADS_X) {
+		const uint2 shPos = uint2(k % SH_SIZE0, k / SH_SIZE0);
+		const float2 tpos = (int2(tileStart + shPos) - 1 + 0.5f) * inputPt;
+		sh0[0][shPos.y][shPos.x] = tex3.SampleLevel(sam, tpos, 0);
+		sh0[1][shPos.y][shPos.x] = tex4.SampleLevel(sam, tpos, 0);
+	}
+
+	GroupMemoryBarrierWithGroupSync();
+
+	for (uint k = threadId.x; k < TILE_SIZE * TILE_SIZE; k += MP_NUM_THREADS_X) {
+		const uint2 localPos = uint2(k % TILE_SIZE, k / TILE_SIZE);
+		const uint2 gxy = tileStart + localPos;
+		if (gxy.x >= inputSize.x || gxy.y >= inputSize.y) {
+			continue;
+		}
+
+		// Conv-12x3x3x6
+		float4 src[2][3][3];
+		[unroll]
+		for (uint i = 0; i < 2; ++i) {
+			[unroll]
+			for (uint y = 0; y < 3; ++y) {
+				[unroll]
+				for (uint x = 0; x < 3; ++x) {
+					src[i][y][x] = sh0[i][localPos.y + y][localPos.x + x];
+				}
+			}
+		}
+
+		float4 target[3];
+		[unroll]
+		for (uint o = 0; o < 3; ++o) {
+			uint w = 0 + o * 73;
+			target[o] = weights3[w++];
+			[unroll]
+			for (uint i = 0; i < 2; ++i) {
+				[unroll]
+				for (uint y = 0; y < 3; ++y) {
+					[unroll]
+					for (uint x = 0; x < 3; ++x) {
+						target[o] += mul(max(src[i][y][x], 0), float4x4(weights3[w], weights3[w + 1], weights3[w + 2], weights3[w + 3]));
+						w += 4;
+					}
+				}
+			}
+		}
+
+		const float2 outputPt = GetOutputPt();
+		const uint2 outPos00 = gxy * 2 + uint2(0, 0);
+		if (CheckViewport(outPos00)) {
+			WriteToOutput(outPos00, float3(target[0].x, target[1].x, target[2].x) + INPUT.SampleLevel(sam1, (outPos00 + 0.5f) * outputPt, 0).rgb);
+		}
+		const uint2 outPos01 = gxy * 2 + uint2(1, 0);
+		if (CheckViewport(outPos01)) {
+			WriteToOutput(outPos01, float3(target[0].y, target[1].y, target[2].y) + INPUT.SampleLevel(sam1, (outPos01 + 0.5f) * outputPt, 0).rgb);
+		}
+		const uint2 outPos10 = gxy * 2 + uint2(0, 1);
+		if (CheckViewport(outPos10)) {
+			WriteToOutput(outPos10, float3(target[0].z, target[1].z, target[2].z) + INPUT.SampleLevel(sam1, (outPos10 + 0.5f) * outputPt, 0).rgb);
+		}
+		const uint2 outPos11 = gxy * 2 + uint2(1, 1);
+		if (CheckViewport(outPos11)) {
+			WriteToOutput(outPos11, float3(target[0].w, target[1].w, target[2].w) + INPUT.SampleLevel(sam1, (outPos11 + 0.5f) * outputPt, 0).rgb);
+		}
+	}
+}
@@ -0,0 +1,61 @@
+#include "Common.h"
+
+
+static float Weight(float x, float b, float c) noexcept {
+	const float ax = std::abs(x);
+
+	if (ax < 1.0f) {
+		return (x * x * ((12.0f - 9.0f * b - 6.0f * c) * ax + (-18.0f + 12.0f * b + 6.0f * c)) + (6.0f - 2.0f * b)) / 6.0f;
+	} else if (ax < 2.0f) {
+		return (x * x * ((-b - 6.0f * c) * ax + (6.0f * b + 30.0f * c)) + (-12.0f * b - 48.0f * c) * ax + (8.0f * b + 24.0f * c)) / 6.0f;
+	} else {
+		return 0.0f;
+	}
+}
+
+// 和 Bicubic.hlsl 中的 weight4(1 - f) 相同，并归一化
+static void Weight4(float f, float b, float c, float (&taps)[4]) noexcept {
+	float sum = 0;
+	for (int i = 0; i < 4; ++i) {
+		taps[i] = Weight(1 - f + i - 2, b, c);
+		sum += taps[i];
+	}
+	for (float& tap : taps) {
+		tap /= sum;
+	}
+}
+
+CpuImage CpuScalers::Bicubic(const CpuImage& src, uint32_t outputWidth, uint32_t outputHeight, float paramB, float paramC) {
+	CpuImage result(outputWidth, outputHeight);
+
+	const float scaleX = (float)src.width / outputWidth;
+	const float scaleY = (float)src.height / outputHeight;
+
+	ForEachPixel(result, [&](uint32_t x, uint32_t y) {
+		// Bicubic.hlsl 借助线性采样将 16 次采样合并为 9 次，结果和直接计算 4x4 的可分离卷积相同
+		const float px = (x + 0.5f) * scaleX - 0.5f;
+		const float py = (y + 0.5f) * scaleY - 0.5f;
+		const float fx = std::floor(px);
+		const float fy = std::floor(py);
+		const int ix = (int)fx;
+		const int iy = (int)fy;
+
+		float rowTaps[4];
+		float colTaps[4];
+		Weight4(px - fx, paramB, paramC, rowTaps);
+		Weight4(py - fy, paramB, paramC, colTaps);
+
+		Float4 total;
+		for (int j = 0; j < 4; ++j) {
+			Float4 row;
+			for (int i = 0; i < 4; ++i) {
+				row = Mad(Fetch(src, ix + i - 1, iy + j - 1), rowTaps[i], row);
+			}
+			total = Mad(row, colTaps[j], total);
+		}
+
+		return total;
+	});
+
+	return result;
+}
@@ -0,0 +1,25 @@
+#include "Common.h"
+
+
+CpuImage CpuScalers::Bilinear(const CpuImage& src, uint32_t outputWidth, uint32_t outputHeight) {
+	CpuImage result(outputWidth, outputHeight);
+
+	const float scaleX = (float)src.width / outputWidth;
+	const float scaleY = (float)src.height / outputHeight;
+
+	ForEachPixel(result, [&](uint32_t x, uint32_t y) {
+		// 和线性采样器相同，以纹素中心为基准插值
+		const float px = (x + 0.5f) * scaleX - 0.5f;
+		const float py = (y + 0.5f) * scaleY - 0.5f;
+		const float fx = std::floor(px);
+		const float fy = std::floor(py);
+		const int ix = (int)fx;
+		const int iy = (int)fy;
+
+		const Float4 top = Lerp(Fetch(src, ix, iy), Fetch(src, ix + 1, iy), px - fx);
+		const Float4 bottom = Lerp(Fetch(src, ix, iy + 1), Fetch(src, ix + 1, iy + 1), px - fx);
+		return Lerp(top, bottom, py - fy);
+	});
+
+	return result;
+}
@@ -0,0 +1,38 @@
+#include "Common.h"
+
+
+CpuImage CpuScalers::CAS(const CpuImage& src, float sharpness) {
+	CpuImage result(src.width, src.height);
+
+	const float peak = -1.0f / (8.0f + (5.0f - 8.0f) * sharpness);
+
+	ForEachPixel(result, [&](uint32_t x, uint32_t y) {
+		//   b
+		// d e f
+		//   h
+		const Float4 b = Fetch(src, x, y - 1);
+		const Float4 d = Fetch(src, x - 1, y);
+		const Float4 e = Fetch(src, x, y);
+		const Float4 f = Fetch(src, x + 1, y);
+		const Float4 h = Fetch(src, x, y + 1);
+
+		// Soft min and max，CAS.hlsl 只使用绿色通道的权重
+		const float mnG = Min3(Min3(d, e, f), b, h)[1];
+		const float mxG = Max3(Max3(d, e, f), b, h)[1];
+
+		// Smooth minimum distance to signal limit divided by smooth max.
+		// GPU 上 rcp(0) 为无穷大，和 0 的乘积为 NaN，saturate 将其转为 0
+		const float ampG = mxG == 0.0f ? 0.0f : std::sqrt(std::clamp(std::min(mnG, 1.0f - mxG) / mxG, 0.0f, 1.0f));
+
+		// Filter shape.
+		//  0 w 0
+		//  w 1 w
+		//  0 w 0
+		const float wG = ampG * peak;
+		const float rcpWeight = 1.0f / (1.0f + 4.0f * wG);
+
+		return Saturate(Mad(b + d + f + h, wG, e) * rcpWeight).WithOpaqueAlpha();
+	});
+
+	return result;
+}
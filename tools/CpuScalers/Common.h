@@ -0,0 +1,28 @@
+#pragma once
+#include "CpuScalers.h"
+#include "Float4.h"
+#include <functional>
+
+
+// 钳位到边缘的纹素读取，对应 CLAMP 寻址模式
+inline Float4 Fetch(const CpuImage& img, int x, int y) noexcept {
+	x = std::clamp(x, 0, (int)img.width - 1);
+	y = std::clamp(y, 0, (int)img.height - 1);
+	return Float4::Load(img.Row(y) + (size_t)x * 4);
+}
+
+// 将宽 width、高 height 的输出划分为区块并分配给多个线程，fn 处理 [left, right) x [top, bottom) 内的像素
+void ParallelForTiles(uint32_t width, uint32_t height, const std::function<void(uint32_t left, uint32_t top, uint32_t right, uint32_t bottom)>& fn);
+
+// kernel 计算 (x, y) 处的像素，在区块内内联调用
+template<typename Kernel>
+void ForEachPixel(CpuImage& output, const Kernel& kernel) {
+	ParallelForTiles(output.width, output.height, [&](uint32_t left, uint32_t top, uint32_t right, uint32_t bottom) {
+		for (uint32_t y = top; y < bottom; ++y) {
+			float* row = output.Row(y);
+			for (uint32_t x = left; x < right; ++x) {
+				kernel(x, y).Store(row + (size_t)x * 4);
+			}
+		}
+	});
+}
@@ -0,0 +1,50 @@
+#include "Common.h"
+#include <atomic>
+#include <thread>
+
+
+// 64x64 的区块足够小，可以在线程之间均衡负载，且一个区块的输入能放入 L2 缓存
+static constexpr uint32_t TILE_SIZE = 64;
+
+static std::atomic<uint32_t> threadCount = 0;
+
+
+void CpuScalers::SetThreadCount(uint32_t count) noexcept {
+	threadCount = count;
+}
+
+void ParallelForTiles(uint32_t width, uint32_t height, const std::function<void(uint32_t left, uint32_t top, uint32_t right, uint32_t bottom)>& fn) {
+	const uint32_t tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+	const uint32_t tileCount = tilesX * ((height + TILE_SIZE - 1) / TILE_SIZE);
+	if (tileCount == 0) {
+		return;
+	}
+
+	// 线程从同一个计数器领取区块，处理较快的线程可以多处理一些
+	std::atomic<uint32_t> nextTile = 0;
+	auto worker = [&]() {
+		for (uint32_t i = nextTile++; i < tileCount; i = nextTile++) {
+			const uint32_t left = i % tilesX * TILE_SIZE;
+			const uint32_t top = i / tilesX * TILE_SIZE;
+			fn(left, top, std::min(left + TILE_SIZE, width), std::min(top + TILE_SIZE, height));
+		}
+	};
+
+	uint32_t count = threadCount;
+	if (count == 0) {
+		count = std::max(std::thread::hardware_concurrency(), 1u);
+	}
+	count = std::min(count, tileCount);
+
+	std::vector<std::thread> threads;
+	threads.reserve(count - 1);
+	for (uint32_t i = 1; i < count; ++i) {
+		threads.emplace_back(worker);
+	}
+	// 当前线程也参与处理
+	worker();
+
+	for (std::thread& t : threads) {
+		t.join();
+	}
+}
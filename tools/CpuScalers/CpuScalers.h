@@ -0,0 +1,68 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+// RGBA 格式，每个通道为 float，行间距为 width * 4
+struct CpuImage {
+	uint32_t width = 0;
+	uint32_t height = 0;
+	std::vector<float> pixels;
+
+	CpuImage() = default;
+	CpuImage(uint32_t width_, uint32_t height_) : width(width_), height(height_), pixels((size_t)width_ * height_ * 4) {}
+
+	float* Row(uint32_t y) noexcept {
+		return pixels.data() + (size_t)y * width * 4;
+	}
+
+	const float* Row(uint32_t y) const noexcept {
+		return pixels.data() + (size_t)y * width * 4;
+	}
+};
+
+// Effects 中常用缩放和锐化效果的 CPU 实现，和对应的 .hlsl 使用相同的算法
+// 可以作为图像对比测试的参考结果，也可以在没有 GPU 时用于生成缩略图或离线处理
+// 输出按区块划分到多个线程上处理。越界的采样一律钳位到边缘，和 CLAMP 寻址模式的采样器相同
+struct CpuScalers {
+	// 0 表示使用 std::thread::hardware_concurrency()
+	static void SetThreadCount(uint32_t count) noexcept;
+
+	// Bilinear.hlsl
+	static CpuImage Bilinear(const CpuImage& src, uint32_t outputWidth, uint32_t outputHeight);
+
+	// Bicubic.hlsl，paramB 和 paramC 取 0 和 0.5 时即为 CatmullRom.hlsl
+	static CpuImage Bicubic(
+		const CpuImage& src,
+		uint32_t outputWidth,
+		uint32_t outputHeight,
+		float paramB = 0.333333f,
+		float paramC = 0.333333f
+	);
+
+	// Lanczos.hlsl
+	static CpuImage Lanczos(const CpuImage& src, uint32_t outputWidth, uint32_t outputHeight, float arStrength = 0.5f);
+
+	// Jinc.hlsl
+	static CpuImage Jinc(
+		const CpuImage& src,
+		uint32_t outputWidth,
+		uint32_t outputHeight,
+		float windowSinc = 0.5f,
+		float sinc = 0.825f,
+		float arStrength = 0.5f
+	);
+
+	// CAS.hlsl，不改变尺寸
+	static CpuImage CAS(const CpuImage& src, float sharpness = 0.4f);
+
+	// FSR_EASU.hlsl
+	static CpuImage FsrEasu(const CpuImage& src, uint32_t outputWidth, uint32_t outputHeight);
+
+	// FSR_RCAS.hlsl，不改变尺寸
+	static CpuImage FsrRcas(const CpuImage& src, float sharpness = 0.87f);
+
+	// NIS.hlsl，系数表从 NIS_Coef_Scale.dds 和 NIS_Coef_USM.dds 导出到 NISCoef.h
+	static CpuImage NIS(const CpuImage& src, uint32_t outputWidth, uint32_t outputHeight, float sharpness = 0.5f);
+};
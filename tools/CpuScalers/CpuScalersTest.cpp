@@ -0,0 +1,229 @@
+#include "CpuScalers.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+
+
+// 检查每个效果的输出：
+// 1. 可以直接推算出结果的情况，如纯色输入、1 倍缩放和线性渐变上的双线性插值
+// 2. 和 testdata 中保存的回归快照比较。快照由本库的标量实现生成，只能发现 CPU 实现自身的改变，
+//    不能证明和 HLSL 效果的输出一致。SSE、FMA 和 NEON 实现的误差应在 SNAPSHOT_TOLERANCE 内。
+//    使用 --update 参数运行可以重新生成
+
+static constexpr float SNAPSHOT_TOLERANCE = 1e-4f;
+
+static int failures = 0;
+
+static void Fail(const char* name, const char* check, uint32_t x, uint32_t y, float actual, float expected) {
+	++failures;
+	std::printf("失败：%s，%s，(%u, %u) 处为 %f，期望 %f\n", name, check, x, y, actual, expected);
+}
+
+// 比较 RGB 通道，alpha 应始终为 1。每项检查只报告第一个错误
+static void Compare(
+	const char* name,
+	const char* check,
+	const CpuImage& img,
+	float tolerance,
+	const std::function<float(uint32_t x, uint32_t y, int c)>& expected
+) {
+	for (uint32_t y = 0; y < img.height; ++y) {
+		for (uint32_t x = 0; x < img.width; ++x) {
+			const float* pixel = img.Row(y) + (size_t)x * 4;
+			for (int c = 0; c < 4; ++c) {
+				const float e = c == 3 ? 1.0f : expected(x, y, c);
+				if (!(std::abs(pixel[c] - e) <= tolerance)) {
+					Fail(name, check, x, y, pixel[c], e);
+					return;
+				}
+			}
+		}
+	}
+}
+
+// 取值都是 1/64 的倍数，包含水平、垂直和斜向的边缘，以及渐变和棋盘格
+static CpuImage CreatePattern(uint32_t width, uint32_t height) {
+	CpuImage img(width, height);
+	for (uint32_t y = 0; y < height; ++y) {
+		for (uint32_t x = 0; x < width; ++x) {
+			float* pixel = img.Row(y) + (size_t)x * 4;
+			pixel[0] = ((x * 7 + y * 3) % 16) * 4 / 64.0f;
+			pixel[1] = x * 5 > y * 6 ? 56 / 64.0f : 8 / 64.0f;
+			pixel[2] = (x / 3 + y / 2) % 2 ? 48 / 64.0f : (y < height / 2 ? 16 / 64.0f : 32 / 64.0f);
+			pixel[3] = 1.0f;
+		}
+	}
+	return img;
+}
+
+static CpuImage CreateConstant(uint32_t width, uint32_t height) {
+	CpuImage img(width, height);
+	for (size_t i = 0; i < img.pixels.size(); i += 4) {
+		img.pixels[i] = 0.25f;
+		img.pixels[i + 1] = 0.5f;
+		img.pixels[i + 2] = 0.75f;
+		img.pixels[i + 3] = 1.0f;
+	}
+	return img;
+}
+
+struct Kernel {
+	const char* name;
+	// 为 false 时不改变尺寸
+	bool scales;
+	// 纯色输入的误差，NIS 的系数为半精度，每个相位的和不严格等于 1
+	float constantTolerance;
+	std::function<CpuImage(const CpuImage& src, uint32_t width, uint32_t height)> run;
+};
+
+static const Kernel KERNELS[] = {
+	{ "Bilinear", true, 1e-6f, [](const CpuImage& src, uint32_t w, uint32_t h) { return CpuScalers::Bilinear(src, w, h); } },
+	{ "Bicubic", true, 1e-5f, [](const CpuImage& src, uint32_t w, uint32_t h) { return CpuScalers::Bicubic(src, w, h); } },
+	{ "CatmullRom", true, 1e-5f, [](const CpuImage& src, uint32_t w, uint32_t h) { return CpuScalers::Bicubic(src, w, h, 0.0f, 0.5f); } },
+	{ "Lanczos", true, 1e-5f, [](const CpuImage& src, uint32_t w, uint32_t h) { return CpuScalers::Lanczos(src, w, h); } },
+	{ "Jinc", true, 1e-5f, [](const CpuImage& src, uint32_t w, uint32_t h) { return CpuScalers::Jinc(src, w, h); } },
+	{ "CAS", false, 1e-5f, [](const CpuImage& src, uint32_t, uint32_t) { return CpuScalers::CAS(src); } },
+	{ "FsrEasu", true, 1e-5f, [](const CpuImage& src, uint32_t w, uint32_t h) { return CpuScalers::FsrEasu(src, w, h); } },
+	{ "FsrRcas", false, 1e-5f, [](const CpuImage& src, uint32_t, uint32_t) { return CpuScalers::FsrRcas(src); } },
+	{ "NIS", true, 2e-3f, [](const CpuImage& src, uint32_t w, uint32_t h) { return CpuScalers::NIS(src, w, h); } },
+};
+
+static void TestConstant(const Kernel& kernel) {
+	const CpuImage src = CreateConstant(9, 7);
+	const CpuImage result = kernel.run(src, 20, 13);
+	Compare(kernel.name, "纯色", result, kernel.constantTolerance, [](uint32_t, uint32_t, int c) {
+		return 0.25f * (c + 1);
+	});
+}
+
+// 这些效果在 1 倍缩放时应输出原图
+static void TestIdentity() {
+	const CpuImage src = CreatePattern(13, 11);
+	auto srcValue = [&](uint32_t x, uint32_t y, int c) {
+		return src.Row(y)[x * 4 + c];
+	};
+
+	Compare("Bilinear", "1 倍缩放", CpuScalers::Bilinear(src, src.width, src.height), 1e-6f, srcValue);
+	Compare("CatmullRom", "1 倍缩放", CpuScalers::Bicubic(src, src.width, src.height, 0.0f, 0.5f), 1e-5f, srcValue);
+	Compare("Lanczos", "1 倍缩放", CpuScalers::Lanczos(src, src.width, src.height), 1e-4f, srcValue);
+}
+
+// 线性渐变上双线性插值的结果仍是线性的，忽略受钳位影响的边缘
+static void TestBilinearGradient() {
+	CpuImage src(8, 6);
+	for (uint32_t y = 0; y < src.height; ++y) {
+		for (uint32_t x = 0; x < src.width; ++x) {
+			float* pixel = src.Row(y) + (size_t)x * 4;
+			pixel[0] = x / 8.0f;
+			pixel[1] = y / 8.0f;
+			pixel[2] = (x + y) / 16.0f;
+			pixel[3] = 1.0f;
+		}
+	}
+
+	// 放大 2 倍，输出像素中心在输入中的坐标为 (x + 0.5) / 2 - 0.5
+	CpuImage result = CpuScalers::Bilinear(src, 16, 12);
+	CpuImage interior(14, 10);
+	for (uint32_t y = 0; y < interior.height; ++y) {
+		std::memcpy(interior.Row(y), result.Row(y + 1) + 4, (size_t)interior.width * 4 * sizeof(float));
+	}
+	Compare("Bilinear", "线性渐变", interior, 1e-6f, [](uint32_t x, uint32_t y, int c) {
+		const float sx = (x + 1.5f) / 2 - 0.5f;
+		const float sy = (y + 1.5f) / 2 - 0.5f;
+		return c == 0 ? sx / 8.0f : (c == 1 ? sy / 8.0f : (sx + sy) / 16.0f);
+	});
+}
+
+static std::string GetSnapshotPath(const Kernel& kernel) {
+	return std::string(CPU_SCALERS_TESTDATA_DIR) + "/" + kernel.name + ".txt";
+}
+
+static CpuImage RunSnapshot(const Kernel& kernel) {
+	const CpuImage src = CreatePattern(12, 10);
+	return kernel.scales ? kernel.run(src, 19, 17) : kernel.run(src, 0, 0);
+}
+
+static bool WriteSnapshot(const Kernel& kernel) {
+	const CpuImage result = RunSnapshot(kernel);
+
+	FILE* file = std::fopen(GetSnapshotPath(kernel).c_str(), "w");
+	if (!file) {
+		std::printf("无法写入 %s\n", GetSnapshotPath(kernel).c_str());
+		return false;
+	}
+
+	std::fprintf(file, "%u %u\n", result.width, result.height);
+	for (uint32_t y = 0; y < result.height; ++y) {
+		for (uint32_t x = 0; x < result.width; ++x) {
+			const float* pixel = result.Row(y) + (size_t)x * 4;
+			std::fprintf(file, "%.7f %.7f %.7f\n", pixel[0], pixel[1], pixel[2]);
+		}
+	}
+
+	std::fclose(file);
+	return true;
+}
+
+static void TestSnapshot(const Kernel& kernel) {
+	FILE* file = std::fopen(GetSnapshotPath(kernel).c_str(), "r");
+	if (!file) {
+		++failures;
+		std::printf("失败：无法打开 %s\n", GetSnapshotPath(kernel).c_str());
+		return;
+	}
+
+	uint32_t width = 0;
+	uint32_t height = 0;
+	CpuImage snapshot;
+	bool success = std::fscanf(file, "%u %u", &width, &height) == 2;
+	if (success) {
+		snapshot = CpuImage(width, height);
+		for (uint32_t y = 0; success && y < height; ++y) {
+			for (uint32_t x = 0; success && x < width; ++x) {
+				float* pixel = snapshot.Row(y) + (size_t)x * 4;
+				success = std::fscanf(file, "%f %f %f", &pixel[0], &pixel[1], &pixel[2]) == 3;
+			}
+		}
+	}
+	std::fclose(file);
+
+	const CpuImage result = RunSnapshot(kernel);
+	if (!success || snapshot.width != result.width || snapshot.height != result.height) {
+		++failures;
+		std::printf("失败：%s 的回归快照格式错误或尺寸不匹配\n", kernel.name);
+		return;
+	}
+
+	Compare(kernel.name, "回归快照", result, SNAPSHOT_TOLERANCE, [&](uint32_t x, uint32_t y, int c) {
+		return snapshot.Row(y)[x * 4 + c];
+	});
+}
+
+int main(int argc, char* argv[]) {
+	if (argc > 1 && std::strcmp(argv[1], "--update") == 0) {
+		for (const Kernel& kernel : KERNELS) {
+			if (!WriteSnapshot(kernel)) {
+				return 1;
+			}
+		}
+		std::printf("已更新 %s\n", CPU_SCALERS_TESTDATA_DIR);
+		return 0;
+	}
+
+	for (const Kernel& kernel : KERNELS) {
+		TestConstant(kernel);
+		TestSnapshot(kernel);
+	}
+	TestIdentity();
+	TestBilinearGradient();
+
+	if (failures > 0) {
+		std::printf("%d 项检查失败\n", failures);
+		return 1;
+	}
+
+	std::printf("全部通过\n");
+	return 0;
+}
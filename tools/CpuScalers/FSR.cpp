@@ -0,0 +1,227 @@
+#include "Common.h"
+
+
+// Simplest multi-channel approximate luma possible (luma times 2, in 2 FMA/MAD).
+static float Luma(Float4 c) noexcept {
+	return c[2] * 0.5f + (c[0] * 0.5f + c[1]);
+}
+
+// Filtering for a given tap for the scalar.
+static void FsrEasuTap(
+	Float4& aC, // Accumulated color, with negative lobe.
+	float& aW, // Accumulated weight.
+	float offX, float offY, // Pixel offset from resolve position to tap.
+	float dirX, float dirY, // Gradient direction.
+	float lenX, float lenY, // Length.
+	float lob, // Negative lobe strength.
+	float clp, // Clipping point.
+	Float4 c // Tap color.
+) noexcept {
+	// Rotate offset by direction.
+	float vx = offX * dirX + offY * dirY;
+	float vy = offX * -dirY + offY * dirX;
+	// Anisotropy.
+	vx *= lenX;
+	vy *= lenY;
+	// Compute distance^2.
+	float d2 = vx * vx + vy * vy;
+	// Limit to the window as at corner, 2 taps can easily be outside.
+	d2 = std::min(d2, clp);
+	// Approximation of lanczos2 without sin() or rcp(), or sqrt() to get x.
+	float wB = 2.0f / 5.0f * d2 - 1;
+	float wA = lob * d2 - 1;
+	wB *= wB;
+	wA *= wA;
+	wB = 25.0f / 16.0f * wB - (25.0f / 16.0f - 1.0f);
+	const float w = wB * wA;
+	// Do weighted average.
+	aC = Mad(c, w, aC);
+	aW += w;
+}
+
+// Accumulate direction and length.
+//    a
+//  b c d
+//    e
+static void FsrEasuSet(float& dirX, float& dirY, float& len, float w, float lA, float lB, float lC, float lD, float lE) noexcept {
+	// Direction is the '+' diff.
+	// Then takes magnitude from abs average of both sides of 'c'.
+	// Length converts gradient reversal to 0, smoothly to non-reversal at 1, shaped, then adding horz and vert terms.
+	const float dc = lD - lC;
+	const float cb = lC - lB;
+	float lenX = std::max(std::abs(dc), std::abs(cb));
+	const float dx = lD - lB;
+	dirX += dx * w;
+	// GPU 上 rcp(0) 为无穷大，abs(dirX) 为 0 时乘积为 NaN，saturate 将其转为 0
+	lenX = lenX == 0.0f ? 0.0f : std::clamp(std::abs(dx) / lenX, 0.0f, 1.0f);
+	lenX *= lenX;
+	len += lenX * w;
+	// Repeat for the y axis.
+	const float ec = lE - lC;
+	const float ca = lC - lA;
+	float lenY = std::max(std::abs(ec), std::abs(ca));
+	const float dy = lE - lA;
+	dirY += dy * w;
+	lenY = lenY == 0.0f ? 0.0f : std::clamp(std::abs(dy) / lenY, 0.0f, 1.0f);
+	lenY *= lenY;
+	len += lenY * w;
+}
+
+CpuImage CpuScalers::FsrEasu(const CpuImage& src, uint32_t outputWidth, uint32_t outputHeight) {
+	CpuImage result(outputWidth, outputHeight);
+
+	const float scaleX = (float)src.width / outputWidth;
+	const float scaleY = (float)src.height / outputHeight;
+
+	ForEachPixel(result, [&](uint32_t x, uint32_t y) {
+		// Get position of 'f'.
+		float ppX = x * scaleX + (0.5f * scaleX - 0.5f);
+		float ppY = y * scaleY + (0.5f * scaleY - 0.5f);
+		const float fpX = std::floor(ppX);
+		const float fpY = std::floor(ppY);
+		ppX -= fpX;
+		ppY -= fpY;
+		const int fx = (int)fpX;
+		const int fy = (int)fpY;
+
+		// 12-tap kernel.
+		//    b c
+		//  e f g h
+		//  i j k l
+		//    n o
+		const Float4 b = Fetch(src, fx, fy - 1);
+		const Float4 c = Fetch(src, fx + 1, fy - 1);
+		const Float4 e = Fetch(src, fx - 1, fy);
+		const Float4 f = Fetch(src, fx, fy);
+		const Float4 g = Fetch(src, fx + 1, fy);
+		const Float4 h = Fetch(src, fx + 2, fy);
+		const Float4 i = Fetch(src, fx - 1, fy + 1);
+		const Float4 j = Fetch(src, fx, fy + 1);
+		const Float4 k = Fetch(src, fx + 1, fy + 1);
+		const Float4 l = Fetch(src, fx + 2, fy + 1);
+		const Float4 n = Fetch(src, fx, fy + 2);
+		const Float4 o = Fetch(src, fx + 1, fy + 2);
+
+		const float bL = Luma(b);
+		const float cL = Luma(c);
+		const float eL = Luma(e);
+		const float fL = Luma(f);
+		const float gL = Luma(g);
+		const float hL = Luma(h);
+		const float iL = Luma(i);
+		const float jL = Luma(j);
+		const float kL = Luma(k);
+		const float lL = Luma(l);
+		const float nL = Luma(n);
+		const float oL = Luma(o);
+
+		// Accumulate for bilinear interpolation.
+		//  s t
+		//  u v
+		float dirX = 0;
+		float dirY = 0;
+		float len = 0;
+		FsrEasuSet(dirX, dirY, len, (1 - ppX) * (1 - ppY), bL, eL, fL, gL, jL);
+		FsrEasuSet(dirX, dirY, len, ppX * (1 - ppY), cL, fL, gL, hL, kL);
+		FsrEasuSet(dirX, dirY, len, (1 - ppX) * ppY, fL, iL, jL, kL, nL);
+		FsrEasuSet(dirX, dirY, len, ppX * ppY, gL, jL, kL, lL, oL);
+
+		// Normalize with approximation, and cleanup close to zero.
+		float dirR = dirX * dirX + dirY * dirY;
+		const bool zro = dirR < 1.0f / 32768.0f;
+		dirR = zro ? 1 : 1.0f / std::sqrt(dirR);
+		dirX = zro ? 1 : dirX;
+		dirX *= dirR;
+		dirY *= dirR;
+		// Transform from {0 to 2} to {0 to 1} range, and shape with square.
+		len = len * 0.5f;
+		len *= len;
+		// Stretch kernel {1.0 vert|horz, to sqrt(2.0) on diagonal}.
+		const float stretch = (dirX * dirX + dirY * dirY) / std::max(std::abs(dirX), std::abs(dirY));
+		// Anisotropic length after rotation,
+		//  x := 1.0 lerp to 'stretch' on edges
+		//  y := 1.0 lerp to 2x on edges
+		const float len2X = 1 + (stretch - 1) * len;
+		const float len2Y = 1 - 0.5f * len;
+		// Based on the amount of 'edge',
+		// the window shifts from +/-{sqrt(2.0) to slightly beyond 2.0}.
+		const float lob = 0.5f + ((1.0f / 4.0f - 0.04f) - 0.5f) * len;
+		// Set distance^2 clipping point to the end of the adjustable window.
+		const float clp = 1.0f / lob;
+
+		// Accumulation mixed with min/max of 4 nearest.
+		const Float4 min4 = Min(Min3(f, g, j), k);
+		const Float4 max4 = Max(Max3(f, g, j), k);
+
+		Float4 aC;
+		float aW = 0;
+		FsrEasuTap(aC, aW, 0.0f - ppX, -1.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, b);
+		FsrEasuTap(aC, aW, 1.0f - ppX, -1.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, c);
+		FsrEasuTap(aC, aW, -1.0f - ppX, 1.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, i);
+		FsrEasuTap(aC, aW, 0.0f - ppX, 1.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, j);
+		FsrEasuTap(aC, aW, 0.0f - ppX, 0.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, f);
+		FsrEasuTap(aC, aW, -1.0f - ppX, 0.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, e);
+		FsrEasuTap(aC, aW, 1.0f - ppX, 1.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, k);
+		FsrEasuTap(aC, aW, 2.0f - ppX, 1.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, l);
+		FsrEasuTap(aC, aW, 2.0f - ppX, 0.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, h);
+		FsrEasuTap(aC, aW, 1.0f - ppX, 0.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, g);
+		FsrEasuTap(aC, aW, 1.0f - ppX, 2.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, o);
+		FsrEasuTap(aC, aW, 0.0f - ppX, 2.0f - ppY, dirX, dirY, len2X, len2Y, lob, clp, n);
+
+		// Normalize and dering.
+		return Min(max4, Max(min4, aC / aW)).WithOpaqueAlpha();
+	});
+
+	return result;
+}
+
+// This is set at the limit of providing unnatural results for sharpening.
+static constexpr float FSR_RCAS_LIMIT = 0.25f - (1.0f / 16.0f);
+
+CpuImage CpuScalers::FsrRcas(const CpuImage& src, float sharpness) {
+	CpuImage result(src.width, src.height);
+
+	ForEachPixel(result, [&](uint32_t x, uint32_t y) {
+		// Algorithm uses minimal 3x3 pixel neighborhood.
+		//    b
+		//  d e f
+		//    h
+		const Float4 b = Fetch(src, x, y - 1);
+		const Float4 d = Fetch(src, x - 1, y);
+		const Float4 e = Fetch(src, x, y);
+		const Float4 f = Fetch(src, x + 1, y);
+		const Float4 h = Fetch(src, x, y + 1);
+
+		// Luma times 2.
+		const float bL = Luma(b);
+		const float dL = Luma(d);
+		const float eL = Luma(e);
+		const float fL = Luma(f);
+		const float hL = Luma(h);
+
+		// Noise detection.
+		float nz = 0.25f * bL + 0.25f * dL + 0.25f * fL + 0.25f * hL - eL;
+		const float range = std::max(std::max(std::max(bL, dL), std::max(eL, fL)), hL)
+			- std::min(std::min(std::min(bL, dL), std::min(eL, fL)), hL);
+		nz = range == 0.0f ? 0.0f : std::clamp(std::abs(nz) / range, 0.0f, 1.0f);
+		nz = -0.5f * nz + 1.0f;
+
+		// Min and max of ring.
+		const Float4 mn4 = Min(Min3(b, d, f), h);
+		const Float4 mx4 = Max(Max3(b, d, f), h);
+		// Limiters, these need to be high precision RCPs.
+		const Float4 hitMin = Min(mn4, e) / (mx4 * 4.0f);
+		const Float4 hitMax = (1.0f - Max(mx4, e)) / Mad(mn4, 4.0f, -4.0f);
+		const Float4 lobeRGB = Max(0.0f - hitMin, hitMax);
+		float lobe = std::max(-FSR_RCAS_LIMIT, std::min(std::max(std::max(lobeRGB[0], lobeRGB[1]), lobeRGB[2]), 0.0f)) * sharpness;
+
+		// Apply noise removal.
+		lobe *= nz;
+
+		// Resolve, which needs the medium precision rcp approximation to avoid visible tonality changes.
+		const float rcpL = 1.0f / (4.0f * lobe + 1.0f);
+		return (Mad(b + d + h + f, lobe, e) * rcpL).WithOpaqueAlpha();
+	});
+
+	return result;
+}
@@ -0,0 +1,119 @@
+#pragma once
+#include <cmath>
+#include <algorithm>
+
+#if defined(CPU_SCALERS_SCALAR)
+// 强制使用标量实现，用于和 SIMD 实现对比
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CPU_SCALERS_SSE
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define CPU_SCALERS_NEON
+#include <arm_neon.h>
+#endif
+
+
+// 一个像素的 RGBA 四个通道，对应 HLSL 中的 float4
+// x86 上使用 SSE（启用 AVX2 时编译器会生成 VEX 编码和 FMA 指令），ARM 上使用 NEON，其他平台回退到标量实现
+struct Float4 {
+#if defined(CPU_SCALERS_SSE)
+	__m128 v;
+
+	Float4() noexcept : v(_mm_setzero_ps()) {}
+	Float4(__m128 value) noexcept : v(value) {}
+	Float4(float value) noexcept : v(_mm_set1_ps(value)) {}
+	Float4(float x, float y, float z, float w) noexcept : v(_mm_setr_ps(x, y, z, w)) {}
+
+	static Float4 Load(const float* p) noexcept { return _mm_loadu_ps(p); }
+	void Store(float* p) const noexcept { _mm_storeu_ps(p, v); }
+
+	float operator[](int i) const noexcept {
+		alignas(16) float t[4];
+		_mm_store_ps(t, v);
+		return t[i];
+	}
+
+	friend Float4 operator+(Float4 a, Float4 b) noexcept { return _mm_add_ps(a.v, b.v); }
+	friend Float4 operator-(Float4 a, Float4 b) noexcept { return _mm_sub_ps(a.v, b.v); }
+	friend Float4 operator*(Float4 a, Float4 b) noexcept { return _mm_mul_ps(a.v, b.v); }
+	friend Float4 operator/(Float4 a, Float4 b) noexcept { return _mm_div_ps(a.v, b.v); }
+	friend Float4 Min(Float4 a, Float4 b) noexcept { return _mm_min_ps(a.v, b.v); }
+	friend Float4 Max(Float4 a, Float4 b) noexcept { return _mm_max_ps(a.v, b.v); }
+	friend Float4 Sqrt(Float4 a) noexcept { return _mm_sqrt_ps(a.v); }
+	// a * b + c
+	friend Float4 Mad(Float4 a, Float4 b, Float4 c) noexcept {
+#ifdef __FMA__
+		return _mm_fmadd_ps(a.v, b.v, c.v);
+#else
+		return _mm_add_ps(_mm_mul_ps(a.v, b.v), c.v);
+#endif
+	}
+#elif defined(CPU_SCALERS_NEON)
+	float32x4_t v;
+
+	Float4() noexcept : v(vdupq_n_f32(0)) {}
+	Float4(float32x4_t value) noexcept : v(value) {}
+	Float4(float value) noexcept : v(vdupq_n_f32(value)) {}
+	Float4(float x, float y, float z, float w) noexcept {
+		const float t[4] = { x, y, z, w };
+		v = vld1q_f32(t);
+	}
+
+	static Float4 Load(const float* p) noexcept { return vld1q_f32(p); }
+	void Store(float* p) const noexcept { vst1q_f32(p, v); }
+
+	float operator[](int i) const noexcept {
+		float t[4];
+		vst1q_f32(t, v);
+		return t[i];
+	}
+
+	friend Float4 operator+(Float4 a, Float4 b) noexcept { return vaddq_f32(a.v, b.v); }
+	friend Float4 operator-(Float4 a, Float4 b) noexcept { return vsubq_f32(a.v, b.v); }
+	friend Float4 operator*(Float4 a, Float4 b) noexcept { return vmulq_f32(a.v, b.v); }
+	friend Float4 operator/(Float4 a, Float4 b) noexcept { return vdivq_f32(a.v, b.v); }
+	friend Float4 Min(Float4 a, Float4 b) noexcept { return vminq_f32(a.v, b.v); }
+	friend Float4 Max(Float4 a, Float4 b) noexcept { return vmaxq_f32(a.v, b.v); }
+	friend Float4 Sqrt(Float4 a) noexcept { return vsqrtq_f32(a.v); }
+	friend Float4 Mad(Float4 a, Float4 b, Float4 c) noexcept { return vfmaq_f32(c.v, a.v, b.v); }
+#else
+	float v[4];
+
+	Float4() noexcept : v{} {}
+	Float4(float value) noexcept : v{ value, value, value, value } {}
+	Float4(float x, float y, float z, float w) noexcept : v{ x, y, z, w } {}
+
+	static Float4 Load(const float* p) noexcept { return { p[0], p[1], p[2], p[3] }; }
+	void Store(float* p) const noexcept { std::copy_n(v, 4, p); }
+
+	float operator[](int i) const noexcept { return v[i]; }
+
+	template<typename Fn>
+	static Float4 Map(Float4 a, Float4 b, const Fn& fn) noexcept {
+		return { fn(a.v[0], b.v[0]), fn(a.v[1], b.v[1]), fn(a.v[2], b.v[2]), fn(a.v[3], b.v[3]) };
+	}
+
+	friend Float4 operator+(Float4 a, Float4 b) noexcept { return Map(a, b, [](float x, float y) { return x + y; }); }
+	friend Float4 operator-(Float4 a, Float4 b) noexcept { return Map(a, b, [](float x, float y) { return x - y; }); }
+	friend Float4 operator*(Float4 a, Float4 b) noexcept { return Map(a, b, [](float x, float y) { return x * y; }); }
+	friend Float4 operator/(Float4 a, Float4 b) noexcept { return Map(a, b, [](float x, float y) { return x / y; }); }
+	friend Float4 Min(Float4 a, Float4 b) noexcept { return Map(a, b, [](float x, float y) { return std::min(x, y); }); }
+	friend Float4 Max(Float4 a, Float4 b) noexcept { return Map(a, b, [](float x, float y) { return std::max(x, y); }); }
+	friend Float4 Sqrt(Float4 a) noexcept { return Map(a, a, [](float x, float) { return std::sqrt(x); }); }
+	friend Float4 Mad(Float4 a, Float4 b, Float4 c) noexcept { return a * b + c; }
+#endif
+
+	Float4& operator+=(Float4 other) noexcept { return *this = *this + other; }
+	Float4& operator*=(Float4 other) noexcept { return *this = *this * other; }
+
+	friend Float4 Clamp(Float4 a, Float4 lo, Float4 hi) noexcept { return Min(Max(a, lo), hi); }
+	friend Float4 Saturate(Float4 a) noexcept { return Clamp(a, 0.0f, 1.0f); }
+	friend Float4 Lerp(Float4 a, Float4 b, float t) noexcept { return Mad(b - a, t, a); }
+	friend Float4 Min3(Float4 a, Float4 b, Float4 c) noexcept { return Min(a, Min(b, c)); }
+	friend Float4 Max3(Float4 a, Float4 b, Float4 c) noexcept { return Max(a, Max(b, c)); }
+
+	// 将 alpha 通道设为 1，用于只输出 RGB 的效果
+	Float4 WithOpaqueAlpha() const noexcept {
+		return { (*this)[0], (*this)[1], (*this)[2], 1.0f };
+	}
+};
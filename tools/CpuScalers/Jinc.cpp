@@ -0,0 +1,59 @@
+#include "Common.h"
+
+
+static constexpr float PI = 3.1415926535897932384626433832795f;
+
+static float Resampler(float x, float wa, float wb) noexcept {
+	return x == 0.0f ? wa * wb : std::sin(x * wa) * std::sin(x * wb) / (x * x);
+}
+
+CpuImage CpuScalers::Jinc(
+	const CpuImage& src,
+	uint32_t outputWidth,
+	uint32_t outputHeight,
+	float windowSinc,
+	float sinc,
+	float arStrength
+) {
+	CpuImage result(outputWidth, outputHeight);
+
+	const float scaleX = (float)src.width / outputWidth;
+	const float scaleY = (float)src.height / outputHeight;
+	const float wa = windowSinc * PI;
+	const float wb = sinc * PI;
+
+	ForEachPixel(result, [&](uint32_t x, uint32_t y) {
+		const float px = (x + 0.5f) * scaleX - 0.5f;
+		const float py = (y + 0.5f) * scaleY - 0.5f;
+		const float fx = std::floor(px);
+		const float fy = std::floor(py);
+		const int ix = (int)fx - 1;
+		const int iy = (int)fy - 1;
+
+		// 4x4 个纹素的权重取决于到采样点的欧氏距离，因此不可分离
+		Float4 color;
+		float weightSum = 0;
+		Float4 src4x4[4][4];
+		for (int j = 0; j < 4; ++j) {
+			for (int i = 0; i < 4; ++i) {
+				const float dx = px - fx - (i - 1);
+				const float dy = py - fy - (j - 1);
+				const float weight = Resampler(std::sqrt(dx * dx + dy * dy), wa, wb);
+
+				src4x4[j][i] = Fetch(src, ix + i, iy + j);
+				color = Mad(src4x4[j][i], weight, color);
+				weightSum += weight;
+			}
+		}
+		color = color / weightSum;
+
+		// 抗振铃
+		const Float4 minSample = Min(Min(src4x4[1][1], src4x4[1][2]), Min(src4x4[2][1], src4x4[2][2]));
+		const Float4 maxSample = Max(Max(src4x4[1][1], src4x4[1][2]), Max(src4x4[2][1], src4x4[2][2]));
+		color = Lerp(color, Clamp(color, minSample, maxSample), arStrength);
+
+		return color.WithOpaqueAlpha();
+	});
+
+	return result;
+}
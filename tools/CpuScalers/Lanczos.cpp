@@ -0,0 +1,69 @@
+#include "Common.h"
+
+
+static constexpr float PI = 3.14159265359f;
+
+// Lanczos3，不乘以半径，因为之后会归一化
+static float Weight(float x) noexcept {
+	const float s = std::max(std::abs(2.0f * PI * x), 1e-5f);
+	return std::sin(s) * std::sin(s * (1.0f / 3.0f)) / (s * s);
+}
+
+// taps[i] 为第 i 个纹素的权重，f 为采样点相对于第 2 个纹素中心的偏移
+static void Weight6(float f, float (&taps)[6]) noexcept {
+	float sum = 0;
+	for (int i = 0; i < 6; ++i) {
+		// 和 Lanczos.hlsl 中的 weight3(0.5f - f * 0.5f) 和 weight3(1.0f - f * 0.5f) 相同
+		taps[i] = Weight((2.0f + f - i) * 0.5f);
+		sum += taps[i];
+	}
+	for (float& tap : taps) {
+		tap /= sum;
+	}
+}
+
+CpuImage CpuScalers::Lanczos(const CpuImage& src, uint32_t outputWidth, uint32_t outputHeight, float arStrength) {
+	CpuImage result(outputWidth, outputHeight);
+
+	const float scaleX = (float)src.width / outputWidth;
+	const float scaleY = (float)src.height / outputHeight;
+
+	ForEachPixel(result, [&](uint32_t x, uint32_t y) {
+		const float px = (x + 0.5f) * scaleX - 0.5f;
+		const float py = (y + 0.5f) * scaleY - 0.5f;
+		const float fx = std::floor(px);
+		const float fy = std::floor(py);
+		const int ix = (int)fx - 2;
+		const int iy = (int)fy - 2;
+
+		float lineTaps[6];
+		float columnTaps[6];
+		Weight6(px - fx, lineTaps);
+		Weight6(py - fy, columnTaps);
+
+		Float4 src6x6[6][6];
+		for (int j = 0; j < 6; ++j) {
+			for (int i = 0; i < 6; ++i) {
+				src6x6[j][i] = Fetch(src, ix + i, iy + j);
+			}
+		}
+
+		Float4 color;
+		for (int j = 0; j < 6; ++j) {
+			Float4 line;
+			for (int i = 0; i < 6; ++i) {
+				line = Mad(src6x6[j][i], lineTaps[i], line);
+			}
+			color = Mad(line, columnTaps[j], color);
+		}
+
+		// 抗振铃
+		const Float4 minSample = Min(Min(src6x6[2][2], src6x6[2][3]), Min(src6x6[3][2], src6x6[3][3]));
+		const Float4 maxSample = Max(Max(src6x6[2][2], src6x6[2][3]), Max(src6x6[3][2], src6x6[3][3]));
+		color = Lerp(color, Clamp(color, minSample, maxSample), arStrength);
+
+		return color.WithOpaqueAlpha();
+	});
+
+	return result;
+}
@@ -0,0 +1,314 @@
+#include "Common.h"
+#include "NISCoef.h"
+
+
+static constexpr float kDetectRatio = 2.0f * 1127.f / 1024.f;
+static constexpr float kDetectThres = 64.0f / 1024.0f;
+static constexpr float kEps = 1.0f / 255.0f;
+static constexpr float kMinContrastRatio = 2.0f;
+static constexpr float kMaxContrastRatio = 10.0f;
+static constexpr float kRatioNorm = 1.0f / (kMaxContrastRatio - kMinContrastRatio);
+static constexpr float kContrastBoost = 1.0f;
+static constexpr float kSharpStartY = 0.45f;
+static constexpr float kSharpEndY = 0.9f;
+static constexpr float kSharpScaleY = 1.0f / (kSharpEndY - kSharpStartY);
+static constexpr int kPhaseCount = 64;
+
+// 由 sharpness 参数决定的常量，对应 NIS.hlsl 中同名的宏
+struct NISParams {
+	explicit NISParams(float sharpness) noexcept {
+		const float sharpenSlider = sharpness - 0.5f;
+		const float minScale = sharpenSlider >= 0.0f ? 1.25f : 1.0f;
+		const float maxScale = sharpenSlider >= 0.0f ? 1.25f : 1.75f;
+		const float limitScale = sharpenSlider >= 0.0f ? 1.25f : 1.0f;
+
+		kSharpStrengthMin = std::max(0.0f, 0.4f + sharpenSlider * minScale * 1.2f);
+		const float kSharpStrengthMax = 1.6f + sharpenSlider * maxScale * 1.8f;
+		kSharpStrengthScale = kSharpStrengthMax - kSharpStrengthMin;
+
+		kSharpLimitMin = std::max(0.1f, 0.14f + sharpenSlider * limitScale * 0.32f);
+		const float kSharpLimitMax = 0.5f + sharpenSlider * limitScale * 0.6f;
+		kSharpLimitScale = kSharpLimitMax - kSharpLimitMin;
+	}
+
+	float kSharpStrengthMin;
+	float kSharpStrengthScale;
+	float kSharpLimitMin;
+	float kSharpLimitScale;
+};
+
+// HLSL 的 lerp
+static float LerpF(float a, float b, float t) noexcept {
+	return a + t * (b - a);
+}
+
+static float GetY(Float4 c) noexcept {
+	return 0.2126f * c[0] + 0.7152f * c[1] + 0.0722f * c[2];
+}
+
+// p 为以 (1, 1) 为中心的 3x3 亮度，返回 0、90、45、135 度方向的权重
+static Float4 GetEdgeMap(const float (&p)[3][3]) noexcept {
+	const float g_0 = std::abs(p[0][0] + p[0][1] + p[0][2] - p[2][0] - p[2][1] - p[2][2]);
+	const float g_45 = std::abs(p[1][0] + p[0][0] + p[0][1] - p[2][1] - p[2][2] - p[1][2]);
+	const float g_90 = std::abs(p[0][0] + p[1][0] + p[2][0] - p[0][2] - p[1][2] - p[2][2]);
+	const float g_135 = std::abs(p[1][0] + p[2][0] + p[2][1] - p[0][1] - p[0][2] - p[1][2]);
+
+	const float g_0_90_max = std::max(g_0, g_90);
+	const float g_0_90_min = std::min(g_0, g_90);
+	const float g_45_135_max = std::max(g_45, g_135);
+	const float g_45_135_min = std::min(g_45, g_135);
+
+	if (g_0_90_max + g_45_135_max == 0) {
+		return {};
+	}
+
+	const float e_0_90 = std::min(g_0_90_max / (g_0_90_max + g_45_135_max), 1.0f);
+	const float e_45_135 = 1.0f - e_0_90;
+
+	const bool c_0_90 = (g_0_90_max > (g_0_90_min * kDetectRatio)) && (g_0_90_max > kDetectThres) && (g_0_90_max > g_45_135_min);
+	const bool c_45_135 = (g_45_135_max > (g_45_135_min * kDetectRatio)) && (g_45_135_max > kDetectThres) && (g_45_135_max > g_0_90_min);
+	const bool c_g_0_90 = g_0_90_max == g_0;
+	const bool c_g_45_135 = g_45_135_max == g_45;
+
+	const float f_e_0_90 = (c_0_90 && c_45_135) ? e_0_90 : 1.0f;
+	const float f_e_45_135 = (c_0_90 && c_45_135) ? e_45_135 : 1.0f;
+
+	const float weight_0 = (c_0_90 && c_g_0_90) ? f_e_0_90 : 0.0f;
+	const float weight_90 = (c_0_90 && !c_g_0_90) ? f_e_0_90 : 0.0f;
+	const float weight_45 = (c_45_135 && c_g_45_135) ? f_e_45_135 : 0.0f;
+	const float weight_135 = (c_45_135 && !c_g_45_135) ? f_e_45_135 : 0.0f;
+
+	return { weight_0, weight_90, weight_45, weight_135 };
+}
+
+static float CalcLTI(float p0, float p1, float p2, float p3, float p4, float p5, int phase_index) noexcept {
+	const bool selector = (phase_index <= kPhaseCount / 2);
+	float sel = selector ? p0 : p3;
+	const float a_min = std::min(std::min(p1, p2), sel);
+	const float a_max = std::max(std::max(p1, p2), sel);
+	sel = selector ? p2 : p5;
+	const float b_min = std::min(std::min(p3, p4), sel);
+	const float b_max = std::max(std::max(p3, p4), sel);
+
+	const float a_cont = a_max - a_min;
+	const float b_cont = b_max - b_min;
+
+	const float cont_ratio = std::max(a_cont, b_cont) / (std::min(a_cont, b_cont) + kEps);
+	return (1.0f - std::clamp((cont_ratio - kMinContrastRatio) * kRatioNorm, 0.0f, 1.0f)) * kContrastBoost;
+}
+
+static float EvalPoly6(const NISParams& params, const float (&pxl)[6], int phase_int) noexcept {
+	float y = 0.f;
+	float y_usm = 0.f;
+	for (int i = 0; i < 6; ++i) {
+		y += NIS_COEF_SCALER[phase_int][i] * pxl[i];
+		y_usm += NIS_COEF_USM[phase_int][i] * pxl[i];
+	}
+
+	// let's compute a piece-wise ramp based on luma
+	const float y_scale = 1.0f - std::clamp((y - kSharpStartY) * kSharpScaleY, 0.0f, 1.0f);
+
+	// scale the ramp to sharpen as a function of luma
+	const float y_sharpness = y_scale * params.kSharpStrengthScale + params.kSharpStrengthMin;
+
+	y_usm *= y_sharpness;
+
+	// scale the ramp to limit USM as a function of luma
+	const float y_sharpness_limit = (y_scale * params.kSharpLimitScale + params.kSharpLimitMin) * y;
+
+	y_usm = std::min(y_sharpness_limit, std::max(-y_sharpness_limit, y_usm));
+	// reduce ringing
+	y_usm *= CalcLTI(pxl[0], pxl[1], pxl[2], pxl[3], pxl[4], pxl[5], phase_int);
+
+	return y + y_usm;
+}
+
+static float FilterNormal(const float (&p)[6][6], int phase_x_frac_int, int phase_y_frac_int) noexcept {
+	float h_acc = 0.0f;
+	for (int j = 0; j < 6; ++j) {
+		float v_acc = 0.0f;
+		for (int i = 0; i < 6; ++i) {
+			v_acc += p[i][j] * NIS_COEF_SCALER[phase_y_frac_int][i];
+		}
+		h_acc += v_acc * NIS_COEF_SCALER[phase_x_frac_int][j];
+	}
+	return h_acc;
+}
+
+static float AddDirFilters(
+	const NISParams& params,
+	const float (&p)[6][6],
+	float phase_x_frac,
+	float phase_y_frac,
+	int phase_x_frac_int,
+	int phase_y_frac_int,
+	Float4 w
+) noexcept {
+	float f = 0;
+	if (w[0] > 0.0f) {
+		// 0 deg filter
+		float interp0Deg[6];
+		for (int i = 0; i < 6; ++i) {
+			interp0Deg[i] = LerpF(p[i][2], p[i][3], phase_x_frac);
+		}
+		f += EvalPoly6(params, interp0Deg, phase_y_frac_int) * w[0];
+	}
+	if (w[1] > 0.0f) {
+		// 90 deg filter
+		float interp90Deg[6];
+		for (int i = 0; i < 6; ++i) {
+			interp90Deg[i] = LerpF(p[2][i], p[3][i], phase_y_frac);
+		}
+		f += EvalPoly6(params, interp90Deg, phase_x_frac_int) * w[1];
+	}
+	if (w[2] > 0.0f) {
+		//45 deg filter
+		float pphase_b45 = 0.5f + 0.5f * (phase_x_frac - phase_y_frac);
+
+		float temp_interp45Deg[7];
+		temp_interp45Deg[1] = LerpF(p[2][1], p[1][2], pphase_b45);
+		temp_interp45Deg[3] = LerpF(p[3][2], p[2][3], pphase_b45);
+		temp_interp45Deg[5] = LerpF(p[4][3], p[3][4], pphase_b45);
+		{
+			pphase_b45 = pphase_b45 - 0.5f;
+			const float a = (pphase_b45 >= 0.f) ? p[0][2] : p[2][0];
+			const float b = (pphase_b45 >= 0.f) ? p[1][3] : p[3][1];
+			const float c = (pphase_b45 >= 0.f) ? p[2][4] : p[4][2];
+			const float d = (pphase_b45 >= 0.f) ? p[3][5] : p[5][3];
+			temp_interp45Deg[0] = LerpF(p[1][1], a, std::abs(pphase_b45));
+			temp_interp45Deg[2] = LerpF(p[2][2], b, std::abs(pphase_b45));
+			temp_interp45Deg[4] = LerpF(p[3][3], c, std::abs(pphase_b45));
+			temp_interp45Deg[6] = LerpF(p[4][4], d, std::abs(pphase_b45));
+		}
+
+		float interp45Deg[6];
+		float pphase_p45 = phase_x_frac + phase_y_frac;
+		const int offset = pphase_p45 >= 1 ? 1 : 0;
+		for (int i = 0; i < 6; ++i) {
+			interp45Deg[i] = temp_interp45Deg[i + offset];
+		}
+		pphase_p45 -= offset;
+
+		f += EvalPoly6(params, interp45Deg, int(pphase_p45 * 64)) * w[2];
+	}
+	if (w[3] > 0.0f) {
+		//135 deg filter
+		float pphase_b135 = 0.5f * (phase_x_frac + phase_y_frac);
+
+		float temp_interp135Deg[7];
+		temp_interp135Deg[1] = LerpF(p[3][1], p[4][2], pphase_b135);
+		temp_interp135Deg[3] = LerpF(p[2][2], p[3][3], pphase_b135);
+		temp_interp135Deg[5] = LerpF(p[1][3], p[2][4], pphase_b135);
+		{
+			pphase_b135 = pphase_b135 - 0.5f;
+			const float a = (pphase_b135 >= 0.f) ? p[5][2] : p[3][0];
+			const float b = (pphase_b135 >= 0.f) ? p[4][3] : p[2][1];
+			const float c = (pphase_b135 >= 0.f) ? p[3][4] : p[1][2];
+			const float d = (pphase_b135 >= 0.f) ? p[2][5] : p[0][3];
+			temp_interp135Deg[0] = LerpF(p[4][1], a, std::abs(pphase_b135));
+			temp_interp135Deg[2] = LerpF(p[3][2], b, std::abs(pphase_b135));
+			temp_interp135Deg[4] = LerpF(p[2][3], c, std::abs(pphase_b135));
+			temp_interp135Deg[6] = LerpF(p[1][4], d, std::abs(pphase_b135));
+		}
+
+		float interp135Deg[6];
+		float pphase_p135 = 1 + (phase_x_frac - phase_y_frac);
+		const int offset = pphase_p135 >= 1 ? 1 : 0;
+		for (int i = 0; i < 6; ++i) {
+			interp135Deg[i] = temp_interp135Deg[i + offset];
+		}
+		pphase_p135 -= offset;
+
+		f += EvalPoly6(params, interp135Deg, int(pphase_p135 * 64)) * w[3];
+	}
+	return f;
+}
+
+CpuImage CpuScalers::NIS(const CpuImage& src, uint32_t outputWidth, uint32_t outputHeight, float sharpness) {
+	CpuImage result(outputWidth, outputHeight);
+	if (src.width == 0 || src.height == 0) {
+		return result;
+	}
+
+	const NISParams params(sharpness);
+
+	// NIS.hlsl 在 groupshared 中缓存亮度和边缘图，这里对整个输入预先计算一次
+	std::vector<float> luma((size_t)src.width * src.height);
+	ParallelForTiles(src.width, src.height, [&](uint32_t left, uint32_t top, uint32_t right, uint32_t bottom) {
+		for (uint32_t y = top; y < bottom; ++y) {
+			for (uint32_t x = left; x < right; ++x) {
+				luma[(size_t)y * src.width + x] = GetY(Fetch(src, x, y));
+			}
+		}
+	});
+
+	auto lumaAt = [&](int x, int y) {
+		x = std::clamp(x, 0, (int)src.width - 1);
+		y = std::clamp(y, 0, (int)src.height - 1);
+		return luma[(size_t)y * src.width + x];
+	};
+
+	// 采样点所在纹素和右下方的纹素可能超出边缘一个像素，因此边缘图四周各多一个像素。
+	// 超出边缘的位置使用钳位后的亮度计算，和 NIS.hlsl 相同，因此不能直接钳位边缘图的坐标
+	const uint32_t edgeMapWidth = src.width + 2;
+	const uint32_t edgeMapHeight = src.height + 2;
+	std::vector<Float4> edgeMap((size_t)edgeMapWidth * edgeMapHeight);
+	ParallelForTiles(edgeMapWidth, edgeMapHeight, [&](uint32_t left, uint32_t top, uint32_t right, uint32_t bottom) {
+		for (uint32_t y = top; y < bottom; ++y) {
+			for (uint32_t x = left; x < right; ++x) {
+				float p[3][3];
+				for (int i = 0; i < 3; ++i) {
+					for (int j = 0; j < 3; ++j) {
+						p[i][j] = lumaAt((int)x - 2 + j, (int)y - 2 + i);
+					}
+				}
+				edgeMap[(size_t)y * edgeMapWidth + x] = GetEdgeMap(p);
+			}
+		}
+	});
+
+	const float kScaleX = (float)src.width / outputWidth;
+	const float kScaleY = (float)src.height / outputHeight;
+
+	ForEachPixel(result, [&](uint32_t x, uint32_t y) {
+		// 在输入中的坐标，整数部分和离散的相位
+		const float srcX = (0.5f + x) * kScaleX - 0.5f;
+		const float srcY = (0.5f + y) * kScaleY - 0.5f;
+		const int px = (int)std::floor(srcX);
+		const int py = (int)std::floor(srcY);
+		const float fx = srcX - std::floor(srcX);
+		const float fy = srcY - std::floor(srcY);
+		const int fx_int = int(fx * kPhaseCount);
+		const int fy_int = int(fy * kPhaseCount);
+
+		// generate weights for directional filters
+		const Float4* edgeRow0 = &edgeMap[(size_t)(py + 1) * edgeMapWidth + (px + 1)];
+		const Float4* edgeRow1 = edgeRow0 + edgeMapWidth;
+		const Float4 w = Lerp(Lerp(edgeRow0[0], edgeRow0[1], fx), Lerp(edgeRow1[0], edgeRow1[1], fx), fy);
+
+		// 6x6 support
+		float p[6][6];
+		for (int i = 0; i < 6; ++i) {
+			for (int j = 0; j < 6; ++j) {
+				p[i][j] = lumaAt(px - 2 + j, py - 2 + i);
+			}
+		}
+
+		// weigth for luma
+		const float baseWeight = 1.0f - w[0] - w[1] - w[2] - w[3];
+
+		// final luma is a weighted product of directional & normal filters
+		float opY = FilterNormal(p, fx_int, fy_int) * baseWeight;
+		opY += AddDirFilters(params, p, fx, fy, fx_int, fy_int, w);
+
+		// do bilinear tap for chroma upscaling
+		const Float4 top = Lerp(Fetch(src, px, py), Fetch(src, px + 1, py), fx);
+		const Float4 bottom = Lerp(Fetch(src, px, py + 1), Fetch(src, px + 1, py + 1), fx);
+		const Float4 op = Lerp(top, bottom, fy);
+
+		const float corr = opY - GetY(op);
+		return (op + corr).WithOpaqueAlpha();
+	});
+
+	return result;
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+
+// 从 Effects/NIS_Coef_Scale.dds 和 NIS_Coef_USM.dds 导出，数值为 DDS 中的半精度浮点数
+// 每个相位有 6 个系数，对应 NIS.hlsl 中的 shCoefScaler 和 shCoefUSM
+static constexpr float NIS_COEF_SCALER[64][6] = {
+	{ 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f },
+	{ 0.002899169921875f, -0.01270294189453125f, 1.0f, 0.0131988525390625f, -0.0034008026123046875f, 0.0f },
+	{ 0.0063018798828125f, -0.02490234375f, 0.99853515625f, 0.0269012451171875f, -0.006801605224609375f, 0.0f },
+	{ 0.00879669189453125f, -0.036102294921875f, 0.99560546875f, 0.04150390625f, -0.0102996826171875f, 0.0005002021789550781f },
+	{ 0.0117034912109375f, -0.047393798828125f, 0.9931640625f, 0.05621337890625f, -0.01419830322265625f, 0.0005002021789550781f },
+	{ 0.01419830322265625f, -0.057586669921875f, 0.98974609375f, 0.0712890625f, -0.018096923828125f, 0.0005002021789550781f },
+	{ 0.0166015625f, -0.0673828125f, 0.984375f, 0.08740234375f, -0.022003173828125f, 0.0010004043579101562f },
+	{ 0.0186004638671875f, -0.076171875f, 0.978515625f, 0.10400390625f, -0.026397705078125f, 0.0015001296997070312f },
+	{ 0.0204925537109375f, -0.08502197265625f, 0.97265625f, 0.12060546875f, -0.0308074951171875f, 0.0020008087158203125f },
+	{ 0.0225067138671875f, -0.0927734375f, 0.96484375f, 0.13818359375f, -0.035186767578125f, 0.002399444580078125f },
+	{ 0.023895263671875f, -0.1005859375f, 0.95751953125f, 0.15576171875f, -0.03961181640625f, 0.002899169921875f },
+	{ 0.0254058837890625f, -0.107421875f, 0.94873046875f, 0.173828125f, -0.043914794921875f, 0.0034008026123046875f },
+	{ 0.026397705078125f, -0.11376953125f, 0.93896484375f, 0.19287109375f, -0.048797607421875f, 0.004398345947265625f },
+	{ 0.027801513671875f, -0.11907958984375f, 0.92822265625f, 0.2119140625f, -0.0537109375f, 0.004901885986328125f },
+	{ 0.0287933349609375f, -0.12451171875f, 0.9169921875f, 0.23095703125f, -0.05810546875f, 0.005901336669921875f },
+	{ 0.029296875f, -0.12939453125f, 0.90576171875f, 0.2509765625f, -0.06298828125f, 0.0063018798828125f },
+	{ 0.030303955078125f, -0.13330078125f, 0.892578125f, 0.27099609375f, -0.06787109375f, 0.00730133056640625f },
+	{ 0.0308074951171875f, -0.13671875f, 0.87890625f, 0.29150390625f, -0.07281494140625f, 0.00830078125f },
+	{ 0.0308074951171875f, -0.14013671875f, 0.86572265625f, 0.31201171875f, -0.07757568359375f, 0.00930023193359375f },
+	{ 0.03131103515625f, -0.142578125f, 0.8505859375f, 0.3330078125f, -0.08251953125f, 0.0102996826171875f },
+	{ 0.03131103515625f, -0.14453125f, 0.83544921875f, 0.35400390625f, -0.08740234375f, 0.011199951171875f },
+	{ 0.03131103515625f, -0.14599609375f, 0.8193359375f, 0.37548828125f, -0.09228515625f, 0.01219940185546875f },
+	{ 0.03131103515625f, -0.14697265625f, 0.80224609375f, 0.396484375f, -0.0966796875f, 0.013702392578125f },
+	{ 0.0308074951171875f, -0.14794921875f, 0.78564453125f, 0.41845703125f, -0.10162353515625f, 0.0146026611328125f },
+	{ 0.030303955078125f, -0.14794921875f, 0.76806640625f, 0.43994140625f, -0.10601806640625f, 0.01560211181640625f },
+	{ 0.0298004150390625f, -0.14794921875f, 0.75048828125f, 0.46142578125f, -0.11041259765625f, 0.0166015625f },
+	{ 0.029296875f, -0.14697265625f, 0.7314453125f, 0.48291015625f, -0.11468505859375f, 0.018096923828125f },
+	{ 0.0287933349609375f, -0.14599609375f, 0.7119140625f, 0.5048828125f, -0.11871337890625f, 0.0189971923828125f },
+	{ 0.027801513671875f, -0.14453125f, 0.69287109375f, 0.5263671875f, -0.12261962890625f, 0.0200042724609375f },
+	{ 0.0272979736328125f, -0.14306640625f, 0.67236328125f, 0.5478515625f, -0.1259765625f, 0.0214996337890625f },
+	{ 0.026397705078125f, -0.14111328125f, 0.65283203125f, 0.5693359375f, -0.1298828125f, 0.0225067138671875f },
+	{ 0.0254058837890625f, -0.138671875f, 0.63232421875f, 0.59033203125f, -0.1328125f, 0.023406982421875f },
+	{ 0.0243988037109375f, -0.1357421875f, 0.611328125f, 0.611328125f, -0.1357421875f, 0.0243988037109375f },
+	{ 0.023406982421875f, -0.1328125f, 0.59033203125f, 0.63232421875f, -0.138671875f, 0.0254058837890625f },
+	{ 0.0225067138671875f, -0.1298828125f, 0.5693359375f, 0.65283203125f, -0.14111328125f, 0.026397705078125f },
+	{ 0.0214996337890625f, -0.1259765625f, 0.5478515625f, 0.67236328125f, -0.14306640625f, 0.0272979736328125f },
+	{ 0.0200042724609375f, -0.12261962890625f, 0.5263671875f, 0.69287109375f, -0.14453125f, 0.027801513671875f },
+	{ 0.0189971923828125f, -0.11871337890625f, 0.5048828125f, 0.7119140625f, -0.14599609375f, 0.0287933349609375f },
+	{ 0.018096923828125f, -0.11468505859375f, 0.48291015625f, 0.7314453125f, -0.14697265625f, 0.029296875f },
+	{ 0.0166015625f, -0.11041259765625f, 0.46142578125f, 0.75048828125f, -0.14794921875f, 0.0298004150390625f },
+	{ 0.01560211181640625f, -0.10601806640625f, 0.43994140625f, 0.76806640625f, -0.14794921875f, 0.030303955078125f },
+	{ 0.0146026611328125f, -0.10162353515625f, 0.41845703125f, 0.78564453125f, -0.14794921875f, 0.0308074951171875f },
+	{ 0.013702392578125f, -0.0966796875f, 0.396484375f, 0.80224609375f, -0.14697265625f, 0.03131103515625f },
+	{ 0.01219940185546875f, -0.09228515625f, 0.37548828125f, 0.8193359375f, -0.14599609375f, 0.03131103515625f },
+	{ 0.011199951171875f, -0.08740234375f, 0.35400390625f, 0.83544921875f, -0.14453125f, 0.03131103515625f },
+	{ 0.0102996826171875f, -0.08251953125f, 0.3330078125f, 0.8505859375f, -0.142578125f, 0.03131103515625f },
+	{ 0.00930023193359375f, -0.07757568359375f, 0.31201171875f, 0.86572265625f, -0.14013671875f, 0.0308074951171875f },
+	{ 0.00830078125f, -0.07281494140625f, 0.29150390625f, 0.87890625f, -0.13671875f, 0.0308074951171875f },
+	{ 0.00730133056640625f, -0.06787109375f, 0.27099609375f, 0.892578125f, -0.13330078125f, 0.030303955078125f },
+	{ 0.0063018798828125f, -0.06298828125f, 0.2509765625f, 0.90576171875f, -0.12939453125f, 0.029296875f },
+	{ 0.005901336669921875f, -0.05810546875f, 0.23095703125f, 0.9169921875f, -0.12451171875f, 0.0287933349609375f },
+	{ 0.004901885986328125f, -0.0537109375f, 0.2119140625f, 0.92822265625f, -0.11907958984375f, 0.027801513671875f },
+	{ 0.004398345947265625f, -0.048797607421875f, 0.19287109375f, 0.93896484375f, -0.11376953125f, 0.026397705078125f },
+	{ 0.0034008026123046875f, -0.043914794921875f, 0.173828125f, 0.94873046875f, -0.107421875f, 0.0254058837890625f },
+	{ 0.002899169921875f, -0.03961181640625f, 0.15576171875f, 0.95751953125f, -0.1005859375f, 0.023895263671875f },
+	{ 0.002399444580078125f, -0.035186767578125f, 0.13818359375f, 0.96484375f, -0.0927734375f, 0.0225067138671875f },
+	{ 0.0020008087158203125f, -0.0308074951171875f, 0.12060546875f, 0.97265625f, -0.08502197265625f, 0.0204925537109375f },
+	{ 0.0015001296997070312f, -0.026397705078125f, 0.10400390625f, 0.978515625f, -0.076171875f, 0.0186004638671875f },
+	{ 0.0010004043579101562f, -0.022003173828125f, 0.08740234375f, 0.984375f, -0.0673828125f, 0.0166015625f },
+	{ 0.0005002021789550781f, -0.018096923828125f, 0.0712890625f, 0.98974609375f, -0.057586669921875f, 0.01419830322265625f },
+	{ 0.0005002021789550781f, -0.01419830322265625f, 0.05621337890625f, 0.9931640625f, -0.047393798828125f, 0.0117034912109375f },
+	{ 0.0005002021789550781f, -0.0102996826171875f, 0.04150390625f, 0.99560546875f, -0.036102294921875f, 0.00879669189453125f },
+	{ 0.0f, -0.006801605224609375f, 0.0269012451171875f, 0.99853515625f, -0.02490234375f, 0.0063018798828125f },
+	{ 0.0f, -0.0034008026123046875f, 0.0131988525390625f, 1.0f, -0.01270294189453125f, 0.002899169921875f },
+};
+
+static constexpr float NIS_COEF_USM[64][6] = {
+	{ 0.0f, -0.60009765625f, 1.2001953125f, -0.60009765625f, 0.0f, 0.0f },
+	{ 0.002899169921875f, -0.6083984375f, 1.1982421875f, -0.59033203125f, -0.002899169921875f, 0.0f },
+	{ 0.004901885986328125f, -0.61474609375f, 1.1953125f, -0.5791015625f, -0.006801605224609375f, 0.0005002021789550781f },
+	{ 0.00730133056640625f, -0.61962890625f, 1.189453125f, -0.56591796875f, -0.0102996826171875f, 0.0f },
+	{ 0.00930023193359375f, -0.62353515625f, 1.1806640625f, -0.55126953125f, -0.01509857177734375f, 0.0f },
+	{ 0.011199951171875f, -0.62646484375f, 1.169921875f, -0.53515625f, -0.019500732421875f, 0.0005002021789550781f },
+	{ 0.01219940185546875f, -0.626953125f, 1.158203125f, -0.51806640625f, -0.0258941650390625f, 0.0005002021789550781f },
+	{ 0.01419830322265625f, -0.62841796875f, 1.1455078125f, -0.50048828125f, -0.031707763671875f, 0.0005002021789550781f },
+	{ 0.01560211181640625f, -0.62646484375f, 1.126953125f, -0.47900390625f, -0.038604736328125f, 0.0005002021789550781f },
+	{ 0.0166015625f, -0.62353515625f, 1.109375f, -0.45703125f, -0.04541015625f, 0.0010004043579101562f },
+	{ 0.0175933837890625f, -0.61865234375f, 1.087890625f, -0.4345703125f, -0.053192138671875f, 0.0010004043579101562f },
+	{ 0.018096923828125f, -0.61376953125f, 1.0654296875f, -0.41015625f, -0.061492919921875f, 0.0015001296997070312f },
+	{ 0.0189971923828125f, -0.60693359375f, 1.0400390625f, -0.38427734375f, -0.06982421875f, 0.0015001296997070312f },
+	{ 0.019500732421875f, -0.6005859375f, 1.015625f, -0.357421875f, -0.07958984375f, 0.0020008087158203125f },
+	{ 0.0200042724609375f, -0.5927734375f, 0.9892578125f, -0.32861328125f, -0.08978271484375f, 0.002399444580078125f },
+	{ 0.0200042724609375f, -0.58203125f, 0.9580078125f, -0.298828125f, -0.10009765625f, 0.002899169921875f },
+	{ 0.0200042724609375f, -0.57275390625f, 0.92919921875f, -0.26904296875f, -0.11041259765625f, 0.0034008026123046875f },
+	{ 0.0200042724609375f, -0.56201171875f, 0.8974609375f, -0.23681640625f, -0.12261962890625f, 0.0039005279541015625f },
+	{ 0.0204925537109375f, -0.5498046875f, 0.8642578125f, -0.20458984375f, -0.13427734375f, 0.004398345947265625f },
+	{ 0.0200042724609375f, -0.537109375f, 0.830078125f, -0.1708984375f, -0.146484375f, 0.004901885986328125f },
+	{ 0.019500732421875f, -0.52392578125f, 0.79443359375f, -0.13671875f, -0.15869140625f, 0.005401611328125f },
+	{ 0.019500732421875f, -0.5107421875f, 0.759765625f, -0.10211181640625f, -0.17236328125f, 0.005901336669921875f },
+	{ 0.0189971923828125f, -0.49658203125f, 0.72314453125f, -0.06488037109375f, -0.1865234375f, 0.0063018798828125f },
+	{ 0.0186004638671875f, -0.48193359375f, 0.6845703125f, -0.0287933349609375f, -0.19970703125f, 0.006801605224609375f },
+	{ 0.0186004638671875f, -0.466796875f, 0.64599609375f, 0.00930023193359375f, -0.21435546875f, 0.00730133056640625f },
+	{ 0.0175933837890625f, -0.45068359375f, 0.60546875f, 0.04791259765625f, -0.22900390625f, 0.00830078125f },
+	{ 0.0171051025390625f, -0.43701171875f, 0.5693359375f, 0.08587646484375f, -0.24462890625f, 0.00879669189453125f },
+	{ 0.0160980224609375f, -0.419921875f, 0.5283203125f, 0.12548828125f, -0.259765625f, 0.00980377197265625f },
+	{ 0.0160980224609375f, -0.40478515625f, 0.48828125f, 0.16552734375f, -0.275390625f, 0.0102996826171875f },
+	{ 0.01509857177734375f, -0.388671875f, 0.44970703125f, 0.2041015625f, -0.291015625f, 0.0106964111328125f },
+	{ 0.01419830322265625f, -0.37109375f, 0.4072265625f, 0.24462890625f, -0.306640625f, 0.0117034912109375f },
+	{ 0.013702392578125f, -0.35546875f, 0.3671875f, 0.28515625f, -0.32275390625f, 0.01219940185546875f },
+	{ 0.0131988525390625f, -0.33935546875f, 0.326171875f, 0.326171875f, -0.33935546875f, 0.0131988525390625f },
+	{ 0.01219940185546875f, -0.32275390625f, 0.28515625f, 0.3671875f, -0.35546875f, 0.013702392578125f },
+	{ 0.0117034912109375f, -0.306640625f, 0.24462890625f, 0.4072265625f, -0.37109375f, 0.01419830322265625f },
+	{ 0.0106964111328125f, -0.291015625f, 0.2041015625f, 0.44970703125f, -0.388671875f, 0.01509857177734375f },
+	{ 0.0102996826171875f, -0.275390625f, 0.16552734375f, 0.48828125f, -0.40478515625f, 0.0160980224609375f },
+	{ 0.00980377197265625f, -0.259765625f, 0.12548828125f, 0.5283203125f, -0.419921875f, 0.0160980224609375f },
+	{ 0.00879669189453125f, -0.24462890625f, 0.08587646484375f, 0.5693359375f, -0.43701171875f, 0.0171051025390625f },
+	{ 0.00830078125f, -0.22900390625f, 0.04791259765625f, 0.60546875f, -0.45068359375f, 0.0175933837890625f },
+	{ 0.00730133056640625f, -0.21435546875f, 0.00930023193359375f, 0.64599609375f, -0.466796875f, 0.0186004638671875f },
+	{ 0.006801605224609375f, -0.19970703125f, -0.0287933349609375f, 0.6845703125f, -0.48193359375f, 0.0186004638671875f },
+	{ 0.0063018798828125f, -0.1865234375f, -0.06488037109375f, 0.72314453125f, -0.49658203125f, 0.0189971923828125f },
+	{ 0.005901336669921875f, -0.17236328125f, -0.10211181640625f, 0.759765625f, -0.5107421875f, 0.019500732421875f },
+	{ 0.005401611328125f, -0.15869140625f, -0.13671875f, 0.79443359375f, -0.52392578125f, 0.019500732421875f },
+	{ 0.004901885986328125f, -0.146484375f, -0.1708984375f, 0.830078125f, -0.537109375f, 0.0200042724609375f },
+	{ 0.004398345947265625f, -0.13427734375f, -0.20458984375f, 0.8642578125f, -0.5498046875f, 0.0204925537109375f },
+	{ 0.0039005279541015625f, -0.12261962890625f, -0.23681640625f, 0.8974609375f, -0.56201171875f, 0.0200042724609375f },
+	{ 0.0034008026123046875f, -0.11041259765625f, -0.26904296875f, 0.92919921875f, -0.57275390625f, 0.0200042724609375f },
+	{ 0.002899169921875f, -0.10009765625f, -0.298828125f, 0.9580078125f, -0.58203125f, 0.0200042724609375f },
+	{ 0.002399444580078125f, -0.08978271484375f, -0.32861328125f, 0.9892578125f, -0.5927734375f, 0.0200042724609375f },
+	{ 0.0020008087158203125f, -0.07958984375f, -0.357421875f, 1.015625f, -0.6005859375f, 0.019500732421875f },
+	{ 0.0015001296997070312f, -0.06982421875f, -0.38427734375f, 1.0400390625f, -0.60693359375f, 0.0189971923828125f },
+	{ 0.0015001296997070312f, -0.061492919921875f, -0.41015625f, 1.0654296875f, -0.61376953125f, 0.018096923828125f },
+	{ 0.0010004043579101562f, -0.053192138671875f, -0.4345703125f, 1.087890625f, -0.61865234375f, 0.0175933837890625f },
+	{ 0.0010004043579101562f, -0.04541015625f, -0.45703125f, 1.109375f, -0.62353515625f, 0.0166015625f },
+	{ 0.0005002021789550781f, -0.038604736328125f, -0.47900390625f, 1.126953125f, -0.62646484375f, 0.01560211181640625f },
+	{ 0.0005002021789550781f, -0.031707763671875f, -0.50048828125f, 1.1455078125f, -0.62841796875f, 0.01419830322265625f },
+	{ 0.0005002021789550781f, -0.0258941650390625f, -0.51806640625f, 1.158203125f, -0.626953125f, 0.01219940185546875f },
+	{ 0.0005002021789550781f, -0.019500732421875f, -0.53515625f, 1.169921875f, -0.62646484375f, 0.011199951171875f },
+	{ 0.0f, -0.01509857177734375f, -0.55126953125f, 1.1806640625f, -0.62353515625f, 0.00930023193359375f },
+	{ 0.0f, -0.0102996826171875f, -0.56591796875f, 1.189453125f, -0.61962890625f, 0.00730133056640625f },
+	{ 0.0005002021789550781f, -0.006801605224609375f, -0.5791015625f, 1.1953125f, -0.61474609375f, 0.004901885986328125f },
+	{ 0.0f, -0.002899169921875f, -0.59033203125f, 1.1982421875f, -0.6083984375f, 0.002899169921875f },
+};
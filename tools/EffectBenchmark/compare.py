@@ -0,0 +1,64 @@
+import argparse
+import json
+import sys
+
+# 比较 main.py 保存的两个结果文件，按顺序将效果一一对应
+# 只依赖标准库，可以在任何平台上运行
+
+
+def change(a, b):
+	if a == 0:
+		return "-"
+	return f"{(b - a) / a * 100:+.1f}%"
+
+
+def gpu_time(report):
+	# 各通道 GPU 时间的平均值之和
+	return sum(p["mean"] for p in report["passes"])
+
+
+def compare_reports(a, b):
+	print(f"{a['effect']} -> {b['effect']}")
+
+	rows = [
+		("编译用时 (ms)", a["compileTime"], b["compileTime"]),
+		("缓存大小 (KiB)", a["cacheSize"] / 1024, b["cacheSize"] / 1024),
+		("帧时间 mean (ms)", a["frameTime"]["mean"], b["frameTime"]["mean"]),
+		("帧时间 p99 (ms)", a["frameTime"]["p99"], b["frameTime"]["p99"]),
+		("GPU 时间 (ms)", gpu_time(a), gpu_time(b)),
+	]
+
+	# 通道数相同时逐个比较，否则只比较总和
+	if len(a["passes"]) == len(b["passes"]):
+		for i, (pa, pb) in enumerate(zip(a["passes"], b["passes"])):
+			rows.append((f"通道 {i + 1} (ms)", pa["mean"], pb["mean"]))
+	else:
+		print(f"\t通道数不同（{len(a['passes'])} 和 {len(b['passes'])}），只比较总和")
+
+	for name, va, vb in rows:
+		print(f"\t{name}：{va:.3f} -> {vb:.3f}，{change(va, vb)}")
+
+
+def main():
+	parser = argparse.ArgumentParser(description="比较两次基准测试的结果")
+	parser.add_argument("baseline", help="作为基准的结果文件")
+	parser.add_argument("target", help="要比较的结果文件")
+	args = parser.parse_args()
+
+	with open(args.baseline, encoding="utf-8") as f:
+		baseline = json.load(f)
+	with open(args.target, encoding="utf-8") as f:
+		target = json.load(f)
+
+	if len(baseline) != len(target):
+		print("两个结果文件中的效果数不同", file=sys.stderr)
+		return 1
+
+	for a, b in zip(baseline, target):
+		compare_reports(a, b)
+
+	return 0
+
+
+if __name__ == "__main__":
+	sys.exit(main())
@@ -0,0 +1,157 @@
+import argparse
+import ctypes
+import glob
+import json
+import os
+import re
+import subprocess
+import sys
+
+import compare
+
+# 通过 MagpieRT.dll 导出的 Benchmark 测量效果的编译用时、缓存大小和各通道的 GPU 时间
+# 只能在 Windows 上运行，仅依赖标准库
+
+
+def load_runtime(magpie_dir, log_level):
+	runtime = ctypes.WinDLL(os.path.join(magpie_dir, "MagpieRT.dll"))
+
+	runtime.Initialize.argtypes = [ctypes.c_uint, ctypes.c_char_p, ctypes.c_int, ctypes.c_int]
+	runtime.Initialize.restype = ctypes.c_int
+	runtime.Benchmark.argtypes = [ctypes.c_char_p] + [ctypes.c_uint] * 5
+	runtime.Benchmark.restype = ctypes.c_char_p
+
+	if not runtime.Initialize(log_level, b".\\logs\\Benchmark.log", 100000, 1):
+		raise RuntimeError("初始化 MagpieRT 失败")
+	return runtime
+
+
+def get_cache_files(effect):
+	# 缓存文件的命名和 EffectCacheManager 相同：{效果名}_{标志位}{哈希}
+	return glob.glob(os.path.join("cache", glob.escape(effect) + "_*"))
+
+
+def benchmark_effect(runtime, effect, args):
+	# 删除缓存，使编译用时包含 D3DCompile
+	if not args.keep_cache:
+		for file in get_cache_files(effect):
+			os.remove(file)
+
+	effects_json = json.dumps([{"effect": effect}]).encode("utf-8")
+	result = runtime.Benchmark(
+		effects_json,
+		args.input[0],
+		args.input[1],
+		args.output[0],
+		args.output[1],
+		args.frames
+	)
+	if not result:
+		raise RuntimeError(f"{effect} 的基准测试失败，详见 logs\\Benchmark.log")
+
+	report = json.loads(result.decode("utf-8"))
+	report["effect"] = effect
+	report["cacheSize"] = sum(os.path.getsize(file) for file in get_cache_files(effect))
+	return report
+
+
+# 效果引用的其他文件：SOURCE 指定的纹理和缓冲区，以及 #include 的头文件
+DEPENDENCY_PATTERN = re.compile(r'^(//!SOURCE\s+|#include\s+")([^"\s]+)', re.MULTILINE)
+
+BASELINE_SUFFIX = "_Baseline"
+
+
+def git_show(repo, revision, path):
+	return subprocess.run(
+		["git", "-C", repo, "show", f"{revision}:{path}"],
+		capture_output=True,
+		check=True
+	).stdout
+
+
+def add_suffix(file_name):
+	stem, ext = os.path.splitext(file_name)
+	return stem + BASELINE_SUFFIX + ext
+
+
+def extract_baseline(repo, revision, effect):
+	"""将 revision 中的效果以 {效果名}_Baseline 为名放入 effects 文件夹，返回写入的文件"""
+	source = git_show(repo, revision, f"Effects/{effect}.hlsl").decode("utf-8")
+
+	# 依赖的文件也可能已改变，因此一并取出并改名
+	files = []
+	for dependency in sorted(set(m.group(2) for m in DEPENDENCY_PATTERN.finditer(source))):
+		file = os.path.join("effects", add_suffix(dependency))
+		with open(file, "wb") as f:
+			f.write(git_show(repo, revision, f"Effects/{dependency}"))
+		files.append(file)
+	source = DEPENDENCY_PATTERN.sub(lambda m: m.group(1) + add_suffix(m.group(2)), source)
+
+	file = os.path.join("effects", effect + BASELINE_SUFFIX + ".hlsl")
+	with open(file, "w", encoding="utf-8", newline="") as f:
+		f.write(source)
+	files.append(file)
+	return files
+
+
+def print_report(report):
+	print(f"{report['effect']}：编译 {report['compileTime']:.1f} ms，缓存 {report['cacheSize'] / 1024:.1f} KiB，"
+		f"帧时间 {report['frameTime']['mean']:.3f} ms")
+	for p in report["passes"]:
+		print(f"\t{p['name']}：mean {p['mean']:.3f} ms，p50 {p['p50']:.3f} ms，p99 {p['p99']:.3f} ms")
+
+
+def main():
+	parser = argparse.ArgumentParser(description="测量效果的编译用时、缓存大小和 GPU 时间")
+	parser.add_argument("effects", nargs="+", help="效果名，如 ACNet")
+	parser.add_argument("--magpie", required=True, help="Magpie 所在的文件夹，其中有 MagpieRT.dll 和 effects 文件夹")
+	parser.add_argument("--input", type=int, nargs=2, default=[1920, 1080], metavar=("WIDTH", "HEIGHT"), help="合成帧的尺寸")
+	parser.add_argument("--output", type=int, nargs=2, default=[3840, 2160], metavar=("WIDTH", "HEIGHT"), help="输出尺寸")
+	parser.add_argument("--frames", type=int, default=500, help="渲染的帧数，不包括预热的帧")
+	parser.add_argument("--keep-cache", action="store_true", help="不删除效果缓存")
+	parser.add_argument("--log-level", type=int, default=2, help="MagpieRT 的日志级别")
+	parser.add_argument("-o", "--json", help="将结果保存为 json 文件")
+	parser.add_argument("--baseline", metavar="REVISION", help="同时测试 git 仓库中该版本的效果并和当前版本比较")
+	parser.add_argument("--repo", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", ".."),
+		help="--baseline 使用的 git 仓库，默认为本工具所在的仓库")
+	args = parser.parse_args()
+
+	if sys.platform != "win32":
+		print("只能在 Windows 上运行", file=sys.stderr)
+		return 1
+
+	if args.json:
+		args.json = os.path.abspath(args.json)
+	args.repo = os.path.abspath(args.repo)
+
+	# MagpieRT 从当前目录的 effects 和 cache 文件夹读取效果和缓存
+	os.chdir(args.magpie)
+	runtime = load_runtime(os.getcwd(), args.log_level)
+
+	reports = []
+	for effect in args.effects:
+		if args.baseline:
+			files = extract_baseline(args.repo, args.baseline, effect)
+			try:
+				baseline = benchmark_effect(runtime, effect + BASELINE_SUFFIX, args)
+			finally:
+				for file in files:
+					os.remove(file)
+			print_report(baseline)
+
+		report = benchmark_effect(runtime, effect, args)
+		print_report(report)
+		reports.append(report)
+
+		if args.baseline:
+			compare.compare_reports(baseline, report)
+
+	if args.json:
+		with open(args.json, "w", encoding="utf-8") as f:
+			json.dump(reports, f, ensure_ascii=False, indent="\t")
+
+	return 0
+
+
+if __name__ == "__main__":
+	sys.exit(main())
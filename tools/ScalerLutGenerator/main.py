@@ -0,0 +1,101 @@
+import argparse
+import math
+import struct
+import sys
+
+# 生成可分离缩放效果使用的多相权重表，保存为 DDS 文件供 TEXTURE 块的 SOURCE 使用
+# 仅依赖标准库
+
+
+# DDS 文件头中的常量
+DDS_MAGIC = 0x20534444
+DDSD_CAPS = 0x1
+DDSD_HEIGHT = 0x2
+DDSD_WIDTH = 0x4
+DDSD_PITCH = 0x8
+DDSD_PIXELFORMAT = 0x1000
+DDSD_MIPMAPCOUNT = 0x20000
+DDPF_FOURCC = 0x4
+DDSCAPS_TEXTURE = 0x1000
+# D3DFMT_A32B32G32R32F，加载为 DXGI_FORMAT_R32G32B32A32_FLOAT
+FOURCC_R32G32B32A32_FLOAT = 116
+
+
+def lanczos(x, radius):
+	if x == 0:
+		return 1.0
+	if abs(x) >= radius:
+		return 0.0
+	px = math.pi * x
+	return radius * math.sin(px) * math.sin(px / radius) / (px * px)
+
+
+def build_table(radius, phases):
+	# 第 p 行为相位 f = p / phases 时 2 * radius 个抽头的权重
+	# 抽头 i 对应的源像素中心到采样点的距离为 i - (radius - 1) - f，和 Lanczos.hlsl 相同
+	taps = 2 * radius
+	rows = []
+	for p in range(phases + 1):
+		f = p / phases
+		weights = [lanczos(i - (radius - 1) - f, radius) for i in range(taps)]
+		total = sum(weights)
+		rows.append([w / total for w in weights])
+	return rows
+
+
+def write_dds(file_name, rows):
+	# 每行的权重每 4 个打包为一个 float4 纹素，不足的补 0
+	width = (len(rows[0]) + 3) // 4
+	height = len(rows)
+
+	header = struct.pack(
+		"<7I44x8I20x",
+		124,
+		DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PITCH | DDSD_PIXELFORMAT | DDSD_MIPMAPCOUNT,
+		height,
+		width,
+		width * 16,
+		0,
+		1,
+		# DDS_PIXELFORMAT
+		32,
+		DDPF_FOURCC,
+		FOURCC_R32G32B32A32_FLOAT,
+		0, 0, 0, 0, 0,
+	)
+	# dwCaps 位于 DDS_PIXELFORMAT 之后
+	header = header[:104] + struct.pack("<I", DDSCAPS_TEXTURE) + header[108:]
+	assert len(header) == 124
+
+	with open(file_name, "wb") as f:
+		f.write(struct.pack("<I", DDS_MAGIC))
+		f.write(header)
+		for row in rows:
+			padded = row + [0.0] * (width * 4 - len(row))
+			f.write(struct.pack(f"<{len(padded)}f", *padded))
+
+
+def main():
+	parser = argparse.ArgumentParser(description="生成 Lanczos 多相权重表")
+	parser.add_argument("-o", "--output", required=True, help="输出的 .dds 文件")
+	parser.add_argument("--radius", type=int, default=3, help="Lanczos 的半径，抽头数为它的两倍")
+	parser.add_argument("--phases", type=int, default=256, help="相位的数量，权重表有 phases + 1 行")
+	args = parser.parse_args()
+
+	if args.radius < 1 or args.radius > 8:
+		parser.error("--radius 必须在 1 到 8 之间")
+	if args.phases < 2 or args.phases > 4096:
+		parser.error("--phases 必须在 2 到 4096 之间")
+
+	try:
+		write_dds(args.output, build_table(args.radius, args.phases))
+	except OSError as e:
+		print(f"错误：{e}", file=sys.stderr)
+		return 1
+
+	print(f"已生成 {args.output}")
+	return 0
+
+
+if __name__ == "__main__":
+	sys.exit(main())